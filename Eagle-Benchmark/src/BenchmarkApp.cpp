@@ -0,0 +1,139 @@
+#include "BenchmarkApp.h"
+#include "BenchmarkLayer.h"
+#include "SceneGenerators.h"
+
+#include <Eagle/Core/Core.h>
+#include <Eagle/Core/EntryPoint.h>
+
+namespace Eagle
+{
+	EagleBenchmark::EagleBenchmark(const BenchmarkSettings& settings)
+		: Application("Eagle Benchmark", settings.API, true)
+	{
+		m_Window->SetVSync(false);
+		m_Window->SetWindowSize(int(settings.Width), int(settings.Height));
+		PushLayer(MakeRef<BenchmarkLayer>(settings));
+	}
+
+	static void PrintUsage()
+	{
+		std::string scenarios;
+		for (std::string_view name : SceneGenerator::GetScenarioNames())
+			scenarios.append(" ").append(name);
+
+		EG_CORE_INFO("Usage: Eagle-Benchmark [options]\n"
+			"  --scenario <name[,name...]|all>  Scenarios to run. Available:{}\n"
+			"  --count <N>                      Number of generated objects (default: 1000)\n"
+			"  --frames <N>                     Number of measured frames (default: 300)\n"
+			"  --warmup <N>                     Number of frames to skip before measuring (default: 60)\n"
+			"  --size <W>x<H>                   Render resolution (default: 1920x1080)\n"
+			"  --api <vulkan|null>              'null' measures CPU only (default: vulkan)\n"
+			"  --output <path>                  Path of the JSON report (default: benchmark.json)\n"
+			"  --dump <folder>                  Saves the last frame of every scenario as a PNG (vulkan only)", scenarios);
+	}
+
+	static std::vector<std::string> SplitScenarios(const std::string& value)
+	{
+		if (value == "all")
+			return { SceneGenerator::GetScenarioNames().begin(), SceneGenerator::GetScenarioNames().end() };
+
+		std::vector<std::string> result;
+		size_t start = 0;
+		while (start <= value.size())
+		{
+			const size_t end = std::min(value.find(',', start), value.size());
+			if (end > start)
+				result.emplace_back(value.substr(start, end - start));
+			start = end + 1;
+		}
+		return result;
+	}
+
+	// Returns false if the arguments are invalid
+	static bool ParseCommandLine(const ApplicationCommandLineArgs& args, BenchmarkSettings& settings)
+	{
+		for (int i = 1; i < args.Count; ++i)
+		{
+			const std::string_view arg = args[i];
+			if (arg == "--help" || arg == "-h")
+				return false;
+
+			if (i + 1 >= args.Count)
+			{
+				EG_CORE_ERROR("[Benchmark] Missing value for '{}'", arg);
+				return false;
+			}
+			const std::string value = args[++i];
+
+			try
+			{
+				if (arg == "--scenario")
+					settings.Scenarios = SplitScenarios(value);
+				else if (arg == "--count")
+					settings.Count = uint32_t(std::stoul(value));
+				else if (arg == "--frames")
+					settings.Frames = glm::max(1u, uint32_t(std::stoul(value)));
+				else if (arg == "--warmup")
+					settings.WarmupFrames = uint32_t(std::stoul(value));
+				else if (arg == "--size")
+				{
+					const size_t separator = value.find('x');
+					settings.Width = uint32_t(std::stoul(value.substr(0, separator)));
+					settings.Height = uint32_t(std::stoul(value.substr(separator + 1)));
+				}
+				else if (arg == "--api")
+				{
+					if (value == "null")
+						settings.API = RendererAPIType::Null;
+					else if (value == "vulkan")
+						settings.API = RendererAPIType::Vulkan;
+					else
+					{
+						EG_CORE_ERROR("[Benchmark] Unknown API '{}'", value);
+						return false;
+					}
+				}
+				else if (arg == "--output")
+					settings.OutputPath = value;
+				else if (arg == "--dump")
+					settings.DumpFolder = value;
+				else
+				{
+					EG_CORE_ERROR("[Benchmark] Unknown argument '{}'", arg);
+					return false;
+				}
+			}
+			catch (const std::exception&)
+			{
+				EG_CORE_ERROR("[Benchmark] Invalid value '{}' for '{}'", value, arg);
+				return false;
+			}
+		}
+
+		for (const auto& scenario : settings.Scenarios)
+		{
+			if (!SceneGenerator::Create(scenario))
+			{
+				EG_CORE_ERROR("[Benchmark] Unknown scenario '{}'", scenario);
+				return false;
+			}
+		}
+
+		if (settings.Scenarios.empty())
+			settings.Scenarios = SplitScenarios("all");
+
+		return true;
+	}
+
+	Application* CreateApplication(ApplicationCommandLineArgs args)
+	{
+		BenchmarkSettings settings;
+		if (!ParseCommandLine(args, settings))
+		{
+			PrintUsage();
+			std::exit(1);
+		}
+
+		return new EagleBenchmark(settings);
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Eagle.h"
+
+namespace Eagle
+{
+	struct BenchmarkSettings
+	{
+		std::vector<std::string> Scenarios;
+		Path OutputPath = "benchmark.json";
+		Path DumpFolder; // If set, the last frame of every scenario is saved as a PNG. Vulkan only
+		uint32_t Count = 1000; // Number of objects that generators create
+		uint32_t Frames = 300; // Number of measured frames
+		uint32_t WarmupFrames = 60;
+		uint32_t Width = 1920;
+		uint32_t Height = 1080;
+		RendererAPIType API = RendererAPIType::Vulkan;
+	};
+
+	class EagleBenchmark : public Application
+	{
+	public:
+		EagleBenchmark(const BenchmarkSettings& settings);
+	};
+}
@@ -0,0 +1,402 @@
+#include "BenchmarkLayer.h"
+#include "JsonWriter.h"
+
+#include "Eagle/Script/ScriptEngine.h"
+#include "Eagle/Renderer/RendererContext.h"
+#include "Eagle/Utils/PlatformUtils.h"
+#include "Platform/Vulkan/VulkanSwapchain.h"
+
+#include <imgui/imgui.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace Eagle
+{
+	// Scenes are always simulated with a fixed timestep so that every run does the same amount of work
+	static constexpr float s_SimulationTimestep = 1.f / 60.f;
+
+#ifdef EG_CPU_TIMINGS
+	static void FlattenCPUTiming(const CPUTiming::Data& data, const std::string& parentPath, std::map<std::string, BenchmarkLayer::Sample>& outSamples)
+	{
+		std::string path = parentPath.empty() ? std::string(data.Name) : parentPath + "/" + std::string(data.Name);
+		for (const auto& child : data.Children)
+			FlattenCPUTiming(child, path, outSamples);
+		outSamples[std::move(path)].Add(data.Timing);
+	}
+#endif
+
+	static void FlattenGPUTiming(const GPUTimingData& data, const std::string& parentPath, std::map<std::string, BenchmarkLayer::Sample>& outSamples)
+	{
+		std::string path = parentPath.empty() ? std::string(data.Name) : parentPath + "/" + std::string(data.Name);
+		for (const auto& child : data.Children)
+			FlattenGPUTiming(child, path, outSamples);
+		outSamples[std::move(path)].Add(data.Timing);
+	}
+
+	static void WriteSample(JsonWriter& writer, std::string_view key, const BenchmarkLayer::Sample& sample)
+	{
+		writer.BeginObject(key);
+		writer.Write("mean", sample.GetMean());
+		writer.Write("min", sample.Count ? sample.Min : 0.0);
+		writer.Write("max", sample.Max);
+		writer.Write("samples", sample.Count);
+		writer.EndObject();
+	}
+
+	static void AddRHICounters(const RHICounters& counters, std::map<std::string_view, BenchmarkLayer::Sample>& outSamples)
+	{
+		outSamples["Draws"].Add(counters.Draws);
+		outSamples["Dispatches"].Add(counters.Dispatches);
+		outSamples["RenderPassBegins"].Add(counters.RenderPassBegins);
+		outSamples["PipelineBinds"].Add(counters.PipelineBinds);
+		outSamples["DescriptorBinds"].Add(counters.DescriptorBinds);
+		outSamples["DescriptorWrites"].Add(counters.DescriptorWrites);
+		outSamples["DescriptorCacheHits"].Add(counters.DescriptorCacheHits);
+		outSamples["VertexBufferBinds"].Add(counters.VertexBufferBinds);
+		outSamples["IndexBufferBinds"].Add(counters.IndexBufferBinds);
+		outSamples["Barriers"].Add(counters.Barriers);
+		outSamples["StagingAllocations"].Add(counters.StagingAllocations);
+		outSamples["BytesWritten"].Add(double(counters.BytesWritten));
+	}
+
+	// `percentile` is in [0; 1] range
+	static float GetPercentile(std::vector<float> values, float percentile)
+	{
+		if (values.empty())
+			return 0.f;
+
+		const size_t index = std::min(values.size() - 1, size_t(percentile * float(values.size() - 1) + 0.5f));
+		std::nth_element(values.begin(), values.begin() + index, values.end());
+		return values[index];
+	}
+
+	// Sum of mean timings of all passes with that name, regardless of their parents
+	static double GetGPUPassTime(const std::map<std::string, BenchmarkLayer::Sample>& timings, std::string_view passName)
+	{
+		double result = 0.0;
+		for (const auto& [path, sample] : timings)
+		{
+			const size_t nameStart = path.rfind('/');
+			const std::string_view name = nameStart == std::string::npos ? std::string_view(path) : std::string_view(path).substr(nameStart + 1);
+			if (name == passName)
+				result += sample.GetMean();
+		}
+		return result;
+	}
+
+	static std::string_view GetAPIName(RendererAPIType api)
+	{
+		switch (api)
+		{
+			case RendererAPIType::Vulkan: return "vulkan";
+			case RendererAPIType::Null: return "null";
+		}
+		return "none";
+	}
+
+	BenchmarkLayer::BenchmarkLayer(const BenchmarkSettings& settings)
+		: Layer("BenchmarkLayer")
+		, m_Settings(settings)
+	{}
+
+	void BenchmarkLayer::OnAttach()
+	{
+		const auto& scenarios = m_Settings.Scenarios;
+		if (std::find(scenarios.begin(), scenarios.end(), "scripts") != scenarios.end())
+			ScriptEngine::LoadAppAssembly("Sandbox.dll");
+
+		if (!m_Settings.DumpFolder.empty())
+		{
+			if (m_Settings.API == RendererAPIType::Vulkan)
+				std::filesystem::create_directories(m_Settings.DumpFolder);
+			else
+			{
+				EG_CORE_WARN("[Benchmark] Frame dumps are only supported by the Vulkan API");
+				m_Settings.DumpFolder.clear();
+			}
+		}
+
+		m_Results.reserve(scenarios.size());
+		EG_CORE_INFO("[Benchmark] Running {} scenario(s). Objects: {}; Frames: {}; Warmup frames: {}; API: {}",
+			scenarios.size(), m_Settings.Count, m_Settings.Frames, m_Settings.WarmupFrames, GetAPIName(m_Settings.API));
+	}
+
+	void BenchmarkLayer::OnDetach()
+	{
+		Scene::SetCurrentScene(nullptr);
+		m_Scene.reset();
+	}
+
+	void BenchmarkLayer::OnUpdate(Timestep ts)
+	{
+		++m_AppFrame;
+		if (m_bFinished)
+			return;
+
+		if (!m_Scene)
+			StartScenario();
+
+		// Timings that are available now belong to the previous frame.
+		// So the stats of the first measured frame are collected during the next one
+		const uint32_t firstMeasuredFrame = m_Settings.WarmupFrames;
+		const uint32_t lastMeasuredFrame = firstMeasuredFrame + m_Settings.Frames - 1;
+		if (m_ScenarioFrame > firstMeasuredFrame)
+			CollectFrameStats(m_Results.back(), ts);
+
+		if (m_ScenarioFrame > lastMeasuredFrame)
+		{
+			FinishScenario();
+			return;
+		}
+
+		if (m_ScenarioFrame == lastMeasuredFrame && !m_Settings.DumpFolder.empty())
+		{
+			if (auto& swapchain = Application::Get().GetWindow().GetSwapchain())
+				swapchain->DumpFrame(m_AppFrame - 1, m_Settings.DumpFolder / (m_Results.back().Name + ".png"));
+		}
+
+		const float time = float(m_ScenarioFrame) * s_SimulationTimestep;
+		m_Generator->OnUpdate(time);
+		m_Scene->OnUpdate(s_SimulationTimestep);
+		++m_ScenarioFrame;
+	}
+
+	void BenchmarkLayer::OnImGuiRender()
+	{
+		// Presents the scene, so that frame dumps contain it
+		if (!m_Scene || m_Settings.API == RendererAPIType::Null)
+			return;
+
+		const ImGuiViewport* viewport = ImGui::GetMainViewport();
+		ImGui::SetNextWindowPos(viewport->Pos);
+		ImGui::SetNextWindowSize(viewport->Size);
+		ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.f, 0.f));
+		ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.f);
+		ImGui::Begin("Benchmark", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoBringToFrontOnFocus);
+		UI::Image(m_Scene->GetSceneRenderer()->GetOutput(), viewport->Size);
+		ImGui::End();
+		ImGui::PopStyleVar(2);
+	}
+
+	void BenchmarkLayer::StartScenario()
+	{
+		const std::string& name = m_Settings.Scenarios[m_ScenarioIndex];
+		EG_CORE_INFO("[Benchmark] Starting '{}'", name);
+
+		m_Generator = SceneGenerator::Create(name);
+		// Scenes are played like in a game: physics and scripts are simulated, the primary camera is used
+		m_Scene = MakeRef<Scene>(name, nullptr, true);
+		Scene::SetCurrentScene(m_Scene);
+		m_Scene->OnViewportResize(m_Settings.Width, m_Settings.Height);
+		const uint32_t objectsCount = m_Generator->GetCount(m_Settings.Count);
+		m_Generator->Generate(*m_Scene, objectsCount);
+
+		// Object picking is an editor feature, it's not measured
+		auto& renderer = m_Scene->GetSceneRenderer();
+		SceneRendererSettings options = renderer->GetOptions();
+		options.bEnableObjectPicking = false;
+		options.bEnable2DObjectPicking = false;
+		m_Generator->ConfigureRenderer(options);
+		renderer->SetOptions(options);
+
+		m_Scene->OnRuntimeStart();
+
+		ScenarioResult& result = m_Results.emplace_back();
+		result.Name = name;
+		result.Objects = objectsCount;
+		result.FrameTimes.reserve(m_Settings.Frames);
+		m_ScenarioFrame = 0;
+	}
+
+	void BenchmarkLayer::FinishScenario()
+	{
+		ScenarioResult& result = m_Results.back();
+
+		const auto& renderer = m_Scene->GetSceneRenderer();
+		result.RendererStats = renderer->GetStats();
+		result.RendererStats2D = renderer->GetStats2D();
+
+		const GPUMemoryStats memoryStats = Application::Get().GetRenderContext()->GetMemoryStats();
+		result.GPUMemoryUsed = memoryStats.Used;
+		result.GPUMemoryFree = memoryStats.Free;
+		result.GPUResources = memoryStats.Resources.size();
+
+		const Utils::ProcessMemory processMemory = Utils::GetProcessMemory();
+		result.ProcessMemory = processMemory.Current;
+		result.ProcessPeakMemory = processMemory.Peak;
+
+		result.bFailed = m_Generator->HasFailed();
+		if (result.bFailed)
+			EG_CORE_ERROR("[Benchmark] '{}' has failed", result.Name);
+		EG_CORE_INFO("[Benchmark] Finished '{}'. Median frame time: {:.3f}ms", result.Name, GetPercentile(result.FrameTimes, 0.5f));
+
+		m_Scene->OnRuntimeStop();
+		Scene::SetCurrentScene(nullptr);
+		m_Scene.reset();
+		m_Generator.reset();
+
+		++m_ScenarioIndex;
+		if (m_ScenarioIndex == m_Settings.Scenarios.size())
+		{
+			const size_t failedCount = size_t(std::count_if(m_Results.begin(), m_Results.end(), [](const ScenarioResult& result) { return result.bFailed; }));
+			if (failedCount)
+				EG_CORE_ERROR("[Benchmark] {} of {} scenario(s) have failed", failedCount, m_Results.size());
+
+			const bool bReportWritten = WriteReport();
+			m_bFinished = true;
+			Application::Get().SetExitCode(failedCount || !bReportWritten ? 1 : 0);
+			Application::Get().SetShouldClose(true);
+		}
+	}
+
+	void BenchmarkLayer::CollectFrameStats(ScenarioResult& result, Timestep ts)
+	{
+		result.FrameTimes.push_back(ts.GetMilliseconds());
+
+#ifdef EG_CPU_TIMINGS
+		Application& app = Application::Get();
+		for (const auto& [threadID, timings] : app.GetCPUTimings())
+		{
+			std::string threadName(app.GetThreadName(threadID));
+			if (threadName.empty())
+				threadName = "Unknown";
+
+			auto& samples = result.CPUTimings[threadName];
+			for (const auto& timing : timings)
+				FlattenCPUTiming(timing, {}, samples);
+		}
+#endif
+
+		for (const auto& timing : RenderManager::GetTimings())
+			FlattenGPUTiming(timing, {}, result.GPUTimings);
+
+		const RHIStatistics rhi = RenderManager::GetRHIStats();
+		AddRHICounters(rhi, result.RHIStats);
+		for (const auto& [passName, counters] : rhi.Passes)
+			AddRHICounters(counters, result.RHIPasses[std::string(passName)]);
+	}
+
+	bool BenchmarkLayer::WriteReport() const
+	{
+		if (m_Settings.OutputPath.has_parent_path())
+			std::filesystem::create_directories(m_Settings.OutputPath.parent_path());
+
+		std::ofstream stream(m_Settings.OutputPath);
+		if (!stream)
+		{
+			EG_CORE_ERROR("[Benchmark] Failed to open '{}'", m_Settings.OutputPath.u8string());
+			return false;
+		}
+
+		JsonWriter writer(stream);
+		writer.BeginObject();
+		writer.Write("api", GetAPIName(m_Settings.API));
+		writer.Write("objects", m_Settings.Count);
+		writer.Write("frames", m_Settings.Frames);
+		writer.Write("warmup_frames", m_Settings.WarmupFrames);
+		writer.Write("width", m_Settings.Width);
+		writer.Write("height", m_Settings.Height);
+
+		writer.BeginArray("scenarios");
+		for (const auto& result : m_Results)
+			WriteScenario(writer, result);
+		writer.EndArray();
+
+		// Temporal GTAO spreads the samples over several frames.
+		// It should be cheaper than the full one while producing a similar image (see the dumps)
+		auto gtaoFull = std::find_if(m_Results.begin(), m_Results.end(), [](const ScenarioResult& result) { return result.Name == "gtao_full"; });
+		auto gtaoTemporal = std::find_if(m_Results.begin(), m_Results.end(), [](const ScenarioResult& result) { return result.Name == "gtao_temporal"; });
+		if (gtaoFull != m_Results.end() && gtaoTemporal != m_Results.end())
+		{
+			writer.BeginObject("gtao_comparison");
+			writer.Write("full_gpu_ms", GetGPUPassTime(gtaoFull->GPUTimings, "GTAO"));
+			writer.Write("temporal_gpu_ms", GetGPUPassTime(gtaoTemporal->GPUTimings, "GTAO"));
+			writer.Write("full_frame_ms", GetPercentile(gtaoFull->FrameTimes, 0.5f));
+			writer.Write("temporal_frame_ms", GetPercentile(gtaoTemporal->FrameTimes, 0.5f));
+			if (!m_Settings.DumpFolder.empty())
+			{
+				writer.Write("full_image", (m_Settings.DumpFolder / "gtao_full.png").u8string());
+				writer.Write("temporal_image", (m_Settings.DumpFolder / "gtao_temporal.png").u8string());
+			}
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+		stream << '\n';
+
+		EG_CORE_INFO("[Benchmark] Report was written to '{}'", m_Settings.OutputPath.u8string());
+		return true;
+	}
+
+	void BenchmarkLayer::WriteScenario(JsonWriter& writer, const ScenarioResult& result) const
+	{
+		writer.BeginObject();
+		writer.Write("name", result.Name);
+		writer.Write("objects", result.Objects);
+		writer.Write("failed", result.bFailed);
+
+		{
+			Sample frameTime;
+			for (float time : result.FrameTimes)
+				frameTime.Add(time);
+
+			writer.BeginObject("frame_time_ms");
+			writer.Write("mean", frameTime.GetMean());
+			writer.Write("min", frameTime.Count ? frameTime.Min : 0.0);
+			writer.Write("max", frameTime.Max);
+			writer.Write("p50", GetPercentile(result.FrameTimes, 0.5f));
+			writer.Write("p95", GetPercentile(result.FrameTimes, 0.95f));
+			writer.Write("p99", GetPercentile(result.FrameTimes, 0.99f));
+			writer.EndObject();
+		}
+
+		writer.BeginObject("cpu_ms");
+		for (const auto& [threadName, timings] : result.CPUTimings)
+		{
+			writer.BeginObject(threadName);
+			for (const auto& [path, sample] : timings)
+				WriteSample(writer, path, sample);
+			writer.EndObject();
+		}
+		writer.EndObject();
+
+		writer.BeginObject("gpu_ms");
+		for (const auto& [path, sample] : result.GPUTimings)
+			WriteSample(writer, path, sample);
+		writer.EndObject();
+
+		writer.BeginObject("rhi");
+		for (const auto& [name, sample] : result.RHIStats)
+			WriteSample(writer, name, sample);
+		writer.EndObject();
+
+		writer.BeginObject("rhi_passes");
+		for (const auto& [passName, samples] : result.RHIPasses)
+		{
+			writer.BeginObject(passName);
+			for (const auto& [name, sample] : samples)
+				WriteSample(writer, name, sample);
+			writer.EndObject();
+		}
+		writer.EndObject();
+
+		writer.BeginObject("renderer");
+		writer.Write("draw_calls", result.RendererStats.DrawCalls);
+		writer.Write("vertices", result.RendererStats.Vertices);
+		writer.Write("indices", result.RendererStats.Indeces);
+		writer.Write("draw_calls_2d", result.RendererStats2D.DrawCalls);
+		writer.Write("quads_2d", result.RendererStats2D.QuadCount);
+		writer.EndObject();
+
+		writer.BeginObject("memory");
+		writer.Write("gpu_used_bytes", result.GPUMemoryUsed);
+		writer.Write("gpu_free_bytes", result.GPUMemoryFree);
+		writer.Write("gpu_resources", result.GPUResources);
+		writer.Write("process_bytes", result.ProcessMemory);
+		writer.Write("process_peak_bytes", result.ProcessPeakMemory);
+		writer.EndObject();
+
+		writer.EndObject();
+	}
+}
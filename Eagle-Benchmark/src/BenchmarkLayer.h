@@ -0,0 +1,82 @@
+#pragma once
+
+#include "BenchmarkApp.h"
+#include "SceneGenerators.h"
+
+#include "Eagle/Renderer/SceneRenderer.h"
+
+#include <map>
+
+namespace Eagle
+{
+	class JsonWriter;
+
+	// Runs scenarios one by one. Each scenario is warmed up, then measured for a fixed number of frames.
+	// When all scenarios are finished, the report is written and the application is closed
+	class BenchmarkLayer : public Layer
+	{
+	public:
+		BenchmarkLayer(const BenchmarkSettings& settings);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate(Timestep ts) override;
+		void OnImGuiRender() override;
+
+		// Min, max and sum of a value over the measured frames
+		struct Sample
+		{
+			double Sum = 0.0;
+			double Min = std::numeric_limits<double>::max();
+			double Max = 0.0;
+			uint32_t Count = 0;
+
+			void Add(double value)
+			{
+				Sum += value;
+				Min = glm::min(Min, value);
+				Max = glm::max(Max, value);
+				++Count;
+			}
+			double GetMean() const { return Count ? Sum / Count : 0.0; }
+		};
+
+	private:
+		struct ScenarioResult
+		{
+			std::string Name;
+			uint32_t Objects = 0;
+			std::vector<float> FrameTimes; // ms
+			std::map<std::string, std::map<std::string, Sample>> CPUTimings; // Thread name -> timing path -> sample
+			std::map<std::string, Sample> GPUTimings; // Timing path -> sample
+			std::map<std::string_view, Sample> RHIStats; // Counter name -> sample
+			std::map<std::string, std::map<std::string_view, Sample>> RHIPasses; // GPU timing name -> counter name -> sample. Only frames that recorded the pass are sampled
+			SceneRenderer::Statistics RendererStats;
+			SceneRenderer::Statistics2D RendererStats2D;
+			uint64_t GPUMemoryUsed = 0;
+			uint64_t GPUMemoryFree = 0;
+			size_t GPUResources = 0;
+			uint64_t ProcessMemory = 0;
+			uint64_t ProcessPeakMemory = 0;
+			bool bFailed = false;
+		};
+
+		void StartScenario();
+		void FinishScenario();
+		void CollectFrameStats(ScenarioResult& result, Timestep ts);
+		// Returns false if the report couldn't be written
+		bool WriteReport() const;
+		void WriteScenario(JsonWriter& writer, const ScenarioResult& result) const;
+
+	private:
+		BenchmarkSettings m_Settings;
+		std::vector<ScenarioResult> m_Results;
+
+		Ref<Scene> m_Scene;
+		Scope<SceneGenerator> m_Generator;
+		size_t m_ScenarioIndex = 0;
+		uint32_t m_ScenarioFrame = 0;
+		uint64_t m_AppFrame = 0; // Number of frames since the layer was attached. Used to find which frame to dump
+		bool m_bFinished = false;
+	};
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cmath>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+namespace Eagle
+{
+	// Minimal streaming JSON writer for benchmark reports.
+	// Keys are expected to be plain ASCII, string values are escaped
+	class JsonWriter
+	{
+	public:
+		JsonWriter(std::ostream& stream) : m_Stream(stream) {}
+
+		void BeginObject(std::string_view key = {}) { Begin(key, '{'); }
+		void EndObject() { End('}'); }
+
+		void BeginArray(std::string_view key = {}) { Begin(key, '['); }
+		void EndArray() { End(']'); }
+
+		void Write(std::string_view key, std::string_view value)
+		{
+			WriteKey(key);
+			WriteString(value);
+		}
+		void Write(std::string_view key, const char* value) { Write(key, std::string_view(value)); }
+
+		void Write(std::string_view key, bool value)
+		{
+			WriteKey(key);
+			m_Stream << (value ? "true" : "false");
+		}
+
+		template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+		void Write(std::string_view key, T value)
+		{
+			WriteKey(key);
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				if (std::isfinite(value))
+					m_Stream << value;
+				else
+					m_Stream << "null";
+			}
+			else
+				m_Stream << value;
+		}
+
+	private:
+		void Begin(std::string_view key, char bracket)
+		{
+			WriteKey(key);
+			m_Stream << bracket;
+			m_bFirst = true;
+			++m_Depth;
+		}
+
+		void End(char bracket)
+		{
+			--m_Depth;
+			if (!m_bFirst)
+				NewLine();
+			m_Stream << bracket;
+			m_bFirst = false;
+		}
+
+		// Empty key means that the value is an array element or the root
+		void WriteKey(std::string_view key)
+		{
+			if (m_Depth > 0)
+			{
+				if (!m_bFirst)
+					m_Stream << ',';
+				NewLine();
+			}
+			m_bFirst = false;
+
+			if (!key.empty())
+			{
+				WriteString(key);
+				m_Stream << ": ";
+			}
+		}
+
+		void WriteString(std::string_view value)
+		{
+			m_Stream << '"';
+			for (char c : value)
+			{
+				switch (c)
+				{
+					case '"': m_Stream << "\\\""; break;
+					case '\\': m_Stream << "\\\\"; break;
+					case '\n': m_Stream << "\\n"; break;
+					case '\t': m_Stream << "\\t"; break;
+					default:
+						if ((unsigned char)c < 0x20)
+							m_Stream << ' ';
+						else
+							m_Stream << c;
+				}
+			}
+			m_Stream << '"';
+		}
+
+		void NewLine()
+		{
+			m_Stream << '\n';
+			for (int i = 0; i < m_Depth; ++i)
+				m_Stream << '\t';
+		}
+
+	private:
+		std::ostream& m_Stream;
+		int m_Depth = 0;
+		bool m_bFirst = true;
+	};
+}
@@ -0,0 +1,716 @@
+#include "SceneGenerators.h"
+
+#include "Eagle/Classes/StaticMesh.h"
+#include "Eagle/Core/WorldPartition.h"
+#include "Eagle/Debug/CPUTimings.h"
+#include "Eagle/Renderer/Material.h"
+#include "Eagle/Renderer/SceneRenderer.h"
+#include "Eagle/Script/ScriptEngine.h"
+#include "Eagle/UI/Font.h"
+#include "Eagle/Utils/PlatformUtils.h"
+
+namespace Eagle
+{
+	static constexpr const char* s_BenchmarkFontPath = "assets/fonts/opensans/OpenSans-Regular.ttf";
+	static constexpr const char* s_BenchmarkScriptModule = "Sandbox.BenchmarkSpinner";
+
+	static uint32_t GetGridSide(uint32_t count)
+	{
+		return glm::max(1u, (uint32_t)glm::ceil(glm::sqrt(float(count))));
+	}
+
+	class StaticMeshesGenerator : public SceneGenerator
+	{
+	public:
+		StaticMeshesGenerator(std::string_view name = "static_meshes") : SceneGenerator(name) {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+			CreateFloor(scene, count, s_Spacing);
+
+			const Ref<Material> materials[] = { CreateMaterial({ 0.8f, 0.2f, 0.2f }), CreateMaterial({ 0.2f, 0.8f, 0.2f }), CreateMaterial({ 0.2f, 0.2f, 0.8f }) };
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				Entity entity = scene.CreateEntity("Static Mesh");
+				entity.SetWorldTransform(Transform(GetGridLocation(i, count, s_Spacing), Rotator::FromEulerAngles(0.f, float(i), 0.f)));
+
+				auto& sm = entity.AddComponent<StaticMeshComponent>();
+				sm.SetStaticMesh(GetCubeMesh());
+				sm.SetMaterial(materials[i % std::size(materials)]);
+			}
+		}
+
+	protected:
+		static constexpr float s_Spacing = 2.f;
+	};
+
+	class DynamicMeshesGenerator : public SceneGenerator
+	{
+	public:
+		DynamicMeshesGenerator(std::string_view name = "dynamic_meshes") : SceneGenerator(name) {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+			CreateFloor(scene, count, s_Spacing);
+
+			const Ref<Material> material = CreateMaterial({ 0.9f, 0.6f, 0.1f });
+			m_Entities.clear();
+			m_Entities.reserve(count);
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				Entity entity = scene.CreateEntity("Dynamic Mesh");
+				entity.SetWorldLocation(GetGridLocation(i, count, s_Spacing));
+
+				auto& sm = entity.AddComponent<StaticMeshComponent>();
+				sm.SetStaticMesh(GetCubeMesh());
+				sm.SetMaterial(material);
+				m_Entities.push_back(entity);
+			}
+		}
+
+		// Every entity is moved and rotated each frame
+		void OnUpdate(float time) override
+		{
+			const uint32_t count = (uint32_t)m_Entities.size();
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				const float phase = time * 2.f + float(i) * 0.37f;
+				glm::vec3 location = GetGridLocation(i, count, s_Spacing);
+				location.y += glm::sin(phase);
+
+				m_Entities[i].SetWorldTransform(Transform(location, Rotator::FromEulerAngles(0.f, phase, 0.f)));
+			}
+		}
+
+	private:
+		std::vector<Entity> m_Entities;
+		static constexpr float s_Spacing = 2.f;
+	};
+
+	// `dynamic_meshes` with 50k meshes. Measures the cost of tracking changed transforms and sending them to the renderer
+	// (see `Scene. Render Scene` and `Renderer. Set Meshes Transforms` CPU timings)
+	class MovingMeshes50kGenerator : public DynamicMeshesGenerator
+	{
+	public:
+		MovingMeshes50kGenerator() : DynamicMeshesGenerator("moving_meshes_50k") {}
+
+		uint32_t GetCount(uint32_t requestedCount) const override { return 50000u; }
+	};
+
+	// 100k empty entities. Every frame, 1M entities are looked up by their GUIDs like scripts do (see `Benchmark. GUID Lookups` CPU timing).
+	// Nothing is rendered apart from the camera and the sun
+	class GUIDLookupsGenerator : public SceneGenerator
+	{
+	public:
+		GUIDLookupsGenerator() : SceneGenerator("guid_lookups") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, 1.f);
+
+			m_Scene = &scene;
+			m_GUIDs.clear();
+			m_GUIDs.reserve(count);
+			for (uint32_t i = 0; i < count; ++i)
+				m_GUIDs.push_back(scene.CreateEntity("Entity").GetGUID());
+		}
+
+		void OnUpdate(float time) override
+		{
+			EG_CPU_TIMING_SCOPED("Benchmark. GUID Lookups");
+
+			// Entities are visited in a scattered order, so that lookups don't benefit from the insertion order
+			const size_t count = m_GUIDs.size();
+			size_t found = 0;
+			for (size_t i = 0; i < s_LookupsCount; ++i)
+			{
+				const GUID& guid = m_GUIDs[(i * 7919u) % count];
+				found += bool(m_Scene->GetEntityByGUID(guid));
+			}
+
+			if (found != s_LookupsCount)
+				ReportFailure("[Benchmark] Only {} of {} entities were found", found, s_LookupsCount);
+		}
+
+		uint32_t GetCount(uint32_t requestedCount) const override { return 100000u; }
+
+	private:
+		std::vector<GUID> m_GUIDs;
+		Scene* m_Scene = nullptr;
+		static constexpr size_t s_LookupsCount = 1000000;
+	};
+
+	// Half of the lights are point lights, the other half are spot lights. All of them cast shadows
+	class LightsGenerator : public SceneGenerator
+	{
+	public:
+		LightsGenerator() : SceneGenerator("lights") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+			CreateFloor(scene, count, s_Spacing);
+
+			const Ref<Material> material = CreateMaterial(glm::vec3(0.8f));
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				const glm::vec3 location = GetGridLocation(i, count, s_Spacing);
+				const glm::vec3 color = glm::vec3((i % 3) == 0, (i % 3) == 1, (i % 3) == 2) * 0.75f + 0.25f;
+
+				// A shadow caster next to every light
+				{
+					Entity caster = scene.CreateEntity("Shadow Caster");
+					caster.SetWorldLocation(location + glm::vec3(0.f, 0.f, s_Spacing * 0.5f));
+					auto& sm = caster.AddComponent<StaticMeshComponent>();
+					sm.SetStaticMesh(GetCubeMesh());
+					sm.SetMaterial(material);
+				}
+
+				Entity entity = scene.CreateEntity("Light");
+				if (i % 2)
+				{
+					entity.SetWorldTransform(Transform(location + glm::vec3(0.f, 3.f, 0.f), Rotator::FromEulerAngles(glm::radians(-90.f), 0.f, 0.f)));
+					auto& light = entity.AddComponent<SpotLightComponent>();
+					light.SetLightColor(color);
+					light.SetIntensity(10.f);
+					light.SetDistance(s_Spacing * 3.f);
+					light.SetCastsShadows(true);
+				}
+				else
+				{
+					entity.SetWorldLocation(location + glm::vec3(0.f, 1.5f, 0.f));
+					auto& light = entity.AddComponent<PointLightComponent>();
+					light.SetLightColor(color);
+					light.SetIntensity(10.f);
+					light.SetRadius(s_Spacing * 2.f);
+					light.SetCastsShadows(true);
+				}
+			}
+		}
+
+	private:
+		static constexpr float s_Spacing = 4.f;
+	};
+
+	class RigidBodiesGenerator : public SceneGenerator
+	{
+	public:
+		RigidBodiesGenerator() : SceneGenerator("rigid_bodies") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+			CreateFloor(scene, count, s_Spacing, true);
+
+			const Ref<Material> material = CreateMaterial({ 0.3f, 0.5f, 0.9f });
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				// Bodies are dropped in layers, so that they collide with each other
+				glm::vec3 location = GetGridLocation(i, count, s_Spacing);
+				location.y = 2.f + float(i % 4) * 1.5f;
+
+				Entity entity = scene.CreateEntity("Rigid Body");
+				entity.SetWorldTransform(Transform(location, Rotator::FromEulerAngles(float(i) * 0.1f, 0.f, float(i) * 0.2f)));
+
+				auto& sm = entity.AddComponent<StaticMeshComponent>();
+				sm.SetStaticMesh(GetCubeMesh());
+				sm.SetMaterial(material);
+
+				// Body type needs to be set before a collider is added since that's when the physics actor is created
+				auto& rb = entity.AddComponent<RigidBodyComponent>();
+				rb.BodyType = RigidBodyComponent::Type::Dynamic;
+				entity.AddComponent<BoxColliderComponent>();
+				rb.SetMass(1.f);
+				rb.SetEnableGravity(true);
+			}
+		}
+
+	private:
+		static constexpr float s_Spacing = 1.25f;
+	};
+
+	// 10k falling bodies. Every frame, the oldest 1k of them are destroyed and 1k new ones are spawned above the floor from a prefab
+	// (see `Scene. Destroy Pending Entities` and `Scene. Spawn Batch` CPU timings)
+	class ProjectilesGenerator : public SceneGenerator
+	{
+	public:
+		ProjectilesGenerator() : SceneGenerator("projectiles") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+			CreateFloor(scene, count, s_Spacing, true);
+
+			m_Scene = &scene;
+			m_Count = count;
+			m_Spawned = 0;
+			m_Projectiles.clear();
+
+			// The prefab is made from the first projectile, which is never destroyed
+			Entity source = scene.CreateEntity("Projectile");
+			source.SetWorldLocation(GetNextLocation());
+
+			auto& sm = source.AddComponent<StaticMeshComponent>();
+			sm.SetStaticMesh(GetCubeMesh());
+			sm.SetMaterial(CreateMaterial({ 0.9f, 0.3f, 0.1f }));
+
+			auto& rb = source.AddComponent<RigidBodyComponent>();
+			rb.BodyType = RigidBodyComponent::Type::Dynamic;
+			source.AddComponent<BoxColliderComponent>();
+			rb.SetEnableGravity(true);
+
+			m_Prefab = Prefab::Create(source);
+			Spawn(count - 1);
+		}
+
+		void OnUpdate(float time) override
+		{
+			const uint32_t batch = glm::min(s_BatchSize, uint32_t(m_Projectiles.size()));
+			m_Scene->DestroyEntities(std::vector<Entity>(m_Projectiles.begin(), m_Projectiles.begin() + batch));
+			m_Projectiles.erase(m_Projectiles.begin(), m_Projectiles.begin() + batch);
+			Spawn(batch);
+		}
+
+		uint32_t GetCount(uint32_t requestedCount) const override { return 10000u; }
+
+	private:
+		void Spawn(uint32_t count)
+		{
+			std::vector<Transform> transforms(count);
+			for (Transform& transform : transforms)
+				transform.Location = GetNextLocation();
+
+			const std::vector<Entity> spawned = m_Scene->SpawnBatch(*m_Prefab, transforms);
+			m_Projectiles.insert(m_Projectiles.end(), spawned.begin(), spawned.end());
+		}
+
+		glm::vec3 GetNextLocation()
+		{
+			const uint32_t index = m_Spawned++;
+			glm::vec3 location = GetGridLocation(index % m_Count, m_Count, s_Spacing);
+			location.y = 3.f + float(index % 4) * 1.5f;
+			return location;
+		}
+
+	private:
+		std::vector<Entity> m_Projectiles; // Oldest first
+		Ref<Prefab> m_Prefab;
+		Scene* m_Scene = nullptr;
+		uint32_t m_Count = 0;
+		uint32_t m_Spawned = 0;
+		static constexpr uint32_t s_BatchSize = 1000u;
+		static constexpr float s_Spacing = 1.25f;
+	};
+
+	// Flies the camera over a 10x10km world that's split into 250m streaming cells. Each cell has lights and static colliders.
+	// Cells are written into a temporary folder when the scenario starts. Only cells around the camera should be resident,
+	// which is checked every frame by counting entities and by bounding the growth of the process memory
+	// (see `World Partition. Update` and `World Partition. Create Cell` CPU timings)
+	class WorldStreamingGenerator : public SceneGenerator
+	{
+	public:
+		WorldStreamingGenerator() : SceneGenerator("world_streaming") {}
+
+		~WorldStreamingGenerator() override
+		{
+			if (m_Partition)
+				EG_CORE_INFO("[Benchmark] Peak resident entities: {} of {}", m_PeakResidentEntities, GetCount(0));
+
+			std::error_code error;
+			std::filesystem::remove_all(GetCellsFolder(), error);
+		}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			const Ref<Scene>& currentScene = Scene::GetCurrentScene();
+			EG_CORE_ASSERT(currentScene.get() == &scene, "Streamed scene is expected to be the current one");
+
+			CreateCameraAndSun(scene, 1u, s_CellSize);
+			m_Camera = scene.GetPrimaryCameraEntity();
+			m_Camera.SetWorldRotation(Rotator::FromEulerAngles(glm::radians(-20.f), 0.f, 0.f));
+			m_FixedEntitiesCount = scene.GetAliveEntitiesCount();
+
+			WriteCells(scene);
+
+			WorldPartitionSettings settings;
+			settings.CellSize = s_CellSize;
+			settings.LoadDistance = s_CellSize * 2.f;
+			settings.UnloadDistance = s_CellSize * 3.f;
+			m_Partition = MakeScope<WorldPartition>(currentScene, GetCellsFolder(), settings);
+
+			// Cells within the unload distance of a location, plus a row and a column of cells that were unloaded this frame but not yet destroyed
+			const uint32_t maxResidentCells = uint32_t(glm::pow(2.f * glm::ceil(settings.UnloadDistance / s_CellSize) + 2.f, 2.f));
+			m_MaxResidentEntities = m_FixedEntitiesCount + maxResidentCells * s_EntitiesPerCell;
+			m_PeakResidentEntities = 0;
+			m_BaseProcessMemory = 0;
+		}
+
+		// The camera flies along the rows of cells, so that it goes through the whole world
+		void OnUpdate(float time) override
+		{
+			const float distance = time * s_CameraSpeed;
+			const float row = glm::floor(distance / s_WorldSize);
+			const float along = distance - row * s_WorldSize;
+			const bool bForward = uint32_t(row) % 2u == 0u;
+			const float z = glm::mod(row * s_CellSize + s_CellSize * 0.5f, s_WorldSize);
+
+			const glm::vec3 location(bForward ? along : s_WorldSize - along, 50.f, z);
+			m_Camera.SetWorldLocation(location);
+			m_Partition->Update(location);
+
+			// Entities of unloaded cells are destroyed when the scene is updated, so the previous frame is checked
+			const size_t resident = m_Camera.GetScene()->GetAliveEntitiesCount();
+			if (time > 0.f)
+			{
+				m_PeakResidentEntities = glm::max(m_PeakResidentEntities, resident);
+				if (resident > m_MaxResidentEntities)
+					ReportFailure("[Benchmark] {} entities are resident, at most {} are expected", resident, m_MaxResidentEntities);
+
+				// Cells that stay alive after being unloaded (entities, components, physics actors, renderer data) grow the memory over the run,
+				// while streaming the same amount of cells in and out should keep it flat
+				const uint64_t processMemory = Utils::GetProcessMemory().Current;
+				if (m_BaseProcessMemory == 0)
+					m_BaseProcessMemory = processMemory;
+				else if (processMemory > m_BaseProcessMemory + s_MaxProcessMemoryGrowth)
+					ReportFailure("[Benchmark] Process memory has grown by {:.1f}MB since the first frame, at most {}MB is expected",
+						double(processMemory - m_BaseProcessMemory) / (1024.0 * 1024.0), s_MaxProcessMemoryGrowth / (1024u * 1024u));
+			}
+		}
+
+		uint32_t GetCount(uint32_t requestedCount) const override { return s_CellsPerSide * s_CellsPerSide * s_EntitiesPerCell; }
+
+	private:
+		// Cells are filled in a temporary scene that shares the renderer, so that the whole world is never resident in the streamed one
+		void WriteCells(Scene& scene)
+		{
+			Ref<Scene> cellsScene = MakeRef<Scene>("World Streaming Cells", scene.GetSceneRenderer());
+			std::vector<Entity> entities;
+			entities.reserve(GetCount(0));
+
+			for (uint32_t z = 0; z < s_CellsPerSide; ++z)
+			{
+				for (uint32_t x = 0; x < s_CellsPerSide; ++x)
+				{
+					const glm::vec3 cellMin = glm::vec3(float(x), 0.f, float(z)) * s_CellSize;
+					for (uint32_t i = 0; i < s_EntitiesPerCell / 2u; ++i)
+					{
+						const glm::vec3 offset = glm::vec3(float(i % 2u) + 0.5f, 0.f, float(i / 2u) + 0.5f) * (s_CellSize * 0.5f);
+
+						Entity light = cellsScene->CreateEntity("Light");
+						light.SetWorldLocation(cellMin + offset + glm::vec3(0.f, 5.f, 0.f));
+						auto& lightComponent = light.AddComponent<PointLightComponent>();
+						lightComponent.SetIntensity(10.f);
+						lightComponent.SetRadius(20.f);
+						entities.push_back(light);
+
+						Entity body = cellsScene->CreateEntity("Static Body");
+						body.SetWorldTransform(Transform(cellMin + offset, Rotator(), glm::vec3(4.f)));
+						body.AddComponent<RigidBodyComponent>().BodyType = RigidBodyComponent::Type::Static;
+						body.AddComponent<BoxColliderComponent>();
+						entities.push_back(body);
+					}
+				}
+			}
+
+			if (!WorldPartition::WriteCells(cellsScene, entities, GetCellsFolder(), s_CellSize))
+				ReportFailure("[Benchmark] Failed to write world streaming cells");
+		}
+
+		static Path GetCellsFolder() { return std::filesystem::temp_directory_path() / "EagleBenchmark" / "world_streaming"; }
+
+	private:
+		Scope<WorldPartition> m_Partition;
+		Entity m_Camera;
+		size_t m_FixedEntitiesCount = 0;
+		size_t m_MaxResidentEntities = 0;
+		size_t m_PeakResidentEntities = 0;
+		uint64_t m_BaseProcessMemory = 0; // Measured during the first updated frame. Zero if it isn't supported by the platform
+
+		static constexpr uint32_t s_CellsPerSide = 40u;
+		static constexpr uint32_t s_EntitiesPerCell = 8u; // Half are lights, half are static bodies
+		static constexpr float s_CellSize = 250.f;
+		static constexpr float s_WorldSize = s_CellSize * float(s_CellsPerSide); // 10km
+		static constexpr float s_CameraSpeed = 1000.f; // Meters per second, so that many cells are crossed during a run
+		static constexpr uint64_t s_MaxProcessMemoryGrowth = 64ull * 1024ull * 1024ull; // Leaves room for allocators and GPU staging buffers to grow
+	};
+
+	// Half of the entities are sprites, the other half are 3D texts
+	class SpritesTextsGenerator : public SceneGenerator
+	{
+	public:
+		SpritesTextsGenerator() : SceneGenerator("sprites_texts") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+
+			Ref<Font> font;
+			if (FontLibrary::Get(s_BenchmarkFontPath, &font) == false)
+				font = Font::Create(s_BenchmarkFontPath);
+
+			const Ref<Material> material = CreateMaterial({ 0.9f, 0.3f, 0.6f });
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				Entity entity = scene.CreateEntity(i % 2 ? "Text" : "Sprite");
+				entity.SetWorldLocation(GetGridLocation(i, count, s_Spacing) + glm::vec3(0.f, 0.5f, 0.f));
+				if (i % 2)
+				{
+					auto& text = entity.AddComponent<TextComponent>();
+					text.SetFont(font);
+					text.SetText("Text #" + std::to_string(i));
+				}
+				else
+				{
+					auto& sprite = entity.AddComponent<SpriteComponent>();
+					sprite.SetMaterial(material);
+				}
+			}
+		}
+
+	private:
+		static constexpr float s_Spacing = 2.f;
+	};
+
+	// Requires `Sandbox.dll` with `BenchmarkSpinner` script. If it's missing, entities are created but scripts are not run
+	class ScriptsGenerator : public SceneGenerator
+	{
+	public:
+		ScriptsGenerator() : SceneGenerator("scripts") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			if (!ScriptEngine::ModuleExists(s_BenchmarkScriptModule))
+				EG_CORE_WARN("[Benchmark] Script module '{}' wasn't found. Scripts won't be executed", s_BenchmarkScriptModule);
+
+			CreateCameraAndSun(scene, count, s_Spacing);
+			CreateFloor(scene, count, s_Spacing);
+
+			const Ref<Material> material = CreateMaterial({ 0.4f, 0.9f, 0.4f });
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				Entity entity = scene.CreateEntity("Script");
+				entity.SetWorldLocation(GetGridLocation(i, count, s_Spacing));
+
+				auto& sm = entity.AddComponent<StaticMeshComponent>();
+				sm.SetStaticMesh(GetCubeMesh());
+				sm.SetMaterial(material);
+
+				entity.AddComponent<ScriptComponent>(s_BenchmarkScriptModule);
+			}
+		}
+
+	private:
+		static constexpr float s_Spacing = 2.f;
+	};
+
+	// Every frame, an editor scene is copied into a runtime one and played, like when the Play button is pressed in the editor.
+	// A quarter of the entities are dynamic bodies with colliders, a quarter are kinematic bodies without them
+	// (see `Scene. Copy` and `Scene. Runtime Start` CPU timings)
+	class PlayModeCopyGenerator : public SceneGenerator
+	{
+	public:
+		PlayModeCopyGenerator() : SceneGenerator("play_mode_copy") {}
+
+		void Generate(Scene& scene, uint32_t count) override
+		{
+			CreateCameraAndSun(scene, count, s_Spacing);
+
+			// The editor scene is never rendered, it shares the renderer so that no GPU resources are allocated for it
+			m_EditorScene = MakeRef<Scene>("Play Mode Copy Source", scene.GetSceneRenderer());
+			const Ref<Material> material = CreateMaterial({ 0.6f, 0.6f, 0.9f });
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				Entity entity = m_EditorScene->CreateEntity("Entity");
+				entity.SetWorldLocation(GetGridLocation(i, count, s_Spacing));
+
+				auto& sm = entity.AddComponent<StaticMeshComponent>();
+				sm.SetStaticMesh(GetCubeMesh());
+				sm.SetMaterial(material);
+
+				if (i % 4 == 1)
+				{
+					entity.AddComponent<RigidBodyComponent>().BodyType = RigidBodyComponent::Type::Dynamic;
+					entity.AddComponent<BoxColliderComponent>();
+				}
+				else if (i % 4 == 2)
+				{
+					auto& rb = entity.AddComponent<RigidBodyComponent>();
+					rb.BodyType = RigidBodyComponent::Type::Dynamic;
+					rb.SetIsKinematic(true);
+				}
+				else if (i % 4 == 3)
+				{
+					auto& light = entity.AddComponent<PointLightComponent>();
+					light.SetIntensity(10.f);
+					light.SetRadius(s_Spacing * 2.f);
+				}
+			}
+		}
+
+		void OnUpdate(float time) override
+		{
+			EG_CPU_TIMING_SCOPED("Benchmark. Play Mode Copy");
+
+			Ref<Scene> runtimeScene = MakeRef<Scene>(m_EditorScene, "Play Mode Copy");
+			runtimeScene->OnRuntimeStart();
+
+			const size_t expected = m_EditorScene->GetAliveEntitiesCount();
+			const size_t copied = runtimeScene->GetAliveEntitiesCount();
+			if (copied != expected)
+				ReportFailure("[Benchmark] {} of {} entities were copied", copied, expected);
+
+			// Resets the physics scene of the editor scene, so that actors don't pile up over frames
+			runtimeScene->OnRuntimeStop();
+		}
+
+	private:
+		Ref<Scene> m_EditorScene;
+		static constexpr float s_Spacing = 2.f;
+	};
+
+	// `static_meshes` scene with GTAO enabled. Used to compare temporal GTAO against the full-rate one
+	class GTAOGenerator : public StaticMeshesGenerator
+	{
+	public:
+		GTAOGenerator(bool bTemporal) : StaticMeshesGenerator(bTemporal ? "gtao_temporal" : "gtao_full"), m_bTemporal(bTemporal) {}
+
+		void ConfigureRenderer(SceneRendererSettings& settings) const override
+		{
+			settings.AO = AmbientOcclusion::GTAO;
+			settings.GTAOSettings.SetTemporal(m_bTemporal);
+		}
+
+	private:
+		bool m_bTemporal = false;
+	};
+
+	Scope<SceneGenerator> SceneGenerator::Create(std::string_view name)
+	{
+		if (name == "static_meshes")
+			return MakeScope<StaticMeshesGenerator>();
+		if (name == "dynamic_meshes")
+			return MakeScope<DynamicMeshesGenerator>();
+		if (name == "moving_meshes_50k")
+			return MakeScope<MovingMeshes50kGenerator>();
+		if (name == "guid_lookups")
+			return MakeScope<GUIDLookupsGenerator>();
+		if (name == "lights")
+			return MakeScope<LightsGenerator>();
+		if (name == "rigid_bodies")
+			return MakeScope<RigidBodiesGenerator>();
+		if (name == "projectiles")
+			return MakeScope<ProjectilesGenerator>();
+		if (name == "world_streaming")
+			return MakeScope<WorldStreamingGenerator>();
+		if (name == "sprites_texts")
+			return MakeScope<SpritesTextsGenerator>();
+		if (name == "scripts")
+			return MakeScope<ScriptsGenerator>();
+		if (name == "play_mode_copy")
+			return MakeScope<PlayModeCopyGenerator>();
+		if (name == "gtao_full")
+			return MakeScope<GTAOGenerator>(false);
+		if (name == "gtao_temporal")
+			return MakeScope<GTAOGenerator>(true);
+
+		return nullptr;
+	}
+
+	const std::vector<std::string_view>& SceneGenerator::GetScenarioNames()
+	{
+		static const std::vector<std::string_view> s_Names = {
+			"static_meshes", "dynamic_meshes", "moving_meshes_50k", "guid_lookups", "lights", "rigid_bodies", "projectiles", "world_streaming", "sprites_texts", "scripts", "play_mode_copy", "gtao_full", "gtao_temporal"
+		};
+		return s_Names;
+	}
+
+	const Ref<StaticMesh>& SceneGenerator::GetCubeMesh()
+	{
+		static Ref<StaticMesh> s_Cube;
+		if (s_Cube)
+			return s_Cube;
+
+		// 4 vertices per face so that every face has its own normal
+		struct Face { glm::vec3 Normal; glm::vec3 Tangent; };
+		constexpr Face faces[] = {
+			{ {  1.f,  0.f,  0.f }, {  0.f,  0.f, -1.f } },
+			{ { -1.f,  0.f,  0.f }, {  0.f,  0.f,  1.f } },
+			{ {  0.f,  1.f,  0.f }, {  1.f,  0.f,  0.f } },
+			{ {  0.f, -1.f,  0.f }, {  1.f,  0.f,  0.f } },
+			{ {  0.f,  0.f,  1.f }, {  1.f,  0.f,  0.f } },
+			{ {  0.f,  0.f, -1.f }, { -1.f,  0.f,  0.f } },
+		};
+		constexpr glm::vec2 uvs[] = { { 0.f, 0.f }, { 1.f, 0.f }, { 1.f, 1.f }, { 0.f, 1.f } };
+
+		std::vector<Vertex> vertices;
+		std::vector<Index> indices;
+		vertices.reserve(24);
+		indices.reserve(36);
+		for (const Face& face : faces)
+		{
+			const glm::vec3 bitangent = glm::cross(face.Normal, face.Tangent);
+			const Index first = Index(vertices.size());
+			for (const glm::vec2& uv : uvs)
+			{
+				Vertex& vertex = vertices.emplace_back();
+				vertex.Position = (face.Normal + face.Tangent * (uv.x * 2.f - 1.f) + bitangent * (uv.y * 2.f - 1.f)) * 0.5f;
+				vertex.Normal = face.Normal;
+				vertex.Tangent = face.Tangent;
+				vertex.TexCoords = uv;
+			}
+			for (Index index : { 0u, 1u, 2u, 2u, 3u, 0u })
+				indices.push_back(first + index);
+		}
+
+		s_Cube = StaticMesh::Create(vertices, indices);
+		return s_Cube;
+	}
+
+	Ref<Material> SceneGenerator::CreateMaterial(const glm::vec3& color)
+	{
+		Ref<Material> material = Material::Create();
+		material->SetTintColor(glm::vec4(color, 1.f));
+		return material;
+	}
+
+	void SceneGenerator::CreateCameraAndSun(Scene& scene, uint32_t count, float spacing)
+	{
+		const float extent = float(GetGridSide(count)) * spacing;
+
+		Entity camera = scene.CreateEntity("Benchmark Camera");
+		camera.SetWorldTransform(Transform(glm::vec3(0.f, extent * 0.5f, extent * 0.75f), Rotator::FromEulerAngles(glm::radians(-35.f), 0.f, 0.f)));
+		camera.AddComponent<CameraComponent>().SetPrimary(true);
+
+		Entity sun = scene.CreateEntity("Benchmark Sun");
+		sun.SetWorldRotation(Rotator::FromEulerAngles(glm::radians(-50.f), glm::radians(30.f), 0.f));
+		auto& light = sun.AddComponent<DirectionalLightComponent>();
+		light.SetIntensity(2.f);
+		light.SetCastsShadows(true);
+	}
+
+	Entity SceneGenerator::CreateFloor(Scene& scene, uint32_t count, float spacing, bool bWithCollision)
+	{
+		const float extent = float(GetGridSide(count) + 2u) * spacing;
+
+		Entity floor = scene.CreateEntity("Benchmark Floor");
+		floor.SetWorldTransform(Transform(glm::vec3(0.f, -0.75f, 0.f), Rotator(), glm::vec3(extent, 0.5f, extent)));
+
+		auto& sm = floor.AddComponent<StaticMeshComponent>();
+		sm.SetStaticMesh(GetCubeMesh());
+		sm.SetMaterial(CreateMaterial(glm::vec3(0.5f)));
+
+		if (bWithCollision)
+			floor.AddComponent<BoxColliderComponent>();
+
+		return floor;
+	}
+
+	glm::vec3 SceneGenerator::GetGridLocation(uint32_t index, uint32_t count, float spacing)
+	{
+		const uint32_t side = GetGridSide(count);
+		const float offset = float(side - 1u) * spacing * 0.5f;
+		return glm::vec3(float(index % side) * spacing - offset, 0.f, float(index / side) * spacing - offset);
+	}
+}
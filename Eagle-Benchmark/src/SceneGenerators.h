@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Eagle.h"
+
+namespace Eagle
+{
+	class StaticMesh;
+	class Material;
+	struct SceneRendererSettings;
+
+	// Procedurally fills a scene with `count` objects of a certain kind.
+	// Objects are placed on a grid, so the same arguments always produce the same scene
+	class SceneGenerator
+	{
+	public:
+		virtual ~SceneGenerator() = default;
+
+		virtual void Generate(Scene& scene, uint32_t count) = 0;
+
+		// Called every frame before the scene is updated. `time` - simulated seconds since the scenario has started
+		virtual void OnUpdate(float time) {}
+
+		virtual void ConfigureRenderer(SceneRendererSettings& settings) const {}
+
+		// Some scenarios are measured with a fixed amount of objects, regardless of `--count`
+		virtual uint32_t GetCount(uint32_t requestedCount) const { return requestedCount; }
+
+		std::string_view GetName() const { return m_Name; }
+
+		// True if a check of the scenario has failed. Failed scenarios make the benchmark exit with a non-zero code
+		bool HasFailed() const { return m_bFailed; }
+
+		// Returns nullptr if there's no scenario with that name
+		static Scope<SceneGenerator> Create(std::string_view name);
+		static const std::vector<std::string_view>& GetScenarioNames();
+
+	protected:
+		SceneGenerator(std::string_view name) : m_Name(name) {}
+
+		static const Ref<StaticMesh>& GetCubeMesh();
+		static Ref<Material> CreateMaterial(const glm::vec3& color);
+
+		// Places a camera that looks at the grid of `count` objects and a directional light
+		static void CreateCameraAndSun(Scene& scene, uint32_t count, float spacing);
+		static Entity CreateFloor(Scene& scene, uint32_t count, float spacing, bool bWithCollision = false);
+		static glm::vec3 GetGridLocation(uint32_t index, uint32_t count, float spacing);
+
+		// Logs an error and marks the scenario as failed
+		template<typename... Args>
+		void ReportFailure(Args&&... args)
+		{
+			EG_CORE_ERROR(std::forward<Args>(args)...);
+			m_bFailed = true;
+		}
+
+	private:
+		std::string_view m_Name;
+		bool m_bFailed = false;
+	};
+}
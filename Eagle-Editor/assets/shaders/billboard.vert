@@ -1,15 +1,12 @@
-layout(location = 0) in vec3 a_ModelViewPos;
-layout(location = 1) in vec3 a_PrevModelViewPos;
-layout(location = 2) in uint a_TextureIndex;
-layout(location = 3) in int  a_EntityID;
+layout(location = 0) in vec2 a_QuadCorner;
 
-layout(push_constant) uniform PushConstants
-{
-    mat4 g_Proj;
-#ifdef EG_MOTION
-    mat4 g_PrevProj;
-#endif
-};
+// Per-instance
+layout(location = 1) in vec3 a_WorldPos;
+layout(location = 2) in vec2 a_Scale;
+layout(location = 3) in vec3 a_PrevWorldPos;
+layout(location = 4) in vec2 a_PrevScale;
+layout(location = 5) in uint a_TextureIndex;
+layout(location = 6) in int  a_EntityID;
 
 #ifdef EG_JITTER
 layout(set = 1, binding = 0) uniform Jitter
@@ -18,6 +15,14 @@ layout(set = 1, binding = 0) uniform Jitter
 };
 #endif
 
+layout(set = 1, binding = 1) uniform CameraData
+{
+    mat4 g_View;
+    mat4 g_Proj;
+    mat4 g_PrevView;
+    mat4 g_PrevProj;
+};
+
 layout(location = 0) out vec2 o_TexCoords;
 layout(location = 1) flat out uint o_TextureIndex;
 layout(location = 2) flat out int  o_EntityID;
@@ -26,20 +31,18 @@ layout(location = 3) out vec3 o_CurPos;
 layout(location = 4) out vec3 o_PrevPos;
 #endif
 
-const vec2 s_TexCoords[4] = {
-	vec2(0.f, 1.f),
-	vec2(1.f, 1.f),
-	vec2(1.f, 0.f),
-	vec2(0.f, 0.f)
-};
-
 void main()
 {
-    gl_Position = g_Proj * vec4(a_ModelViewPos, 1.0);
+    // Quad is centered and faces the camera
+    const vec2 localPos = vec2(a_QuadCorner.x - 0.5f, 0.5f - a_QuadCorner.y);
+    // Rotation is removed, only the position in view space and the scaling are used
+    const vec3 viewPos = (g_View * vec4(a_WorldPos, 1.f)).xyz;
+    gl_Position = g_Proj * vec4(viewPos + vec3(localPos * a_Scale, 0.f), 1.0);
 
 #ifdef EG_MOTION
     o_CurPos = gl_Position.xyw;
-    const vec4 prevPos = g_PrevProj * vec4(a_PrevModelViewPos, 1.0);
+    const vec3 prevViewPos = (g_PrevView * vec4(a_PrevWorldPos, 1.f)).xyz;
+    const vec4 prevPos = g_PrevProj * vec4(prevViewPos + vec3(localPos * a_PrevScale, 0.f), 1.0);
     o_PrevPos = prevPos.xyw;
 #endif
 
@@ -47,8 +50,7 @@ void main()
     gl_Position.xy += g_Jitter * gl_Position.w;
 #endif
 
-    const uint vertexID = gl_VertexIndex % 4u;
-    o_TexCoords = s_TexCoords[vertexID];
+    o_TexCoords = a_QuadCorner;
     o_TextureIndex  = a_TextureIndex;
     o_EntityID = a_EntityID;
 }
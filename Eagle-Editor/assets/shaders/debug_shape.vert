@@ -0,0 +1,32 @@
+layout(location = 0) in vec3 a_Position;
+
+// Per-instance
+layout(location = 1) in vec4 a_TransformRow0;
+layout(location = 2) in vec4 a_TransformRow1;
+layout(location = 3) in vec4 a_TransformRow2;
+layout(location = 4) in vec3 a_Color;
+
+layout(push_constant) uniform PushConstants
+{
+    mat4 g_ViewProj;
+};
+
+#ifdef EG_JITTER
+layout(set = 0, binding = 0) uniform Jitter
+{
+    vec2 g_Jitter;
+};
+#endif
+
+layout(location = 0) out vec3 o_Color;
+
+void main()
+{
+    const vec3 worldPos = vec4(a_Position, 1.f) * mat3x4(a_TransformRow0, a_TransformRow1, a_TransformRow2);
+    gl_Position = g_ViewProj * vec4(worldPos, 1.0);
+#ifdef EG_JITTER
+    gl_Position.xy += g_Jitter * gl_Position.w;
+#endif
+
+    o_Color = a_Color;
+}
@@ -44,6 +44,11 @@
 #define EG_SM_DISTRIBUTION_FILTER_SIZE 8
 #define EG_SM_DISTRIBUTION_RANDOM_RADIUS 2.f
 
+#define EG_FROXEL_TILE_SIZE 16 // In pixels
+#define EG_FROXEL_SLICES 64
+#define EG_FROXEL_NEAR 0.1f
+#define EG_FROXEL_NO_SHADOW 0xFFFFFFFFu
+
 #define EG_POINT_LIGHT_NEAR 0.01f
 #define EG_POINT_LIGHT_FAR  50.f // TODO: Make it customizable
 
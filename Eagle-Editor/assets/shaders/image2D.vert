@@ -1,8 +1,13 @@
-layout(location = 0) in vec3  a_Tint;
-layout(location = 1) in uint  a_TextureIndex;
-layout(location = 2) in vec2  a_Position;
-layout(location = 3) in int   a_EntityID;
-layout(location = 4) in float a_Opacity;
+layout(location = 0) in vec2  a_QuadCorner;
+
+// Per-instance
+layout(location = 1) in vec2  a_Position;
+layout(location = 2) in vec2  a_AxisX;
+layout(location = 3) in vec2  a_AxisY;
+layout(location = 4) in vec3  a_Tint;
+layout(location = 5) in uint  a_TextureIndex;
+layout(location = 6) in int   a_EntityID;
+layout(location = 7) in float a_Opacity;
 
 layout(location = 0) out vec4 o_Tint_Opacity;
 layout(location = 1) out vec2 o_TexCoords;
@@ -11,19 +16,12 @@ layout(location = 2) flat out uint o_TextureIndex;
 layout(location = 3) flat out int o_EntityID;
 #endif
 
-const vec2 s_TexCoords[4] = {
-    vec2(0.f, 1.f),
-    vec2(1.f, 1.f),
-    vec2(1.f, 0.f),
-    vec2(0.f, 0.f)
-};
-
 void main()
 {
-    gl_Position = vec4(a_Position, 0.f, 1.0);
+    const vec2 position = a_Position + a_AxisX * a_QuadCorner.x + a_AxisY * a_QuadCorner.y;
+    gl_Position = vec4(position, 0.f, 1.0);
     
-    const uint vertexID = gl_VertexIndex % 4u;
-    o_TexCoords = s_TexCoords[vertexID];
+    o_TexCoords = a_QuadCorner;
     o_Tint_Opacity = vec4(a_Tint, a_Opacity);
     o_TextureIndex = a_TextureIndex;
 #ifndef EG_NO_OBJECT_ID
@@ -47,7 +47,7 @@ void main()
 #endif
 
 #ifdef EG_MATERIALS_REQUIRED
-    o_TexCoords = a_TexCoords;
+    o_TexCoords = GetSpriteTexCoords();
     o_MaterialIndex = a_MaterialIndex;
 #endif
 }
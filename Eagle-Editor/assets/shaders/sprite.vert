@@ -69,7 +69,7 @@ void main()
         o_TBN = mat3(worldTangent, worldBitangent, worldNormal);
     }
 
-    o_TexCoords = a_TexCoords * material.TilingFactor;
+    o_TexCoords = GetSpriteTexCoords() * material.TilingFactor;
     o_MaterialIndex  = materialIndex;
     o_EntityID = a_EntityID;
 
@@ -1,7 +1,11 @@
-layout(location = 0) in vec2 a_TexCoords;
-layout(location = 1) in uint a_TransformIndex;
-layout(location = 2) in uint a_MaterialIndex;
-layout(location = 3) in int  a_EntityID;
+// Per-vertex. Corner of the unit quad, `RenderManager::GetUnitQuadVertexBuffer()`
+layout(location = 0) in vec2 a_QuadCoords;
+
+// Per-instance
+layout(location = 1) in vec4 a_UVBounds; // Min UV, max UV
+layout(location = 2) in uint a_TransformIndex;
+layout(location = 3) in uint a_MaterialIndex;
+layout(location = 4) in int  a_EntityID;
 
 const vec3 s_Normal = vec3(0.0f, 0.0f, 1.0f);
 
@@ -38,3 +42,8 @@ const vec3 s_Bitangent = vec3(
 	f * (-DeltaUV2.x * Edge1.y + DeltaUV1.x * Edge2.y),
 	f * (-DeltaUV2.x * Edge1.z + DeltaUV1.x * Edge2.z)
 );
+
+vec2 GetSpriteTexCoords()
+{
+	return mix(a_UVBounds.xy, a_UVBounds.zw, a_QuadCoords);
+}
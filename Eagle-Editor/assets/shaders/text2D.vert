@@ -1,9 +1,14 @@
-layout(location = 0) in vec3  a_Color;
-layout(location = 1) in uint  a_AtlasIndex;
-layout(location = 2) in vec2  a_Position;
-layout(location = 3) in vec2  a_TexCoords;
-layout(location = 4) in int   a_EntityID;
-layout(location = 5) in float a_Opacity;
+layout(location = 0) in vec2  a_QuadCorner;
+
+// Per-instance
+layout(location = 1) in vec2  a_Origin;
+layout(location = 2) in vec2  a_EdgeX;
+layout(location = 3) in vec2  a_EdgeY;
+layout(location = 4) in vec4  a_AtlasBounds; // Left, bottom, right, top
+layout(location = 5) in vec3  a_Color;
+layout(location = 6) in uint  a_AtlasIndex;
+layout(location = 7) in int   a_EntityID;
+layout(location = 8) in float a_Opacity;
 
 layout(location = 0) out vec3 o_Color;
 layout(location = 1) out vec2 o_TexCoords;
@@ -15,9 +20,13 @@ layout(location = 4) flat out int o_EntityID;
 
 void main()
 {
-    gl_Position = vec4(a_Position, 0.f, 1.0);
+    // Unit quad corners go as (0, 1), (1, 1), (1, 0), (0, 0).
+    // Glyph corners need to go as (left, bottom), (left, top), (right, top), (right, bottom) to keep the winding
+    const vec2 glyphCorner = vec2(1.f - a_QuadCorner.y, a_QuadCorner.x);
+    const vec2 position = a_Origin + a_EdgeX * glyphCorner.x + a_EdgeY * glyphCorner.y;
+    gl_Position = vec4(position, 0.f, 1.0);
 
-    o_TexCoords = a_TexCoords;
+    o_TexCoords = mix(a_AtlasBounds.xy, a_AtlasBounds.zw, glyphCorner);
     o_Color = a_Color;
     o_AtlasIndex = a_AtlasIndex;
     o_Opacity = a_Opacity;
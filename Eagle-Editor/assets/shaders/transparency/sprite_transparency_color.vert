@@ -48,6 +48,6 @@ void main()
         o_TBN = mat3(worldTangent, worldBitangent, worldNormal);
     }
 
-    o_TexCoords = a_TexCoords;
+    o_TexCoords = GetSpriteTexCoords();
     o_MaterialIndex  = materialIndex;
 }
@@ -0,0 +1,44 @@
+#ifndef EG_VOLUMETRIC_FROXEL_UTILS
+#define EG_VOLUMETRIC_FROXEL_UTILS
+
+#include "defines.h"
+
+// Froxels are distributed exponentially along the view ray.
+// `w` is in [0; 1] range, distance is a distance from the camera
+float FroxelSliceToDistance(float w, float maxDistance)
+{
+	return EG_FROXEL_NEAR * pow(maxDistance / EG_FROXEL_NEAR, w);
+}
+
+float FroxelDistanceToSlice(float dist, float maxDistance)
+{
+	return log(max(dist, EG_FROXEL_NEAR) / EG_FROXEL_NEAR) / log(maxDistance / EG_FROXEL_NEAR);
+}
+
+// Shared by all froxel passes. Matches `VolumetricLightTask::FroxelData`
+struct FroxelData
+{
+	mat4 ViewProjInv;
+	mat4 PrevViewProj;
+
+	vec3 CameraPos;
+	float MaxDistance;
+
+	vec3 PrevCameraPos;
+	float Time;
+
+	uvec3 GridSize;
+	float MaxShadowDistance2;
+
+	float RenderScale;
+	float PrevRenderScale;
+	float JitterZ; // [-0.5; 0.5] of a slice
+	uint bHistoryValid;
+
+	uint PointLightsCount; // Culled
+	uint SpotLightsCount; // Culled
+	uint bHasDirLight;
+	uint unused;
+};
+
+#endif
@@ -11,7 +11,7 @@ namespace Eagle
 		PushLayer(MakeRef<EditorLayer>());
 	}
 
-	Application* CreateApplication()
+	Application* CreateApplication(ApplicationCommandLineArgs args)
 	{
 		return new EagleEditor();
 	}
@@ -4,6 +4,7 @@
 #include "Eagle/Utils/PlatformUtils.h"
 #include "Eagle/Script/ScriptEngine.h"
 #include "Eagle/Debug/CPUTimings.h"
+#include "Eagle/Debug/FrameHistory.h"
 
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
@@ -130,6 +131,93 @@ namespace Eagle
 		}
 	};
 
+	// Plots how the timings of the last recorded frame have changed over the history.
+	// `getTimings` returns a pointer to the timings of a frame and their count
+	template<typename Func>
+	static void DisplayTimingTrends(const std::deque<FrameHistory::Frame>& frames, const char* label, Func&& getTimings)
+	{
+		if (frames.empty())
+			return;
+
+		ImGui::PushID(label);
+		ImGui::TextUnformatted(label);
+		const auto [lastTimings, lastCount] = getTimings(frames.back());
+		std::vector<float> values;
+		values.reserve(frames.size());
+		for (uint32_t i = 0; i < lastCount; ++i)
+		{
+			const std::string_view name = lastTimings[i].Name;
+			float maxValue = 0.f;
+			values.clear();
+			for (const auto& frame : frames)
+			{
+				const auto [timings, count] = getTimings(frame);
+				const auto it = std::find_if(timings, timings + count, [name](const auto& timing) { return timing.Name == name; });
+				const float value = it != timings + count ? it->Timing : 0.f;
+				maxValue = glm::max(maxValue, value);
+				values.push_back(value);
+			}
+
+			const std::string overlay = std::string(name) + ": " + std::to_string(values.back()) + " ms; Max: " + std::to_string(maxValue) + " ms";
+			ImGui::PushID(int(i));
+			ImGui::PlotLines("##Trend", values.data(), int(values.size()), 0, overlay.c_str(), 0.f, maxValue, ImVec2(ImGui::GetContentRegionAvail().x, 40.f));
+			ImGui::PopID();
+		}
+		ImGui::PopID();
+	}
+
+	static void DisplayFrameSnapshot(const FrameHistory::Snapshot& snapshot, const std::string& label)
+	{
+		if (!ImGui::TreeNodeEx(label.c_str(), ImGuiTreeNodeFlags_SpanAvailWidth))
+			return;
+
+		UI::BeginPropertyGrid("FrameStats");
+		UI::Text("Draws", std::to_string(snapshot.RHIStats.Draws));
+		UI::Text("Dispatches", std::to_string(snapshot.RHIStats.Dispatches));
+		UI::Text("Render pass begins", std::to_string(snapshot.RHIStats.RenderPassBegins));
+		UI::Text("Pipeline binds", std::to_string(snapshot.RHIStats.PipelineBinds));
+		UI::Text("Barriers", std::to_string(snapshot.RHIStats.Barriers));
+		UI::Text("Staging allocations", std::to_string(snapshot.RHIStats.StagingAllocations));
+		UI::Text("Bytes written", std::to_string(snapshot.RHIStats.BytesWritten));
+		UI::Text("Descriptor writes", std::to_string(snapshot.RHIStats.DescriptorWrites));
+		UI::Text("Mesh draw calls", std::to_string(snapshot.RendererStats.DrawCalls));
+		UI::Text("2D draw calls", std::to_string(snapshot.RendererStats2D.DrawCalls));
+		ImGui::Separator();
+
+#ifdef EG_CPU_TIMINGS
+		for (auto& [threadID, timings] : snapshot.CPUTimings)
+		{
+			UI::Text(Application::Get().GetThreadName(threadID), "Time (ms)");
+			for (auto& timing : timings)
+				DisplayTiming(timing);
+			ImGui::Separator();
+		}
+#endif
+
+		UI::Text("GPU", "Time (ms)");
+		for (auto& timing : snapshot.GPUTimings)
+			DisplayTiming(timing);
+		UI::EndPropertyGrid();
+
+		ImGui::TreePop();
+	}
+
+	static void DisplayRHICounters(const RHICounters& counters)
+	{
+		ImGui::Text("Draws: %u", counters.Draws);
+		ImGui::Text("Dispatches: %u", counters.Dispatches);
+		ImGui::Text("Render Pass Begins: %u", counters.RenderPassBegins);
+		ImGui::Text("Pipeline Binds: %u", counters.PipelineBinds);
+		ImGui::Text("Descriptor Binds: %u", counters.DescriptorBinds);
+		ImGui::Text("Descriptor Writes: %u", counters.DescriptorWrites);
+		ImGui::Text("Descriptor Cache Hits: %u", counters.DescriptorCacheHits);
+		ImGui::Text("Vertex Buffer Binds: %u", counters.VertexBufferBinds);
+		ImGui::Text("Index Buffer Binds: %u", counters.IndexBufferBinds);
+		ImGui::Text("Barriers: %u", counters.Barriers);
+		ImGui::Text("Staging Allocations: %u", counters.StagingAllocations);
+		ImGui::Text("Bytes Written: %llu", (unsigned long long)counters.BytesWritten);
+	}
+
 	EditorLayer::EditorLayer()
 		: Layer("EditorLayer")
 		, m_SceneHierarchyPanel(*this)
@@ -415,9 +503,15 @@ namespace Eagle
 
 			if (mouseX >= 0 && mouseY >= 0 && mouseX < (int)viewportSize.x && mouseY < (int)viewportSize.y)
 			{
-				Ref<Image>& image = m_CurrentScene->GetSceneRenderer()->GetGBuffer().ObjectIDCopy;
+				const auto& sceneRenderer = m_CurrentScene->GetSceneRenderer();
+				Ref<Image>& image = sceneRenderer->GetGBuffer().ObjectIDCopy;
 				int data = -1;
 
+				// With dynamic resolution, the scene occupies only a part of the GBuffer
+				const float renderScale = sceneRenderer->GetRenderScale();
+				mouseX = int(mouseX * renderScale);
+				mouseY = int(mouseY * renderScale);
+
 				const ImageSubresourceLayout imageLayout = image->GetImageSubresourceLayout();
 				uint8_t* mapped = (uint8_t*)image->Map();
 				mapped += imageLayout.Offset;
@@ -549,6 +643,7 @@ namespace Eagle
 		options.FogSettings = settings.FogSettings;
 		options.ShadowsSettings = settings.ShadowsSettings;
 		options.VolumetricSettings = settings.VolumetricSettings;
+		options.DynamicResolution = settings.DynamicResolution;
 		options.bEnableSoftShadows = settings.bEnableSoftShadows;
 		options.bTranslucentShadows = settings.bTranslucentShadows;
 		options.bEnableCSMSmoothTransition = settings.bEnableCSMSmoothTransition;
@@ -560,6 +655,7 @@ namespace Eagle
 		options.TransparencyLayers = settings.TransparencyLayers;
 		options.AO = settings.AO;
 		options.AA = settings.AA;
+		options.Upscaling = settings.Upscaling;
 		options.Gamma = settings.Gamma;
 		options.Exposure = settings.Exposure;
 		options.Tonemapping = settings.Tonemapping;
@@ -642,6 +738,7 @@ namespace Eagle
 		static bool bShowGPUMemoryUsage = false;
 		static bool bShowGPUTimings = false;
 		static bool bShowCPUTimings = false;
+		static bool bShowFrameHistory = false;
 		auto& sceneRenderer = m_CurrentScene->GetSceneRenderer();
 		const GBuffer& gBuffers = sceneRenderer->GetGBuffer();
 
@@ -718,6 +815,7 @@ namespace Eagle
 #ifdef EG_CPU_TIMINGS
 				UI::Property("Show CPU timings", bShowCPUTimings);
 #endif
+				UI::Property("Show frame history", bShowFrameHistory, "Frame times of the last seconds and snapshots of frames that took too long (hitches)");
 #ifdef EG_GPU_TIMINGS
 				UI::Property("Show GPU timings", bShowGPUTimings);
 #endif
@@ -832,6 +930,81 @@ namespace Eagle
 		}
 #endif
 
+		// Full timings of every frame are only needed while they're displayed
+		FrameHistory::SetCaptureLastFrame(bShowFrameHistory);
+		if (bShowFrameHistory)
+		{
+			ImGui::Begin("Frame History", &bShowFrameHistory);
+
+			const auto& frames = FrameHistory::GetFrames();
+			std::vector<float> frameTimes;
+			frameTimes.reserve(frames.size());
+			float maxFrameTime = 0.f;
+			for (const auto& frame : frames)
+			{
+				frameTimes.push_back(frame.FrameTime);
+				maxFrameTime = glm::max(maxFrameTime, frame.FrameTime);
+			}
+
+			const std::string overlay = frames.empty() ? std::string() : "Last: " + std::to_string(frames.back().FrameTime) + " ms; Max: " + std::to_string(maxFrameTime) + " ms";
+			ImGui::PlotLines("##FrameTimes", frameTimes.data(), int(frameTimes.size()), 0, overlay.c_str(), 0.f, glm::max(maxFrameTime, FrameHistory::GetHitchThreshold()), ImVec2(ImGui::GetContentRegionAvail().x, 80.f));
+
+			if (ImGui::TreeNodeEx("Phases and passes", ImGuiTreeNodeFlags_SpanAvailWidth))
+			{
+#ifdef EG_CPU_TIMINGS
+				DisplayTimingTrends(frames, "CPU (main thread)", [](const FrameHistory::Frame& frame) { return std::make_pair(frame.CPUPhases.data(), frame.CPUPhasesCount); });
+#endif
+				DisplayTimingTrends(frames, "GPU", [](const FrameHistory::Frame& frame) { return std::make_pair(frame.GPUPasses.data(), frame.GPUPassesCount); });
+				ImGui::TreePop();
+			}
+
+			UI::BeginPropertyGrid("FrameHistory");
+			bool bEnabled = FrameHistory::IsEnabled();
+			if (UI::Property("Enabled", bEnabled))
+				FrameHistory::SetEnabled(bEnabled);
+
+			float historyDuration = FrameHistory::GetHistoryDuration();
+			if (UI::PropertyDrag("History (s)", historyDuration, 0.1f, 1.f, 60.f))
+				FrameHistory::SetHistoryDuration(historyDuration);
+
+			float hitchThreshold = FrameHistory::GetHitchThreshold();
+			if (UI::PropertyDrag("Hitch threshold (ms)", hitchThreshold, 0.5f, 1.f, 1000.f))
+				FrameHistory::SetHitchThreshold(hitchThreshold);
+
+			uint32_t maxHitches = FrameHistory::GetMaxHitches();
+			if (UI::PropertyDrag("Max hitches", maxHitches, 1.f, 1, 1024))
+				FrameHistory::SetMaxHitches(maxHitches);
+
+			if (UI::Button("Export hitches", "Export"))
+			{
+				const Path filepath = FileDialog::SaveFile(FileDialog::YAML_FILTER);
+				if (!filepath.empty())
+					FrameHistory::ExportHitches(filepath);
+			}
+			if (UI::Button("Clear hitches", "Clear"))
+				FrameHistory::ClearHitches();
+			UI::EndPropertyGrid();
+
+			ImGui::Separator();
+
+			const auto& lastFrame = FrameHistory::GetLastFrame();
+			ImGui::PushID("LastFrame");
+			DisplayFrameSnapshot(lastFrame, "Last frame (#" + std::to_string(lastFrame.Index) + "): " + std::to_string(lastFrame.FrameTime) + " ms");
+			ImGui::PopID();
+			ImGui::Separator();
+
+			const auto& hitches = FrameHistory::GetHitches();
+			for (auto it = hitches.rbegin(); it != hitches.rend(); ++it)
+			{
+				const auto& hitch = *it;
+				ImGui::PushID(int(hitch.Index));
+				DisplayFrameSnapshot(hitch, "Frame #" + std::to_string(hitch.Index) + ": " + std::to_string(hitch.FrameTime) + " ms");
+				ImGui::PopID();
+			}
+
+			ImGui::End();
+		}
+
 		if (bShowGPUMemoryUsage)
 		{
 			constexpr float toMBs = 1.f / (1024 * 1024);
@@ -1031,6 +1204,15 @@ namespace Eagle
 			EG_EDITOR_TRACE("Changed AA to: {}", magic_enum::enum_name(options.AA));
 		}
 
+		if (options.AA == AAMethod::TAA)
+		{
+			if (UI::ComboEnum<UpscalingMode>("Upscaling", options.Upscaling, "Renders the scene at a lower resolution and reconstructs it using TAA"))
+			{
+				bSettingsChanged = true;
+				EG_EDITOR_TRACE("Changed Upscaling to: {}", magic_enum::enum_name(options.Upscaling));
+			}
+		}
+
 		UI::EndPropertyGrid();
 
 		constexpr ImGuiTreeNodeFlags treeFlags = ImGuiTreeNodeFlags_Framed | ImGuiTreeNodeFlags_SpanAvailWidth
@@ -1200,6 +1382,7 @@ namespace Eagle
 				UI::BeginPropertyGrid("GTAO Settings");
 
 				GTAOSettings& settings = options.GTAOSettings;
+				bool bTemporal = settings.IsTemporal();
 				int samples = (int)settings.GetNumberOfSamples();
 				float radius = settings.GetRadius();
 
@@ -1215,6 +1398,12 @@ namespace Eagle
 					bSettingsChanged = true;
 					EG_EDITOR_TRACE("Changed GTAO Radius to: {}", settings.GetRadius());
 				}
+				if (UI::Property("Temporal", bTemporal, "Computes AO for a quarter of pixels per frame and accumulates the rest over time. Faster, but might ghost on fast movement"))
+				{
+					settings.SetTemporal(bTemporal);
+					bSettingsChanged = true;
+					EG_EDITOR_TRACE("Changed GTAO Temporal to: {}", settings.IsTemporal());
+				}
 
 				UI::EndPropertyGrid();
 				ImGui::TreePop();
@@ -1244,7 +1433,13 @@ namespace Eagle
 					EG_EDITOR_TRACE("Enabled Volumetric Fog: {}", settings.bFogEnable);
 				}
 
-				if (UI::PropertyDrag("Samples", settings.Samples, 1.f, 1, 0, "Use with caution! Making it to high might kill the performance. Especially if the light casts shadows"))
+				if (UI::ComboEnum<VolumetricLightsMethod>("Method", settings.Method, "Froxels - scattering is computed in a low-res 3D grid and accumulated over frames. Fast\nRay Marching - scattering is ray-marched per pixel. Precise but slow"))
+				{
+					bSettingsChanged = true;
+					EG_EDITOR_TRACE("Changed Volumetric Method to: {}", magic_enum::enum_name(settings.Method));
+				}
+
+				if (settings.Method == VolumetricLightsMethod::RayMarching && UI::PropertyDrag("Samples", settings.Samples, 1.f, 1, 0, "Use with caution! Making it to high might kill the performance. Especially if the light casts shadows"))
 				{
 					bSettingsChanged = true;
 					EG_EDITOR_TRACE("Changed Volumetric Samples to: {}", settings.Samples);
@@ -1265,6 +1460,45 @@ namespace Eagle
 			}
 		}
 
+		// Dynamic resolution settings
+		{
+			ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2{ 4, 4 });
+			ImGui::Separator();
+			bool treeOpened = ImGui::TreeNodeEx("Dynamic Resolution Settings", treeFlags);
+			ImGui::PopStyleVar();
+			if (treeOpened)
+			{
+				UI::BeginPropertyGrid("Dynamic Resolution Settings");
+
+				DynamicResolutionSettings& settings = options.DynamicResolution;
+				if (UI::Property("Enable", settings.bEnable, "Scales the resolution of the scene to keep GPU time close to the target. Requires TAA"))
+				{
+					bSettingsChanged = true;
+					EG_EDITOR_TRACE("Enabled Dynamic Resolution: {}", settings.bEnable);
+				}
+				if (UI::PropertyDrag("Target GPU Time (ms)", settings.TargetGPUTime, 0.1f, 0.1f, 1000.f))
+				{
+					bSettingsChanged = true;
+					EG_EDITOR_TRACE("Changed Dynamic Resolution Target GPU Time to: {}", settings.TargetGPUTime);
+				}
+				if (UI::PropertyDrag("Min Scale", settings.MinScale, 0.01f, 0.25f, 1.f))
+				{
+					bSettingsChanged = true;
+					EG_EDITOR_TRACE("Changed Dynamic Resolution Min Scale to: {}", settings.MinScale);
+				}
+				if (UI::PropertyDrag("Max Scale", settings.MaxScale, 0.01f, 0.25f, 1.f))
+				{
+					bSettingsChanged = true;
+					EG_EDITOR_TRACE("Changed Dynamic Resolution Max Scale to: {}", settings.MaxScale);
+				}
+				const float renderScale = m_CurrentScene->GetSceneRenderer()->GetRenderScale();
+				UI::Text("Current Scale", std::to_string(renderScale));
+
+				UI::EndPropertyGrid();
+				ImGui::TreePop();
+			}
+		}
+
 		// Fog settings
 		{
 			ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2{ 4, 4 });
@@ -1441,6 +1675,34 @@ namespace Eagle
 				ImGui::TreePop();
 			}
 
+			bool rhiTreeOpened = ImGui::TreeNodeEx((void*)"RHI", flags, "RHI Stats");
+			if (rhiTreeOpened)
+			{
+				const RHIStatistics stats = RenderManager::GetRHIStats();
+				DisplayRHICounters(stats);
+
+				if (!stats.Passes.empty() && ImGui::TreeNodeEx((void*)"RHIPasses", flags, "Passes"))
+				{
+					std::vector<std::string_view> passes;
+					passes.reserve(stats.Passes.size());
+					for (const auto& [name, counters] : stats.Passes)
+						passes.push_back(name);
+					std::sort(passes.begin(), passes.end());
+
+					for (const auto& name : passes)
+					{
+						if (ImGui::TreeNodeEx(name.data(), ImGuiTreeNodeFlags_SpanAvailWidth, name.data()))
+						{
+							DisplayRHICounters(stats.Passes.at(name));
+							ImGui::TreePop();
+						}
+					}
+					ImGui::TreePop();
+				}
+
+				ImGui::TreePop();
+			}
+
 			ImGui::Text("Frame Time: %.6fms", m_Ts * 1000.f);
 			ImGui::Text("FPS: %d", int(1.f / m_Ts));
 			ImGui::PopID();
@@ -40,6 +40,7 @@ namespace Eagle
 		const auto& gtaoSettings = rendererOptions.GTAOSettings;
 		const auto& fogSettings = rendererOptions.FogSettings;
 		const auto& volumetricSettings = rendererOptions.VolumetricSettings;
+		const auto& dynamicResolution = rendererOptions.DynamicResolution;
 		const auto& shadowSettings = rendererOptions.ShadowsSettings;
 		const auto& photoLinearParams = rendererOptions.PhotoLinearTonemappingParams;
 		const auto& filmicParams = rendererOptions.FilmicTonemappingParams;
@@ -65,6 +66,7 @@ namespace Eagle
 		out << YAML::Key << "TransparencyLayers" << YAML::Value << rendererOptions.TransparencyLayers;
 		out << YAML::Key << "AO" << YAML::Value << Utils::GetEnumName(rendererOptions.AO);
 		out << YAML::Key << "AA" << YAML::Value << Utils::GetEnumName(rendererOptions.AA);
+		out << YAML::Key << "Upscaling" << YAML::Value << Utils::GetEnumName(rendererOptions.Upscaling);
 		out << YAML::Key << "Gamma" << YAML::Value << rendererOptions.Gamma;
 		out << YAML::Key << "Exposure" << YAML::Value << rendererOptions.Exposure;
 		out << YAML::Key << "TonemappingMethod" << YAML::Value << Utils::GetEnumName(rendererOptions.Tonemapping);
@@ -90,6 +92,7 @@ namespace Eagle
 		out << YAML::BeginMap;
 		out << YAML::Key << "Samples" << YAML::Value << gtaoSettings.GetNumberOfSamples();
 		out << YAML::Key << "Radius" << YAML::Value << gtaoSettings.GetRadius();
+		out << YAML::Key << "bTemporal" << YAML::Value << gtaoSettings.IsTemporal();
 		out << YAML::EndMap; // GTAO Settings
 
 		out << YAML::Key << "Fog Settings";
@@ -104,6 +107,7 @@ namespace Eagle
 
 		out << YAML::Key << "Volumetric Light Settings";
 		out << YAML::BeginMap;
+		out << YAML::Key << "Method" << YAML::Value << Utils::GetEnumName(volumetricSettings.Method);
 		out << YAML::Key << "Samples" << YAML::Value << volumetricSettings.Samples;
 		out << YAML::Key << "MaxScatteringDistance" << YAML::Value << volumetricSettings.MaxScatteringDistance;
 		out << YAML::Key << "FogSpeed" << YAML::Value << volumetricSettings.FogSpeed;
@@ -111,6 +115,14 @@ namespace Eagle
 		out << YAML::Key << "bEnable" << YAML::Value << volumetricSettings.bEnable;
 		out << YAML::EndMap; // Volumetric Light Settings
 
+		out << YAML::Key << "Dynamic Resolution Settings";
+		out << YAML::BeginMap;
+		out << YAML::Key << "TargetGPUTime" << YAML::Value << dynamicResolution.TargetGPUTime;
+		out << YAML::Key << "MinScale" << YAML::Value << dynamicResolution.MinScale;
+		out << YAML::Key << "MaxScale" << YAML::Value << dynamicResolution.MaxScale;
+		out << YAML::Key << "bEnable" << YAML::Value << dynamicResolution.bEnable;
+		out << YAML::EndMap; // Dynamic Resolution Settings
+
 		out << YAML::Key << "Shadow Settings";
 		out << YAML::BeginMap;
 		out << YAML::Key << "PointLightSize" << YAML::Value << shadowSettings.PointLightShadowMapSize;
@@ -202,6 +214,8 @@ namespace Eagle
 			settings.AO = Utils::GetEnumFromName<AmbientOcclusion>(node.as<std::string>());
 		if (auto node = data["AA"])
 			settings.AA = Utils::GetEnumFromName<AAMethod>(node.as<std::string>());
+		if (auto node = data["Upscaling"])
+			settings.Upscaling = Utils::GetEnumFromName<UpscalingMode>(node.as<std::string>());
 		if (auto gammaNode = data["Gamma"])
 			settings.Gamma = gammaNode.as<float>();
 		if (auto exposureNode = data["Exposure"])
@@ -230,6 +244,8 @@ namespace Eagle
 		{
 			settings.GTAOSettings.SetNumberOfSamples(gtaoSettingsNode["Samples"].as<uint32_t>());
 			settings.GTAOSettings.SetRadius(gtaoSettingsNode["Radius"].as<float>());
+			if (auto node = gtaoSettingsNode["bTemporal"])
+				settings.GTAOSettings.SetTemporal(node.as<bool>());
 		}
 
 		if (auto fogSettingsNode = data["Fog Settings"])
@@ -244,6 +260,8 @@ namespace Eagle
 
 		if (auto volumetricSettingsNode = data["Volumetric Light Settings"])
 		{
+			if (auto node = volumetricSettingsNode["Method"])
+				settings.VolumetricSettings.Method = Utils::GetEnumFromName<VolumetricLightsMethod>(node.as<std::string>());
 			settings.VolumetricSettings.Samples = volumetricSettingsNode["Samples"].as<uint32_t>();
 			settings.VolumetricSettings.MaxScatteringDistance = volumetricSettingsNode["MaxScatteringDistance"].as<float>();
 			if (auto node = volumetricSettingsNode["FogSpeed"])
@@ -252,6 +270,14 @@ namespace Eagle
 			settings.VolumetricSettings.bEnable = volumetricSettingsNode["bEnable"].as<bool>();
 		}
 
+		if (auto dynamicResolutionNode = data["Dynamic Resolution Settings"])
+		{
+			settings.DynamicResolution.TargetGPUTime = dynamicResolutionNode["TargetGPUTime"].as<float>();
+			settings.DynamicResolution.MinScale = dynamicResolutionNode["MinScale"].as<float>();
+			settings.DynamicResolution.MaxScale = dynamicResolutionNode["MaxScale"].as<float>();
+			settings.DynamicResolution.bEnable = dynamicResolutionNode["bEnable"].as<bool>();
+		}
+
 		if (auto shadowSettingsNode = data["Shadow Settings"])
 		{
 			settings.ShadowsSettings.PointLightShadowMapSize = shadowSettingsNode["PointLightSize"].as<uint32_t>();
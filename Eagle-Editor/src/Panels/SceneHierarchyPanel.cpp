@@ -589,7 +589,9 @@ namespace Eagle
 				{
 					UI::BeginPropertyGrid("BillboardComponent");
 
-					UI::DrawTexture2DSelection("Texture", billboard.Texture);
+					Ref<Texture2D> texture = billboard.GetTexture();
+					if (UI::DrawTexture2DSelection("Texture", texture))
+						billboard.SetTexture(texture);
 
 					UI::EndPropertyGrid();
 				});
@@ -796,7 +798,9 @@ namespace Eagle
 					UI::BeginPropertyGrid("CameraComponent");
 					auto& camera = cameraComponent.Camera;
 
-					UI::Property("Primary", cameraComponent.Primary);
+					bool bPrimary = cameraComponent.IsPrimary();
+					if (UI::Property("Primary", bPrimary))
+						cameraComponent.SetPrimary(bPrimary);
 
 					static std::vector<std::string> projectionModesStrings = { "Perspective", "Orthographic" };
 
@@ -11,6 +11,7 @@
 #include "Eagle/Core/Entity.h"
 #include "Eagle/Core/ScriptableEntity.h"
 #include "Eagle/Core/Scene.h"
+#include "Eagle/Core/Prefab.h"
 #include "Eagle/Core/Transform.h"
 
 #include "Eagle/Input/Input.h"
@@ -13,7 +13,7 @@ namespace Eagle
 		if (m_Entity.HasComponent<CameraComponent>())
 		{
 			auto& cameraComponent = m_Entity.GetComponent<CameraComponent>();
-			if (cameraComponent.Primary)
+			if (cameraComponent.IsPrimary())
 			{
 				if (Input::IsMouseButtonPressed(Mouse::ButtonRight))
 				{
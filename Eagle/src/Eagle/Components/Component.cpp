@@ -9,8 +9,8 @@ namespace Eagle
 		, Parent(std::move(other.Parent))
 		, m_Tags(std::move(other.m_Tags))
 	{
-		ComponentsNotificationSystem::RemoveObserver(Parent, &other);
-		ComponentsNotificationSystem::AddObserver(Parent, this);
+		if (Parent)
+			ComponentsNotificationSystem::ReplaceObserver(Parent, &other, this);
 	}
 
 	Component& Component::operator=(const Component& other)
@@ -23,7 +23,7 @@ namespace Eagle
 		Name = other.Name;
 		m_Tags = other.m_Tags;
 
-		if (!Parent)
+		if (!Parent && other.Parent)
 		{
 			Parent = other.Parent;
 			ComponentsNotificationSystem::AddObserver(Parent, this);
@@ -34,14 +34,21 @@ namespace Eagle
 
 	Component& Component::operator=(Component&& other) noexcept
 	{
+		if (this == &other)
+			return *this;
+
+		// Stop observing the previous parent, since this component is being overwritten
+		if (Parent)
+			ComponentsNotificationSystem::RemoveObserver(Parent, this);
+
 		Object::operator=(std::move(other));
 
 		Name = std::move(other.Name);
 		Parent = std::move(other.Parent);
 		m_Tags = std::move(other.m_Tags);
 
-		ComponentsNotificationSystem::RemoveObserver(Parent, &other);
-		ComponentsNotificationSystem::AddObserver(Parent, this);
+		if (Parent)
+			ComponentsNotificationSystem::ReplaceObserver(Parent, &other, this);
 
 		return *this;
 	}
@@ -54,6 +61,9 @@ namespace Eagle
 
 	void Component::OnInit(Entity entity)
 	{
+		if (Parent)
+			ComponentsNotificationSystem::RemoveObserver(Parent, this);
+
 		Parent = entity;
 		ComponentsNotificationSystem::AddObserver(Parent, this);
 	}
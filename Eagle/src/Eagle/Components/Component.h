@@ -35,5 +35,10 @@ namespace Eagle
 
 	protected:
 		std::set<std::string> m_Tags;
+
+	private:
+		uint32_t m_ObserverIndex = ComponentsNotificationSystem::InvalidObserverIndex; // Slot in the observers of `Parent`
+
+		friend class ComponentsNotificationSystem;
 	};
 }
@@ -79,35 +79,44 @@ namespace Eagle
 	{
 		SceneComponent::SetWorldTransform(worldTransform);
 		UpdatePhysicsTransform();
+		if (bShowCollision)
+			SignalShapeChanged(Notification::OnTransformChanged);
 	}
 
 	void BaseColliderComponent::SetRelativeTransform(const Transform& relativeTransform)
 	{
 		SceneComponent::SetRelativeTransform(relativeTransform);
 		UpdatePhysicsTransform();
+		if (bShowCollision)
+			SignalShapeChanged(Notification::OnTransformChanged);
 	}
 	
 	void BoxColliderComponent::SetIsTrigger(bool bTrigger)
 	{
 		this->bTrigger = bTrigger;
-		m_Shape->SetIsTrigger(bTrigger);
+		if (m_Shape)
+			m_Shape->SetIsTrigger(bTrigger);
 	}
 	
 	void BoxColliderComponent::SetPhysicsMaterial(const Ref<PhysicsMaterial>& material)
 	{
 		Material = material;
-		m_Shape->SetPhysicsMaterial(material);
+		if (m_Shape)
+			m_Shape->SetPhysicsMaterial(material);
 	}
 
 	void BoxColliderComponent::SetShowCollision(bool bShowCollision)
 	{
 		this->bShowCollision = bShowCollision;
-		m_Shape->SetShowCollision(bShowCollision);
+		SignalShapeChanged(Notification::OnDebugStateChanged);
 	}
 	
 	void BoxColliderComponent::OnInit(Entity entity)
 	{
 		BaseColliderComponent::OnInit(entity);
+		if (!Parent.GetScene()->HasPhysics())
+			return;
+
 		auto actor = Parent.GetPhysicsActor();
 		if (actor)
 			m_Shape = actor->AddCollider(*this);
@@ -133,7 +142,10 @@ namespace Eagle
 	void BoxColliderComponent::SetSize(const glm::vec3& size)
 	{
 		m_Size = glm::max(size, glm::vec3(0.f));
-		m_Shape->SetSize(m_Size);
+		if (m_Shape)
+			m_Shape->SetSize(m_Size);
+		if (bShowCollision)
+			SignalShapeChanged(Notification::OnStateChanged);
 	}
 
 	void BoxColliderComponent::UpdatePhysicsTransform()
@@ -152,30 +164,38 @@ namespace Eagle
 	void SphereColliderComponent::SetRadius(float radius)
 	{
 		Radius = glm::max(radius, 0.f);
-		m_Shape->SetRadius(Radius);
+		if (m_Shape)
+			m_Shape->SetRadius(Radius);
+		if (bShowCollision)
+			SignalShapeChanged(Notification::OnStateChanged);
 	}
 	
 	void SphereColliderComponent::SetIsTrigger(bool bTrigger)
 	{
 		this->bTrigger = bTrigger;
-		m_Shape->SetIsTrigger(bTrigger);
+		if (m_Shape)
+			m_Shape->SetIsTrigger(bTrigger);
 	}
 	
 	void SphereColliderComponent::SetPhysicsMaterial(const Ref<PhysicsMaterial>& material)
 	{
 		Material = material;
-		m_Shape->SetPhysicsMaterial(material);
+		if (m_Shape)
+			m_Shape->SetPhysicsMaterial(material);
 	}
 
 	void SphereColliderComponent::SetShowCollision(bool bShowCollision)
 	{
 		this->bShowCollision = bShowCollision;
-		m_Shape->SetShowCollision(bShowCollision);
+		SignalShapeChanged(Notification::OnDebugStateChanged);
 	}
 	
 	void SphereColliderComponent::OnInit(Entity entity)
 	{
 		BaseColliderComponent::OnInit(entity);
+		if (!Parent.GetScene()->HasPhysics())
+			return;
+
 		auto actor = Parent.GetPhysicsActor();
 		if (actor)
 			m_Shape = actor->AddCollider(*this);
@@ -214,31 +234,39 @@ namespace Eagle
 	void CapsuleColliderComponent::SetIsTrigger(bool bTrigger)
 	{
 		this->bTrigger = bTrigger;
-		m_Shape->SetIsTrigger(bTrigger);
+		if (m_Shape)
+			m_Shape->SetIsTrigger(bTrigger);
 	}
 	
 	void CapsuleColliderComponent::SetPhysicsMaterial(const Ref<PhysicsMaterial>& material)
 	{
 		Material = material;
-		m_Shape->SetPhysicsMaterial(material);
+		if (m_Shape)
+			m_Shape->SetPhysicsMaterial(material);
 	}
 
 	void CapsuleColliderComponent::SetShowCollision(bool bShowCollision)
 	{
 		this->bShowCollision = bShowCollision;
-		m_Shape->SetShowCollision(bShowCollision);
+		SignalShapeChanged(Notification::OnDebugStateChanged);
 	}
 	
 	void CapsuleColliderComponent::SetHeightAndRadius(float height, float radius)
 	{
 		Height = glm::max(height, 0.f);
 		Radius = glm::max(radius, 0.f);
-		m_Shape->SetHeightAndRadius(Height, Radius);
+		if (m_Shape)
+			m_Shape->SetHeightAndRadius(Height, Radius);
+		if (bShowCollision)
+			SignalShapeChanged(Notification::OnStateChanged);
 	}
 	
 	void CapsuleColliderComponent::OnInit(Entity entity)
 	{
 		BaseColliderComponent::OnInit(entity);
+		if (!Parent.GetScene()->HasPhysics())
+			return;
+
 		auto actor = Parent.GetPhysicsActor();
 		if (actor)
 			m_Shape = actor->AddCollider(*this);
@@ -300,6 +328,8 @@ namespace Eagle
 	void MeshColliderComponent::SetCollisionMesh(const Ref<StaticMesh>& mesh)
 	{
 		CollisionMesh = mesh;
+		if (!Parent.GetScene()->HasPhysics())
+			return;
 
 		auto actor = Parent.GetPhysicsActor();
 		if (actor)
@@ -545,9 +545,44 @@ namespace Eagle
 	{
 	public:
 		BillboardComponent() = default;
-		COMPONENT_DEFAULTS(BillboardComponent);
+		BillboardComponent(const BillboardComponent&) = delete;
+		BillboardComponent(BillboardComponent&&) noexcept = default;
+		BillboardComponent& operator=(BillboardComponent&&) noexcept = default;
 
-		Ref<Texture2D> Texture;
+		BillboardComponent& operator=(const BillboardComponent& other)
+		{
+			if (this == &other)
+				return *this;
+
+			SceneComponent::operator=(other);
+			m_Texture = other.m_Texture;
+			Parent.SignalComponentChanged<BillboardComponent>(Notification::OnStateChanged);
+
+			return *this;
+		}
+
+		void SetWorldTransform(const Transform& worldTransform) override
+		{
+			SceneComponent::SetWorldTransform(worldTransform);
+			Parent.SignalComponentChanged<BillboardComponent>(Notification::OnTransformChanged);
+		}
+
+		void SetRelativeTransform(const Transform& relativeTransform) override
+		{
+			SceneComponent::SetRelativeTransform(relativeTransform);
+			Parent.SignalComponentChanged<BillboardComponent>(Notification::OnTransformChanged);
+		}
+
+		void SetTexture(const Ref<Texture2D>& texture)
+		{
+			m_Texture = texture;
+			Parent.SignalComponentChanged<BillboardComponent>(Notification::OnStateChanged);
+		}
+
+		const Ref<Texture2D>& GetTexture() const { return m_Texture; }
+
+	private:
+		Ref<Texture2D> m_Texture;
 	};
 
 	class Image2DComponent : public Component
@@ -897,6 +932,19 @@ namespace Eagle
 		{
 			return m_ViewMatrix;
 		}
+
+		bool IsPrimary() const { return m_bPrimary; }
+
+		// The scene caches its primary camera, so it needs to know when it's changed
+		void SetPrimary(bool bPrimary)
+		{
+			if (m_bPrimary == bPrimary)
+				return;
+
+			m_bPrimary = bPrimary;
+			if (Parent)
+				Parent.SignalComponentChanged<CameraComponent>(Notification::OnStateChanged);
+		}
 		
 	private:
 		void CalculateViewMatrix()
@@ -909,10 +957,10 @@ namespace Eagle
 
 	private:
 		glm::mat4 m_ViewMatrix = glm::mat4(1.f);
+		bool m_bPrimary = false;
 
 	public:
 		SceneCamera Camera;
-		bool Primary = false; //TODO: think about moving to Scene, or somewhere else
 		bool FixedAspectRatio = false;
 	};
 
@@ -989,6 +1037,9 @@ namespace Eagle
 		COMPONENT_DEFAULTS(BaseColliderComponent);
 		virtual void UpdatePhysicsTransform() = 0;
 
+		// Lets the scene update the debug shape of the collider. Called while the collision is visible, and when it's shown or hidden
+		virtual void SignalShapeChanged(Notification notification) {}
+
 	protected:
 		Ref<PhysicsMaterial> Material = MakeRef<PhysicsMaterial>(0.6f, 0.6f, 0.5f);
 		bool bTrigger = false;
@@ -1026,6 +1077,7 @@ namespace Eagle
 	
 	protected:
 		virtual void UpdatePhysicsTransform() override;
+		virtual void SignalShapeChanged(Notification notification) override { Parent.SignalComponentChanged<BoxColliderComponent>(notification); }
 
 	protected:
 		Ref<BoxColliderShape> m_Shape;
@@ -1064,6 +1116,7 @@ namespace Eagle
 	
 	protected:
 		virtual void UpdatePhysicsTransform() override;
+		virtual void SignalShapeChanged(Notification notification) override { Parent.SignalComponentChanged<SphereColliderComponent>(notification); }
 
 	protected:
 		Ref<SphereColliderShape> m_Shape;
@@ -1113,6 +1166,7 @@ namespace Eagle
 
 	protected:
 		virtual void UpdatePhysicsTransform() override;
+		virtual void SignalShapeChanged(Notification notification) override { Parent.SignalComponentChanged<CapsuleColliderComponent>(notification); }
 
 	protected:
 		Ref<CapsuleColliderShape> m_Shape;
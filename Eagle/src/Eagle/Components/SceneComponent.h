@@ -20,7 +20,14 @@ namespace Eagle
 
 		virtual void OnInit(Entity entity) override;
 		
-		const Transform& GetWorldTransform() const { return WorldTransform; }
+		const Transform& GetWorldTransform() const
+		{
+			// Components of entities whose ancestors have moved are updated when the scene resolves transforms
+			if (const Scene* scene = Parent.GetScene())
+				scene->ResolveTransforms();
+			return WorldTransform;
+		}
+
 		const Transform& GetRelativeTransform() const { return RelativeTransform; }
 
 		virtual void SetWorldTransform(const Transform& worldTransform);
@@ -44,7 +51,7 @@ namespace Eagle
 
 		const Rotator& GetOrientation() const
 		{
-			return WorldTransform.Rotation;
+			return GetWorldTransform().Rotation;
 		}
 
 	protected:
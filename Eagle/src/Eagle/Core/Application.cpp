@@ -4,6 +4,7 @@
 #include "Eagle/Core/Timestep.h"
 #include "Eagle/Core/ThreadPool.h"
 #include "Eagle/Debug/CPUTimings.h"
+#include "Eagle/Debug/FrameHistory.h"
 #include "Eagle/Renderer/RenderManager.h"
 #include "Eagle/Script/ScriptEngine.h"
 #include "Eagle/Physics/PhysicsEngine.h"
@@ -13,7 +14,7 @@
 
 #include "Platform/Vulkan/VulkanSwapchain.h"
 
-#include <GLFW/glfw3.h>
+#include <chrono>
 
 namespace Eagle
 {
@@ -32,17 +33,28 @@ namespace Eagle
 
 	Application* Application::s_Instance = nullptr;
 
-	Application::Application(const std::string& name)
+	// Seconds since the first call. Not using `glfwGetTime` so that headless runs don't require GLFW to be initialized
+	static double GetTimeSeconds()
+	{
+		static const auto s_StartTime = std::chrono::steady_clock::now();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - s_StartTime).count();
+	}
+
+	Application::Application(const std::string& name, RendererAPIType api, bool bHeadless)
 		: m_WindowProps(name, 1600, 900, true, false)
 	{
 		EG_CORE_ASSERT(!s_Instance, "Application already exists!");
 		s_Instance = this;
 
 		m_Threads.reserve(4);
-		m_CPUTimingsInUse.reserve(4);
 		m_Threads[std::this_thread::get_id()] = "Main Thread";
 
-		RendererContext::SetAPI(RendererAPIType::Vulkan);
+		// Main and render threads are already busy
+		const uint32_t coresCount = std::thread::hardware_concurrency();
+		m_WorkerPool = MakeScope<ThreadPool>("Worker Thread", coresCount > 3 ? coresCount - 2 : 1);
+
+		RendererContext::SetAPI(api);
+		RendererContext::SetHeadless(bHeadless || api == RendererAPIType::Null);
 		m_RendererContext = RendererContext::Create();
 		m_Window = Window::Create(m_WindowProps);
 		m_Window->SetEventCallback(EG_BIND_FN(OnEvent));
@@ -59,6 +71,7 @@ namespace Eagle
 	Application::~Application()
 	{
 		RenderManager::Finish();
+		m_WorkerPool.reset();
 		m_ImGuiLayer.reset();
 		m_LayerStack.clear();
 		m_Window.reset();
@@ -69,43 +82,20 @@ namespace Eagle
 		RenderManager::Shutdown();
 	}
 
-	static std::mutex s_TimingsMutex;
-
 	void Application::Run()
 	{
-		float m_LastFrameTime = (float)glfwGetTime();
+		float m_LastFrameTime = (float)GetTimeSeconds();
 		while (m_Running)
 		{
 #ifdef EG_CPU_TIMINGS
-			{
-				std::scoped_lock lock(s_TimingsMutex);
-
-				for (auto& [threadID, timings] : m_CPUTimings)
-				{
-					auto& timingsInUse = m_CPUTimingsInUse.find(threadID)->second;
-
-					for (auto it = timings.begin(); it != timings.end();)
-					{
-						std::string_view name = (*it).Name;
-						auto inUseIt = timingsInUse.find(name);
-						if (inUseIt != timingsInUse.end())
-						{
-							++it;
-						}
-						else
-						{
-							it = timings.erase(it);
-						}
-					}
-				}
-				for (auto& it : m_CPUTimingsInUse)
-					it.second.clear();
-			}
+			CPUTiming::BeginFrame();
 #endif
 			EG_CPU_TIMING_SCOPED("Whole frame");
-			m_Time = glfwGetTime();
+			m_Time = GetTimeSeconds();
 			const float currentFrameTime = (float)m_Time;
 			m_Timestep = currentFrameTime - m_LastFrameTime;
+			// Timings of the previous frame have just become available
+			FrameHistory::AddFrame(m_LastFrameTime, m_Timestep.GetMilliseconds());
 			m_LastFrameTime = currentFrameTime;
 
 #ifndef EG_DIST
@@ -200,69 +190,22 @@ namespace Eagle
 		}
 	}
 
-	void Application::AddCPUTiming(const CPUTiming* timing)
-	{
-		std::scoped_lock lock(s_TimingsMutex);
-
-		auto id = std::this_thread::get_id();
-		auto name = timing->GetName();
-		m_CPUTimingsInUse[id].emplace(name);
-
-		const auto& timingData = timing->GetData();
-		auto& timingsByName = m_CPUTimings[id];
-
-		auto it = timingsByName.find(timingData);
-		if (it != timingsByName.end()) // Update timings data
-		{
-			(*it).Timing = timingData.Timing;
-			(*it).Children= timingData.Children;
-		}
-		else
-		{
-			timingsByName.emplace(timingData);
-		}
-	}
-
-	static CPUTiming::Data ProcessCPUTiming(const CPUTiming::Data& timing)
+#ifdef EG_CPU_TIMINGS
+	static void SortCPUTimings(std::vector<CPUTiming::Data>& timings)
 	{
-		CPUTiming::Data data;
-		data.Name = timing.Name;
-		data.Timing = timing.Timing;
-
-		const auto& children = timing.Children;
-		for (auto& child : children)
-		{
-			auto& childData = data.Children.emplace_back();
-			childData.Name = child.Name;
-			childData.Timing = child.Timing;
-		}
-
-		const size_t childsCount = children.size();
-		for (size_t i = 0; i < childsCount; ++i)
-		{
-			auto& child = children[i];
-			for (auto& childsChild : child.Children)
-				data.Children[i].Children.push_back(ProcessCPUTiming(childsChild));
-			std::sort(data.Children[i].Children.begin(), data.Children[i].Children.end(), s_CustomCPUTimingsLess);
-		}
-		std::sort(data.Children.begin(), data.Children.end(), s_CustomCPUTimingsLess);
-
-		return data;
+		for (auto& timing : timings)
+			SortCPUTimings(timing.Children);
+		std::sort(timings.begin(), timings.end(), s_CustomCPUTimingsLess);
 	}
 
 	CPUTimingsContainer Application::GetCPUTimings() const
 	{
-		CPUTimingsContainer result;
-		{
-			std::scoped_lock lock(s_TimingsMutex);
-			for (auto& [threadID, timings] : m_CPUTimings)
-			{
-				for (auto& timing : timings)
-					result[threadID].push_back(ProcessCPUTiming(timing));
-			}
-		}
+		CPUTimingsContainer result = CPUTiming::GetLastFrameTimings();
+		for (auto& [threadID, timings] : result)
+			SortCPUTimings(timings);
 		return result;
 	}
+#endif
 
 	bool Application::OnWindowClose(WindowCloseEvent& e)
 	{
@@ -20,13 +20,29 @@ namespace Eagle
 	class RendererContext;
 	class ThreadPool;
 
+	struct ApplicationCommandLineArgs
+	{
+		int Count = 0;
+		char** Args = nullptr;
+
+		const char* operator[](int index) const
+		{
+			EG_CORE_ASSERT(index < Count);
+			return Args[index];
+		}
+	};
+
+#ifdef EG_CPU_TIMINGS
 	// Key - Thread id; value - timings
 	using CPUTimingsContainer = std::unordered_map<std::thread::id, std::vector<CPUTiming::Data>>;
+#endif
 
 	class Application
 	{
 	public:
-		Application(const std::string& name = "Eagle Application");
+		// `api` - pass `RendererAPIType::Null` to run without a window and GPU (headless CPU benchmarks)
+		// `bHeadless` - run without a window. Frames are rendered offscreen. Always true for the null API
+		Application(const std::string& name = "Eagle Application", RendererAPIType api = RendererAPIType::Vulkan, bool bHeadless = false);
 		Application(const Application&) = delete;
 		virtual ~Application();
 
@@ -37,6 +53,8 @@ namespace Eagle
 		inline Window& GetWindow() { return *m_Window; }
 		inline bool IsMinimized() const { return m_Minimized; }
 		void SetShouldClose(bool close);
+		// Returned from `main` when the application is closed
+		void SetExitCode(int exitCode) { m_ExitCode = exitCode; }
 
 		void PushLayer(const Ref<Layer>& layer);
 		bool PopLayer(const Ref<Layer>& layer);
@@ -48,6 +66,9 @@ namespace Eagle
 		Ref<RendererContext>& GetRenderContext() { return m_RendererContext; }
 		const Ref<RendererContext>& GetRenderContext() const { return m_RendererContext; }
 
+		// General purpose pool for splitting the main thread's work
+		ThreadPool& GetWorkerPool() { return *m_WorkerPool; }
+
 		void AddThread(const ThreadPool& threadPool);
 		void RemoveThread(const ThreadPool& threadPool);
 		std::string_view GetThreadName(std::thread::id threadID)
@@ -58,8 +79,9 @@ namespace Eagle
 			return "";
 		}
 
-		void AddCPUTiming(const CPUTiming* timing);
+#ifdef EG_CPU_TIMINGS
 		CPUTimingsContainer GetCPUTimings() const;
+#endif
 
 	protected:
 		virtual bool OnWindowClose(WindowCloseEvent& e);
@@ -78,14 +100,13 @@ namespace Eagle
 		LayerStack m_LayerStack;
 
 		std::unordered_map<std::thread::id, std::string_view> m_Threads;
-
-		std::unordered_map<std::thread::id, std::unordered_set<std::string_view>> m_CPUTimingsInUse;
-		std::unordered_map<std::thread::id, std::set<CPUTiming::Data>> m_CPUTimings;
+		Scope<ThreadPool> m_WorkerPool;
 
 		std::vector<std::function<void()>> m_NextFrameFuncs;
 
 		Timestep m_Timestep = 0.f;
 		double m_Time = 0.f;
+		int m_ExitCode = 0;
 
 		bool m_Running = true;
 		bool m_Minimized = false;
@@ -94,6 +115,6 @@ namespace Eagle
 	};
 
 	//To be defined in CLIENT
-	Application* CreateApplication();
+	Application* CreateApplication(ApplicationCommandLineArgs args);
 }
 
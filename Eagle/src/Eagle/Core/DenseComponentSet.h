@@ -0,0 +1,89 @@
+#pragma once
+
+#include <entt.hpp>
+#include <vector>
+
+namespace Eagle
+{
+	// Unordered set of component pointers, one component per entity. Components are stored contiguously, so iterating them is cheap.
+	// Each entity has a slot that points to its component in the array, so adding, removing and checking if a component is in the set is O(1).
+	// Clearing keeps the memory, so sets that are refilled every frame stop allocating once they have reached their peak size.
+	// Components aren't dereferenced by the set, so it can be cleared even if some of them are already destroyed
+	template<typename T>
+	class DenseComponentSet
+	{
+	public:
+		using Iterator = typename std::vector<const T*>::const_iterator;
+
+		// Returns false if the entity's component is already in the set
+		bool Add(const T* component)
+		{
+			const uint32_t entityIndex = GetEntityIndex(component);
+			if (entityIndex >= m_Slots.size())
+				m_Slots.resize(size_t(entityIndex) + 1, s_InvalidSlot);
+
+			uint32_t& slot = m_Slots[entityIndex];
+			if (slot != s_InvalidSlot)
+				return false;
+
+			slot = uint32_t(m_Components.size());
+			m_Components.push_back(component);
+			m_EntityIndices.push_back(entityIndex);
+			return true;
+		}
+
+		// Returns false if the entity's component isn't in the set. The order of the remaining components isn't preserved
+		bool Remove(const T* component)
+		{
+			const uint32_t entityIndex = GetEntityIndex(component);
+			if (entityIndex >= m_Slots.size() || m_Slots[entityIndex] == s_InvalidSlot)
+				return false;
+
+			const uint32_t slot = m_Slots[entityIndex];
+			const uint32_t lastEntityIndex = m_EntityIndices.back();
+			m_Components[slot] = m_Components.back();
+			m_EntityIndices[slot] = lastEntityIndex;
+			m_Slots[lastEntityIndex] = slot;
+			m_Slots[entityIndex] = s_InvalidSlot;
+
+			m_Components.pop_back();
+			m_EntityIndices.pop_back();
+			return true;
+		}
+
+		bool Contains(const T* component) const
+		{
+			const uint32_t entityIndex = GetEntityIndex(component);
+			return entityIndex < m_Slots.size() && m_Slots[entityIndex] != s_InvalidSlot;
+		}
+
+		// Only slots of the stored components are reset
+		void Clear()
+		{
+			for (uint32_t entityIndex : m_EntityIndices)
+				m_Slots[entityIndex] = s_InvalidSlot;
+			m_Components.clear();
+			m_EntityIndices.clear();
+		}
+
+		// Index of the component in `GetComponents()`. The component needs to be in the set
+		uint32_t GetIndex(const T* component) const { return m_Slots[GetEntityIndex(component)]; }
+
+		const std::vector<const T*>& GetComponents() const { return m_Components; }
+		size_t Size() const { return m_Components.size(); }
+		bool Empty() const { return m_Components.empty(); }
+
+		Iterator begin() const { return m_Components.begin(); }
+		Iterator end() const { return m_Components.end(); }
+
+	private:
+		static uint32_t GetEntityIndex(const T* component) { return uint32_t(entt::entt_traits<entt::entity>::to_entity(component->Parent.GetEnttID())); }
+
+	private:
+		static constexpr uint32_t s_InvalidSlot = uint32_t(-1);
+
+		std::vector<const T*> m_Components;
+		std::vector<uint32_t> m_EntityIndices; // Entity index of each stored component. Used to reset slots without touching components
+		std::vector<uint32_t> m_Slots; // Indexed by the entity index
+	};
+}
@@ -12,12 +12,16 @@ namespace Eagle
 	{
 		EG_CORE_ASSERT(m_Scene, "Invalid Entity");
 
+		// Pending transforms are resolved using the current hierarchy
+		m_Scene->ResolveTransforms();
+
 		auto& ownershipComponent = GetComponent<OwnershipComponent>();
 
 		if (ownershipComponent.EntityParent)
 			ownershipComponent.EntityParent.RemoveChildren(*this);
 
 		ownershipComponent.EntityParent = parent;
+		m_Scene->m_TransformSystem.OnHierarchyChanged();
 
 		auto& transformComponent = GetComponent<TransformComponent>();
 		if (parent)
@@ -45,16 +49,12 @@ namespace Eagle
 		return GetComponent<OwnershipComponent>().EntityParent;
 	}
 
-	void Entity::NotifyAllChildren(Notification notification)
+	void Entity::OnWorldTransformChanged()
 	{
-		auto& children = GetComponent<OwnershipComponent>().Children;
-
-		// Notify Entity-childs
-		for (auto& child : children)
-			child.OnNotify(notification);
-
-		// Notify components
 		ComponentsNotificationSystem::Notify(*this, Notification::OnParentTransformChanged);
+
+		if (HasChildren())
+			m_Scene->m_TransformSystem.MarkDirty(m_Entity);
 	}
 
 	void Entity::AddChildren(Entity child)
@@ -85,6 +85,10 @@ namespace Eagle
 
 	const Transform& Entity::GetWorldTransform() const
 	{
+		// World transforms of root entities are never stale
+		if (m_Scene->m_TransformSystem.HasDirtyEntities() && HasParent())
+			m_Scene->ResolveTransforms();
+
 		return GetComponent<TransformComponent>().WorldTransform;
 	}
 
@@ -122,43 +126,43 @@ namespace Eagle
 			}
 		}
 
-		NotifyAllChildren(Notification::OnParentTransformChanged);
+		OnWorldTransformChanged();
 	}
 
 	void Entity::SetWorldLocation(const glm::vec3& worldLocation, bool bTeleportPhysics)
 	{
-		Transform transform = GetComponent<TransformComponent>().WorldTransform;
+		Transform transform = GetWorldTransform();
 		transform.Location = worldLocation;
 		SetWorldTransform(transform, bTeleportPhysics);
 	}
 
 	const glm::vec3& Entity::GetWorldLocation() const
 	{
-		return GetComponent<TransformComponent>().WorldTransform.Location;
+		return GetWorldTransform().Location;
 	}
 
 	void Entity::SetWorldRotation(const Rotator& worldRotation, bool bTeleportPhysics)
 	{
-		Transform transform = GetComponent<TransformComponent>().WorldTransform;
+		Transform transform = GetWorldTransform();
 		transform.Rotation = worldRotation;
 		SetWorldTransform(transform, bTeleportPhysics);
 	}
 
 	const Rotator& Entity::GetWorldRotation() const
 	{
-		return GetComponent<TransformComponent>().WorldTransform.Rotation;
+		return GetWorldTransform().Rotation;
 	}
 
 	void Entity::SetWorldScale(const glm::vec3& worldScale, bool bTeleportPhysics)
 	{
-		Transform transform = GetComponent<TransformComponent>().WorldTransform;
+		Transform transform = GetWorldTransform();
 		transform.Scale3D = worldScale;
 		SetWorldTransform(transform, bTeleportPhysics);
 	}
 
 	const glm::vec3& Entity::GetWorldScale() const
 	{
-		return GetComponent<TransformComponent>().WorldTransform.Scale3D;
+		return GetWorldTransform().Scale3D;
 	}
 
 	void Entity::SetRelativeLocation(const glm::vec3& relativeLocation, bool bTeleportPhysics)
@@ -236,7 +240,7 @@ namespace Eagle
 				}
 			}
 
-			NotifyAllChildren(Notification::OnParentTransformChanged);
+			OnWorldTransformChanged();
 		}
 	}
 
@@ -91,6 +91,7 @@ namespace Eagle
 		EntityIDType GetID() const { return (EntityIDType)m_Entity; }
 		const GUID& GetGUID() const;
 		entt::entity GetEnttID() const { return m_Entity; }
+		EntityHandle GetHandle() const { return { m_Entity }; }
 		const Scene* GetScene() const { return m_Scene; }
 		Scene* GetScene() { return m_Scene; }
 		const std::string& GetSceneName() const;
@@ -101,7 +102,8 @@ namespace Eagle
 		void OnNotify(Notification notification);
 
 	private:
-		void NotifyAllChildren(Notification notification);
+		// Components are notified right away, descendants are updated by the scene's transform system
+		void OnWorldTransformChanged();
 		void AddChildren(Entity child);
 		void RemoveChildren(Entity child);
 
@@ -1,23 +1,24 @@
 #pragma once
 
-#ifdef EG_PLATFORM_WINDOWS
+#if defined(EG_PLATFORM_WINDOWS) || defined(EG_PLATFORM_LINUX)
 
-extern Eagle::Application* Eagle::CreateApplication();
+extern Eagle::Application* Eagle::CreateApplication(Eagle::ApplicationCommandLineArgs args);
 
 int main(int argc, char** argv)
 {
 	Eagle::Log::Init();
 
 	EG_CORE_INFO("Creating Application!");
-	Eagle::Application* app = Eagle::CreateApplication();
+	Eagle::Application* app = Eagle::CreateApplication({ argc, argv });
 
 	EG_CORE_INFO("Running Application!");
 	app->Run();
 
 	EG_CORE_INFO("Shutting down Application!");
+	const int exitCode = app->m_ExitCode;
 	delete app;
 
-	return 0;
+	return exitCode;
 }
 
 #endif
\ No newline at end of file
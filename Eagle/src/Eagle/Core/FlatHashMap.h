@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Core.h"
+
+#include <vector>
+#include <functional>
+
+namespace Eagle
+{
+	// Open-addressing hash map with linear probing. Keys and values are stored in a single array, so a lookup usually touches one cache line.
+	// Erasing shifts the following entries back instead of leaving tombstones, so lookups don't degrade over time.
+	// `emptyKey` marks free slots and can't be inserted. Pointers to values are invalidated by inserting and erasing
+	template<typename Key, typename Value, typename Hasher = std::hash<Key>>
+	class FlatHashMap
+	{
+	public:
+		explicit FlatHashMap(const Key& emptyKey) : m_EmptyKey(emptyKey) {}
+
+		Value* Find(const Key& key)
+		{
+			if (m_Count == 0 || key == m_EmptyKey)
+				return nullptr;
+
+			for (size_t index = GetIndex(key);; index = (index + 1) & m_Mask)
+			{
+				Slot& slot = m_Slots[index];
+				if (slot.SlotKey == key)
+					return &slot.SlotValue;
+				if (slot.SlotKey == m_EmptyKey)
+					return nullptr;
+			}
+		}
+
+		const Value* Find(const Key& key) const { return const_cast<FlatHashMap*>(this)->Find(key); }
+
+		// Overwrites the value if the key is already present
+		void Insert(const Key& key, const Value& value)
+		{
+			EG_CORE_ASSERT(key != m_EmptyKey, "Empty key can't be inserted");
+			if ((m_Count + 1) * 4 > m_Slots.size() * 3)
+				Rehash(m_Slots.empty() ? s_MinCapacity : m_Slots.size() * 2);
+
+			for (size_t index = GetIndex(key);; index = (index + 1) & m_Mask)
+			{
+				Slot& slot = m_Slots[index];
+				if (slot.SlotKey == key)
+				{
+					slot.SlotValue = value;
+					return;
+				}
+				if (slot.SlotKey == m_EmptyKey)
+				{
+					slot.SlotKey = key;
+					slot.SlotValue = value;
+					++m_Count;
+					return;
+				}
+			}
+		}
+
+		bool Erase(const Key& key)
+		{
+			if (m_Count == 0 || key == m_EmptyKey)
+				return false;
+
+			size_t index = GetIndex(key);
+			for (;; index = (index + 1) & m_Mask)
+			{
+				const Slot& slot = m_Slots[index];
+				if (slot.SlotKey == key)
+					break;
+				if (slot.SlotKey == m_EmptyKey)
+					return false;
+			}
+
+			// Move back the entries that would have been placed into the freed slot
+			size_t hole = index;
+			for (size_t next = (hole + 1) & m_Mask; m_Slots[next].SlotKey != m_EmptyKey; next = (next + 1) & m_Mask)
+			{
+				const size_t desired = GetIndex(m_Slots[next].SlotKey);
+				const bool bCanMove = ((next - desired) & m_Mask) >= ((next - hole) & m_Mask);
+				if (bCanMove)
+				{
+					m_Slots[hole] = std::move(m_Slots[next]);
+					hole = next;
+				}
+			}
+			m_Slots[hole] = Slot{ m_EmptyKey, Value() };
+			--m_Count;
+			return true;
+		}
+
+		// Keeps the memory
+		void Clear()
+		{
+			if (m_Count == 0)
+				return;
+
+			std::fill(m_Slots.begin(), m_Slots.end(), Slot{ m_EmptyKey, Value() });
+			m_Count = 0;
+		}
+
+		void Reserve(size_t count)
+		{
+			size_t capacity = s_MinCapacity;
+			while (count * 4 > capacity * 3)
+				capacity *= 2;
+
+			if (capacity > m_Slots.size())
+				Rehash(capacity);
+		}
+
+		size_t Size() const { return m_Count; }
+		bool Empty() const { return m_Count == 0; }
+
+		template<typename Func>
+		void ForEach(Func&& func) const
+		{
+			for (const Slot& slot : m_Slots)
+				if (slot.SlotKey != m_EmptyKey)
+					func(slot.SlotKey, slot.SlotValue);
+		}
+
+	private:
+		// Fibonacci hashing. Spreads the hash over the upper bits, so even weak hashes use the whole table
+		size_t GetIndex(const Key& key) const
+		{
+			const uint64_t hash = uint64_t(Hasher()(key)) * 11400714819323198485ull;
+			return size_t(hash >> m_Shift);
+		}
+
+		void Rehash(size_t capacity)
+		{
+			std::vector<Slot> oldSlots(capacity, Slot{ m_EmptyKey, Value() });
+			oldSlots.swap(m_Slots);
+
+			m_Mask = capacity - 1;
+			m_Shift = 64;
+			for (size_t i = capacity; i > 1; i >>= 1)
+				--m_Shift;
+			m_Count = 0;
+
+			for (const Slot& slot : oldSlots)
+				if (slot.SlotKey != m_EmptyKey)
+					Insert(slot.SlotKey, slot.SlotValue);
+		}
+
+	private:
+		struct Slot
+		{
+			Key SlotKey;
+			Value SlotValue;
+		};
+
+		static constexpr size_t s_MinCapacity = 16; // Must be a power of two
+
+		std::vector<Slot> m_Slots;
+		Key m_EmptyKey;
+		size_t m_Count = 0;
+		size_t m_Mask = 0;
+		uint32_t m_Shift = 64;
+	};
+}
@@ -5,34 +5,74 @@
 
 namespace Eagle
 {
-	static std::unordered_map<Entity, std::vector<Component*>> s_Entities;
-	
-	void ComponentsNotificationSystem::AddObserver(const Entity& parent, Component* observer)
+	void ComponentsNotificationSystem::AddObserver(Entity parent, Component* observer)
 	{
-		s_Entities[parent].push_back(observer);
+		EG_CORE_ASSERT(observer->m_ObserverIndex == InvalidObserverIndex, "Component is already observing an entity");
+
+		auto& observers = parent.GetScene()->m_Registry.get_or_emplace<ComponentObservers>(parent.GetEnttID());
+		observer->m_ObserverIndex = observers.Size();
+		observers.PushBack(observer);
 	}
-	
-	void ComponentsNotificationSystem::RemoveObserver(const Entity& parent, Component* observer)
+
+	void ComponentsNotificationSystem::RemoveObserver(Entity parent, Component* observer)
 	{
-		auto it = s_Entities.find(parent);
-		if (it != s_Entities.end())
-		{
-			auto& children = it->second;
-			auto it = std::find(children.begin(), children.end(), observer);
-			if (it != children.end())
-				children.erase(it);
-		}
+		const uint32_t index = observer->m_ObserverIndex;
+		if (index == InvalidObserverIndex)
+			return;
+
+		observer->m_ObserverIndex = InvalidObserverIndex;
+
+		// Observers might be already destroyed if the whole entity is being destroyed
+		auto* observers = parent.GetScene()->m_Registry.try_get<ComponentObservers>(parent.GetEnttID());
+		if (!observers)
+			return;
+
+		EG_CORE_ASSERT((*observers)[index] == observer, "Observer index mismatch");
+		Component* last = (*observers)[observers->Size() - 1];
+		(*observers)[index] = last;
+		last->m_ObserverIndex = index;
+		observers->PopBack();
 	}
-	
-	void ComponentsNotificationSystem::Notify(const Entity& parent, Notification notification)
+
+	void ComponentsNotificationSystem::ReplaceObserver(Entity parent, Component* oldObserver, Component* newObserver)
 	{
-		auto& children = s_Entities[parent];
-		for (auto& child : children)
-			child->OnNotify(notification);
+		const uint32_t index = oldObserver->m_ObserverIndex;
+		oldObserver->m_ObserverIndex = InvalidObserverIndex;
+		newObserver->m_ObserverIndex = InvalidObserverIndex;
+		if (index == InvalidObserverIndex)
+			return;
+
+		auto* observers = parent.GetScene()->m_Registry.try_get<ComponentObservers>(parent.GetEnttID());
+		if (!observers)
+			return;
+
+		EG_CORE_ASSERT((*observers)[index] == oldObserver, "Observer index mismatch");
+		(*observers)[index] = newObserver;
+		newObserver->m_ObserverIndex = index;
 	}
-	
-	void ComponentsNotificationSystem::ResetSystem()
+
+	void ComponentsNotificationSystem::Notify(Entity parent, Notification notification)
 	{
-		s_Entities.clear();
+		if (const auto* observers = parent.GetScene()->m_Registry.try_get<ComponentObservers>(parent.GetEnttID()))
+		{
+			const uint32_t count = observers->Size();
+			for (uint32_t i = 0; i < count; ++i)
+				(*observers)[i]->OnNotify(notification);
+		}
+	}
+
+	void ComponentsNotificationSystem::Notify(Scene& scene, const std::vector<entt::entity>& entities, Notification notification)
+	{
+		auto view = scene.m_Registry.view<ComponentObservers>();
+		for (entt::entity entity : entities)
+		{
+			if (!view.contains(entity))
+				continue;
+
+			const auto& observers = view.get<ComponentObservers>(entity);
+			const uint32_t count = observers.Size();
+			for (uint32_t i = 0; i < count; ++i)
+				observers[i]->OnNotify(notification);
+		}
 	}
 }
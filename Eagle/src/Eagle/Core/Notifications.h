@@ -19,13 +19,57 @@ namespace Eagle
 
 	class Component;
 	class Entity;
+	class Scene;
+
+	// Components that are notified about the changes of the entity they're attached to.
+	// It's stored in the registry of the entity's scene, so scenes (and their copies) don't share observers.
+	// Each observer knows its slot, so adding and removing is O(1). The order of observers isn't preserved
+	class ComponentObservers
+	{
+	public:
+		static constexpr uint32_t InlineCapacity = 8; // Most entities don't have more components than this
+
+		Component* operator[](uint32_t index) const { return index < InlineCapacity ? m_Inline[index] : m_Overflow[index - InlineCapacity]; }
+		Component*& operator[](uint32_t index) { return index < InlineCapacity ? m_Inline[index] : m_Overflow[index - InlineCapacity]; }
+
+		uint32_t Size() const { return m_Size; }
+
+		void PushBack(Component* observer)
+		{
+			if (m_Size < InlineCapacity)
+				m_Inline[m_Size] = observer;
+			else
+				m_Overflow.push_back(observer);
+			++m_Size;
+		}
+
+		void PopBack()
+		{
+			--m_Size;
+			if (m_Size >= InlineCapacity)
+				m_Overflow.pop_back();
+		}
+
+	private:
+		Component* m_Inline[InlineCapacity] = {};
+		std::vector<Component*> m_Overflow;
+		uint32_t m_Size = 0;
+	};
 
 	class ComponentsNotificationSystem
 	{
 	public:
-		static void AddObserver(const Entity& parent, Component* observer);
-		static void RemoveObserver(const Entity& parent, Component* observer);
-		static void Notify(const Entity& parent, Notification notification);
-		static void ResetSystem();
+		static constexpr uint32_t InvalidObserverIndex = uint32_t(-1);
+
+		static void AddObserver(Entity parent, Component* observer);
+		static void RemoveObserver(Entity parent, Component* observer);
+
+		// `newObserver` takes the slot of `oldObserver`. Used when components are moved
+		static void ReplaceObserver(Entity parent, Component* oldObserver, Component* newObserver);
+
+		static void Notify(Entity parent, Notification notification);
+
+		// Notifies observers of all `entities` of the scene. Observers storage is looked up only once
+		static void Notify(Scene& scene, const std::vector<entt::entity>& entities, Notification notification);
 	};
 }
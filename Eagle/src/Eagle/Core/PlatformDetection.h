@@ -34,8 +34,8 @@
 	#define EG_PLATFORM_ANDROID
 	#error "Android is not supported!"
 #elif defined(__linux__)
+	/* Linux x64, headless only */
 	#define EG_PLATFORM_LINUX
-	#error "Linux is not supported!"
 #else
 	/* Unknown compiler/platform */
 	#error "Unknown platform!"
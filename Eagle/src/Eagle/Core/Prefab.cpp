@@ -0,0 +1,50 @@
+#include "egpch.h"
+#include "Prefab.h"
+
+#include "Eagle/Components/Components.h"
+
+namespace Eagle
+{
+	template<typename... T>
+	static uint32_t GetComponentsMask(const Entity& entity, const std::tuple<T...>*)
+	{
+		uint32_t mask = 0;
+		uint32_t bit = 1;
+		((mask |= entity.HasComponent<T>() ? bit : 0u, bit <<= 1), ...);
+		return mask;
+	}
+
+	// Components are added in the order of `Prefab::Components`, so that physics actors of spawned entities are created after the rigid body is copied
+	template<typename T>
+	static void PrefabCopyComponent(const Entity& source, Entity& destination)
+	{
+		if (source.HasComponent<T>())
+			destination.AddComponent<T>() = source.GetComponent<T>();
+	}
+
+	template<typename... T>
+	static void PrefabCopyComponents(const Entity& source, Entity& destination, const std::tuple<T...>*)
+	{
+		(PrefabCopyComponent<T>(source, destination), ...);
+	}
+
+	Prefab::Prefab(const Entity& source)
+	{
+		static_assert(std::tuple_size_v<Components> <= 32, "Components don't fit into the mask");
+
+		Scene* sourceScene = source.GetScene();
+		if (!sourceScene || !sourceScene->IsHandleValid(source.GetHandle()))
+		{
+			EG_CORE_ERROR("Failed to create a prefab. Source entity is invalid");
+			return;
+		}
+
+		m_Name = source.GetSceneName();
+		// The private scene has no physics, so copied colliders and rigid bodies don't create physics actors
+		m_Scene = MakeRef<Scene>("Prefab " + m_Name, sourceScene->GetSceneRenderer(), false, false);
+		m_Entity = m_Scene->CreateEntity(m_Name);
+		m_Entity.SetWorldTransform(source.GetWorldTransform());
+		PrefabCopyComponents(source, m_Entity, (const Components*)nullptr);
+		m_ComponentsMask = GetComponentsMask(m_Entity, (const Components*)nullptr);
+	}
+}
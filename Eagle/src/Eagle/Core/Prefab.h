@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Entity.h"
+
+#include <tuple>
+
+namespace Eagle
+{
+	class NativeScriptComponent;
+	class ScriptComponent;
+	class PointLightComponent;
+	class DirectionalLightComponent;
+	class SpotLightComponent;
+	class SpriteComponent;
+	class StaticMeshComponent;
+	class BillboardComponent;
+	class CameraComponent;
+	class RigidBodyComponent;
+	class BoxColliderComponent;
+	class SphereColliderComponent;
+	class CapsuleColliderComponent;
+	class MeshColliderComponent;
+	class AudioComponent;
+	class ReverbComponent;
+	class TextComponent;
+	class Text2DComponent;
+	class Image2DComponent;
+
+	// Template that's used to spawn many copies of an entity with `Scene::SpawnBatch`.
+	// Components of the source entity are copied into an entity of a private scene when the prefab is created,
+	// so the source entity can be changed or destroyed afterwards. The private scene shares the renderer of the source scene and has no physics.
+	// The set of components is recorded once, so spawning doesn't check every component type for every copy.
+	// Children of the source entity aren't a part of the prefab
+	class Prefab
+	{
+	public:
+		// Components that are copied to spawned entities, in the order they're added.
+		// The rigid body goes before colliders since physics actors are created when colliders are added
+		using Components = std::tuple<NativeScriptComponent, ScriptComponent, PointLightComponent, DirectionalLightComponent, SpotLightComponent,
+			SpriteComponent, StaticMeshComponent, BillboardComponent, CameraComponent, RigidBodyComponent,
+			BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent, MeshColliderComponent,
+			AudioComponent, ReverbComponent, TextComponent, Text2DComponent, Image2DComponent>;
+
+		Prefab(const Entity& source);
+
+		template<typename T>
+		bool HasComponent() const { return m_ComponentsMask & (1u << GetComponentIndex<T>()); }
+
+		template<typename... T>
+		bool HasAny() const { return (HasComponent<T>() || ...); }
+
+		// Entity of the private scene that holds the copied components
+		const Entity& GetEntity() const { return m_Entity; }
+		const std::string& GetName() const { return m_Name; }
+		// False if the source entity wasn't valid when the prefab was created
+		bool IsValid() const { return bool(m_Scene); }
+
+		static Ref<Prefab> Create(const Entity& source) { return MakeRef<Prefab>(source); }
+
+	private:
+		template<typename T, size_t Index = 0>
+		static constexpr uint32_t GetComponentIndex()
+		{
+			static_assert(Index < std::tuple_size_v<Components>, "Component can't be a part of a prefab");
+			if constexpr (Index >= std::tuple_size_v<Components>)
+				return 0;
+			else if constexpr (std::is_same_v<T, std::tuple_element_t<Index, Components>>)
+				return uint32_t(Index);
+			else
+				return GetComponentIndex<T, Index + 1>();
+		}
+
+	private:
+		Ref<Scene> m_Scene;
+		Entity m_Entity;
+		std::string m_Name;
+		uint32_t m_ComponentsMask = 0;
+	};
+}
@@ -2,6 +2,7 @@
 #include "Scene.h"
 
 #include "Entity.h"
+#include "Prefab.h"
 #include "Eagle/Components/Components.h"
 #include "Eagle/Core/SceneSerializer.h"
 
@@ -16,42 +17,55 @@ namespace Eagle
 {
 	namespace Utils
 	{
-		constexpr uint32_t s_SphereLinesCount = 24;
-		constexpr float s_2PI = 2.f * glm::pi<float>();
+		void WriteDebugSphere(RendererDebugShape& shape, const glm::vec3& center, const glm::vec3& color, float radius)
+		{
+			shape.Transform = glm::scale(glm::translate(glm::mat4(1.f), center), glm::vec3(radius));
+			shape.Color = color;
+			shape.Type = DebugShapeType::Sphere;
+		}
 
-		void DrawSphere(std::vector<RendererLine>& buffer, const glm::vec3& center, const glm::vec3& color, float radius)
+		void AddDebugSphere(std::vector<RendererDebugShape>& shapes, const glm::vec3& center, const glm::vec3& color, float radius)
 		{
-			for (uint32_t i = 0; i < s_SphereLinesCount; ++i)
-			{
-				const float angle1 = (float(i) / s_SphereLinesCount) * s_2PI;
-				const float angle2 = (float(i + 1) / s_SphereLinesCount) * s_2PI;
-				const float cosAngle1 = glm::cos(angle1);
-				const float cosAngle2 = glm::cos(angle2);
-				const float sinAngle1 = glm::sin(angle1);
-				const float sinAngle2 = glm::sin(angle2);
-				constexpr float cos45 = 0.707106f;
-				constexpr float cosMinus45 = -0.707106f;
-
-				auto& line = buffer.emplace_back();
-				line.Start = center + radius * glm::vec3(cosAngle1, sinAngle1, 0.f);
-				line.End = center + radius * glm::vec3(cosAngle2, sinAngle2, 0.f);
-				line.Color = color;
-
-				auto& line2 = buffer.emplace_back();
-				line2.Start = center + radius * glm::vec3(0.f, cosAngle1, sinAngle1);
-				line2.End = center + radius * glm::vec3(0.f, cosAngle2, sinAngle2);
-				line2.Color = color;
-
-				auto& line3 = buffer.emplace_back();
-				line3.Start = center + radius * glm::vec3(cos45 * sinAngle1, cosAngle1, sinAngle1 * cos45);
-				line3.End = center + radius * glm::vec3(cos45 * sinAngle2, cosAngle2, sinAngle2 * cos45);
-				line3.Color = color;
-
-				auto& line4 = buffer.emplace_back();
-				line4.Start = center + radius * glm::vec3(cosMinus45 * sinAngle1, cosAngle1, sinAngle1 * cos45);
-				line4.End = center + radius * glm::vec3(cosMinus45 * sinAngle2, cosAngle2, sinAngle2 * cos45);
-				line4.Color = color;
-			}
+			WriteDebugSphere(shapes.emplace_back(), center, color, radius);
+		}
+
+		// Writes 3 shapes. `transform` shouldn't contain scaling. Capsule's axis is X, same as PhysX's
+		void WriteDebugCapsule(RendererDebugShape* shapes, const glm::mat4& transform, const glm::vec3& color, float radius, float halfHeight)
+		{
+			auto& body = shapes[0];
+			body.Transform = glm::scale(transform, glm::vec3(halfHeight, radius, radius));
+			body.Color = color;
+			body.Type = DebugShapeType::Cylinder;
+
+			auto& top = shapes[1];
+			top.Transform = glm::scale(glm::translate(transform, glm::vec3(halfHeight, 0.f, 0.f)), glm::vec3(radius));
+			top.Color = color;
+			top.Type = DebugShapeType::Hemisphere;
+
+			// Mirrored so that the dome points towards -X
+			auto& bottom = shapes[2];
+			bottom.Transform = glm::scale(glm::translate(transform, glm::vec3(-halfHeight, 0.f, 0.f)), glm::vec3(-radius, radius, radius));
+			bottom.Color = color;
+			bottom.Type = DebugShapeType::Hemisphere;
+		}
+
+		// Cone's apex is at `location`, the base is at `location + forward * distance`
+		void AddDebugCone(std::vector<RendererDebugShape>& shapes, const glm::vec3& location, const glm::quat& rotation, const glm::vec3& forward,
+			const glm::vec3& color, float distance, float radius)
+		{
+			auto& shape = shapes.emplace_back();
+			shape.Transform[0] = glm::vec4(glm::rotate(rotation, glm::vec3(radius, 0.f, 0.f)), 0.f);
+			shape.Transform[1] = glm::vec4(glm::rotate(rotation, glm::vec3(0.f, radius, 0.f)), 0.f);
+			shape.Transform[2] = glm::vec4(forward * distance, 0.f);
+			shape.Transform[3] = glm::vec4(location, 1.f);
+			shape.Color = color;
+			shape.Type = DebugShapeType::Cone;
+		}
+
+		glm::mat4 ToUnscaledTransformMatrix(Transform transform)
+		{
+			transform.Scale3D = glm::vec3(1.f);
+			return Math::ToTransformMatrix(transform);
 		}
 	}
 
@@ -59,25 +73,53 @@ namespace Eagle
 
 	static std::unordered_map<GUID, std::function<void(const Ref<Scene>&)>> s_OnSceneOpenedCallbacks;
 
+	// Entities of `destRegistry` are expected to have the same identifiers as in `srcRegistry`, so no remapping is needed.
+	// Storage is reserved up front and all components are added before any of them is copied,
+	// so they're not relocated while copying (which would re-register observers) and can safely refer to each other's components
 	template<typename T>
-	static void SceneAddAndCopyComponent(Scene* destScene, entt::registry& destRegistry, entt::registry& srcRegistry, const std::unordered_map<entt::entity, entt::entity>& createdEntities)
+	static void SceneCopyComponentStorage(Scene* destScene, entt::registry& destRegistry, entt::registry& srcRegistry)
 	{
-		auto entities = srcRegistry.view<T>();
-		for (auto srcEntity : entities)
+		auto srcComponents = srcRegistry.view<T>();
+		destRegistry.reserve<T>(srcComponents.size());
+
+		// Reverse iteration visits components in the storage order, so the copied storage is laid out the same way
+		for (auto it = srcComponents.rbegin(); it != srcComponents.rend(); ++it)
 		{
-			auto& srcComponent = srcRegistry.get<T>(srcEntity);
-			Entity destEntity(createdEntities.at(srcEntity), destScene);
-			if (destEntity.HasComponent<T>())
-			{
-				T& comp = destEntity.GetComponent<T>();
-				comp = srcComponent;
-			}
-			else
+			Entity destEntity(*it, destScene);
+			if (!destEntity.HasComponent<T>())
+				destEntity.AddComponent<T>();
+		}
+
+		for (auto it = srcComponents.rbegin(); it != srcComponents.rend(); ++it)
+			destRegistry.get<T>(*it) = srcRegistry.get<T>(*it);
+	}
+
+	// `writeShapes(collider, shapes)` writes `ShapesPerCollider` shapes of a collider
+	template<uint32_t ShapesPerCollider, typename T, typename Func>
+	static void UpdateColliderDebugShapes(entt::registry& registry, ColliderDebugShapes<T>& debugShapes, Func&& writeShapes)
+	{
+		if (debugShapes.bDirty)
+		{
+			debugShapes.Visible.Clear();
+			for (auto entity : registry.view<T>())
 			{
-				T& comp = destEntity.AddComponent<T>();
-				comp = srcComponent;
+				const T& collider = registry.get<T>(entity);
+				if (collider.IsCollisionVisible())
+					debugShapes.Visible.Add(&collider);
 			}
+
+			const auto& colliders = debugShapes.Visible.GetComponents();
+			debugShapes.Shapes.resize(colliders.size() * ShapesPerCollider);
+			for (size_t i = 0; i < colliders.size(); ++i)
+				writeShapes(*colliders[i], &debugShapes.Shapes[i * ShapesPerCollider]);
+			debugShapes.bDirty = false;
 		}
+		else
+		{
+			for (const T* collider : debugShapes.Changed)
+				writeShapes(*collider, &debugShapes.Shapes[size_t(debugShapes.Visible.GetIndex(collider)) * ShapesPerCollider]);
+		}
+		debugShapes.Changed.Clear();
 	}
 
 	template<typename T>
@@ -92,7 +134,25 @@ namespace Eagle
 		}
 	}
 
-	Scene::Scene(const std::string& debugName, const Ref<SceneRenderer>& sceneRenderer, bool bRuntime)
+	template<typename T>
+	static void SceneSpawnComponents(const Prefab& prefab, entt::registry& registry, std::vector<Entity>& entities)
+	{
+		if (!prefab.HasComponent<T>())
+			return;
+
+		registry.reserve<T>(registry.view<T>().size() + entities.size());
+		const T& source = prefab.GetEntity().GetComponent<T>();
+		for (Entity& entity : entities)
+			entity.AddComponent<T>() = source;
+	}
+
+	template<typename... T>
+	static void SceneSpawnPrefabComponents(const Prefab& prefab, entt::registry& registry, std::vector<Entity>& entities, const std::tuple<T...>*)
+	{
+		(SceneSpawnComponents<T>(prefab, registry, entities), ...);
+	}
+
+	Scene::Scene(const std::string& debugName, const Ref<SceneRenderer>& sceneRenderer, bool bRuntime, bool bWithPhysics)
 		: m_DebugName(debugName)
 	{
 		if (sceneRenderer)
@@ -101,6 +161,9 @@ namespace Eagle
 			m_SceneRenderer = MakeRef<SceneRenderer>(glm::uvec2{ m_ViewportWidth, m_ViewportHeight });
 		ConnectSignals();
 
+		if (!bWithPhysics)
+			return;
+
 		m_RuntimePhysicsScene = MakeRef<PhysicsScene>(PhysicsSettings());
 		if (bRuntime)
 		{
@@ -123,7 +186,6 @@ namespace Eagle
 	: bCanUpdateEditorCamera(other->bCanUpdateEditorCamera)
 	, m_PhysicsScene(other->m_RuntimePhysicsScene)
 	, m_EditorCamera(other->m_EditorCamera)
-	, m_EntitiesToDestroy(other->m_EntitiesToDestroy)
 	, m_ViewportWidth(other->m_ViewportWidth)
 	, m_ViewportHeight(other->m_ViewportHeight)
 	, m_DebugName(debugName)
@@ -131,46 +193,58 @@ namespace Eagle
 		// Reuse renderer so that we don't allocate additional GPU resources
 		m_SceneRenderer = other->m_SceneRenderer;
 
-		std::unordered_map<entt::entity, entt::entity> createdEntities;
-		createdEntities.reserve(other->m_Registry.size());
-		for (auto entt : other->m_Registry.view<TransformComponent>())
-		{
-			const std::string& sceneName = other->m_Registry.get<EntitySceneNameComponent>(entt).Name;
-			const GUID& guid  = other->m_Registry.get<IDComponent>(entt).ID;
-			Entity entity = CreateEntityWithGUID(guid, sceneName);
-			createdEntities[entt] = entity.GetEnttID();
-		}
+		EG_CPU_TIMING_SCOPED("Scene. Copy");
+
+		// The entity storage is copied as is, so entities keep their identifiers and the free list
+		entt::registry& srcRegistry = other->m_Registry;
+		m_Registry.assign(srcRegistry.data(), srcRegistry.data() + srcRegistry.size(), srcRegistry.destroyed());
 
-		SceneAddAndCopyComponent<TransformComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<OwnershipComponent>(this, m_Registry, other->m_Registry, createdEntities);
-
-		SceneAddAndCopyComponent<NativeScriptComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<ScriptComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<PointLightComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<DirectionalLightComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<SpotLightComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<SpriteComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<StaticMeshComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<BillboardComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<CameraComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<RigidBodyComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<BoxColliderComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<SphereColliderComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<CapsuleColliderComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<MeshColliderComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<AudioComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<ReverbComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<TextComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<Text2DComponent>(this, m_Registry, other->m_Registry, createdEntities);
-		SceneAddAndCopyComponent<Image2DComponent>(this, m_Registry, other->m_Registry, createdEntities);
-
-		for (auto entt : m_Registry.view<RigidBodyComponent>())
+		auto srcEntities = srcRegistry.view<TransformComponent>();
+		const size_t entitiesCount = srcEntities.size();
+		m_Registry.reserve<IDComponent, EntitySceneNameComponent, TransformComponent, OwnershipComponent, ComponentObservers>(entitiesCount);
+		m_AliveEntities.Reserve(entitiesCount);
+		for (auto it = srcEntities.rbegin(); it != srcEntities.rend(); ++it)
 		{
-			Entity entity{entt, this};
-			if (!entity.HasAny<BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent, MeshColliderComponent>())
-				m_PhysicsScene->CreatePhysicsActor(entity);
+			const GUID& guid = srcRegistry.get<IDComponent>(*it).ID;
+			Entity entity(*it, this);
+			entity.AddComponent<IDComponent>(guid);
+			entity.AddComponent<EntitySceneNameComponent>(srcRegistry.get<EntitySceneNameComponent>(*it).Name);
+			entity.AddComponent<TransformComponent>();
+			entity.AddComponent<OwnershipComponent>();
+			m_AliveEntities.Insert(guid, *it);
 		}
 
+		// Entities keep their identifiers, so pending destructions are carried over to this scene
+		m_EntitiesToDestroy.reserve(other->m_EntitiesToDestroy.size());
+		for (const Entity& entity : other->m_EntitiesToDestroy)
+			m_EntitiesToDestroy.emplace_back(entity.GetEnttID(), this);
+
+		// Colliders create their actors when they're copied
+		m_PhysicsScene->BeginActorsBatch();
+		SceneCopyComponentStorage<TransformComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<OwnershipComponent>(this, m_Registry, srcRegistry);
+
+		SceneCopyComponentStorage<NativeScriptComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<ScriptComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<PointLightComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<DirectionalLightComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<SpotLightComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<SpriteComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<StaticMeshComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<BillboardComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<CameraComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<RigidBodyComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<BoxColliderComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<SphereColliderComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<CapsuleColliderComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<MeshColliderComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<AudioComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<ReverbComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<TextComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<Text2DComponent>(this, m_Registry, srcRegistry);
+		SceneCopyComponentStorage<Image2DComponent>(this, m_Registry, srcRegistry);
+		m_PhysicsScene->EndActorsBatch();
+
 		ConnectSignals();
 		m_DirtyFlags.SetEverythingDirty(true);
 	}
@@ -195,7 +269,7 @@ namespace Eagle
 		entity.AddComponent<TransformComponent>();
 		entity.AddComponent<OwnershipComponent>();
 
-		m_AliveEntities[guid] = entity;
+		m_AliveEntities.Insert(guid, entity.GetEnttID());
 
 		return entity;
 	}
@@ -236,6 +310,43 @@ namespace Eagle
 		return result;
 	}
 
+	std::vector<Entity> Scene::SpawnBatch(const Prefab& prefab, const std::vector<Transform>& transforms)
+	{
+		EG_CPU_TIMING_SCOPED("Scene. Spawn Batch");
+
+		if (!prefab.IsValid())
+		{
+			EG_CORE_ERROR("Failed to spawn '{}'. Prefab is invalid", prefab.GetName());
+			return {};
+		}
+
+		const size_t count = transforms.size();
+		std::vector<Entity> entities;
+		entities.reserve(count);
+
+		const size_t entitiesCount = m_AliveEntities.Size() + count;
+		m_Registry.reserve<IDComponent, EntitySceneNameComponent, TransformComponent, OwnershipComponent, ComponentObservers>(entitiesCount);
+		m_AliveEntities.Reserve(entitiesCount);
+		for (const Transform& transform : transforms)
+		{
+			Entity& entity = entities.emplace_back(CreateEntityWithGUID(GUID(), prefab.GetName()));
+
+			// Set before the components are added, so that physics actors are created in place
+			entity.SetWorldTransform(transform);
+		}
+
+		m_PhysicsScene->BeginActorsBatch();
+		SceneSpawnPrefabComponents(prefab, m_Registry, entities, (const Prefab::Components*)nullptr);
+
+		// Bodies without colliders need their actors to be created explicitly
+		if (prefab.HasComponent<RigidBodyComponent>() && !prefab.HasAny<BoxColliderComponent, SphereColliderComponent, CapsuleColliderComponent, MeshColliderComponent>())
+			for (Entity& entity : entities)
+				m_PhysicsScene->CreatePhysicsActor(entity);
+		m_PhysicsScene->EndActorsBatch();
+
+		return entities;
+	}
+
 	void Scene::DestroyEntity(Entity entity)
 	{
 		if (bIsPlaying)
@@ -257,6 +368,13 @@ namespace Eagle
 		// EG_EDITOR_TRACE("Destroyed Entity: {}", entity.GetComponent<EntitySceneNameComponent>().Name);
 	}
 
+	void Scene::DestroyEntities(const std::vector<Entity>& entities)
+	{
+		m_EntitiesToDestroy.reserve(m_EntitiesToDestroy.size() + entities.size());
+		for (const Entity& entity : entities)
+			DestroyEntity(entity);
+	}
+
 	void Scene::OnUpdate(Timestep ts, bool bRender)
 	{
 		if (bIsPlaying)
@@ -269,7 +387,6 @@ namespace Eagle
 	{
 		auto func = [path, bReuseCurrentSceneRenderer, bRuntime]()
 		{
-			ComponentsNotificationSystem::ResetSystem();
 			ScriptEngine::Reset();
 			RenderManager::Wait();
 			Ref<Scene> scene = MakeRef<Scene>(path.u8string(), (bReuseCurrentSceneRenderer && s_CurrentScene) ? s_CurrentScene->GetSceneRenderer() : nullptr, bRuntime);
@@ -305,7 +422,9 @@ namespace Eagle
 		DestroyPendingEntities();
 
 		m_EditorCamera.OnUpdate(ts, bCanUpdateEditorCamera);
+		ResolveTransforms();
 		m_PhysicsScene->Simulate(ts, false);
+		ResolveTransforms();
 		
 		if (bRender) [[likely]]
 			RenderScene();
@@ -315,6 +434,7 @@ namespace Eagle
 	{	
 		DestroyPendingEntities();
 		UpdateScripts(ts);
+		ResolveTransforms();
 
 		m_RuntimeCamera = FindOrCreateRuntimeCamera();
 		if (!m_RuntimeCamera->FixedAspectRatio)
@@ -326,6 +446,7 @@ namespace Eagle
 		AudioEngine::SetListenerData(m_RuntimeCamera->GetWorldTransform().Location, -m_RuntimeCamera->GetForwardVector(), m_RuntimeCamera->GetUpVector());
 
 		m_PhysicsScene->Simulate(ts, true);
+		ResolveTransforms();
 
 		if (bRender) [[likely]]
 			RenderScene();
@@ -338,8 +459,9 @@ namespace Eagle
 		if (m_DirtyFlags.bPointLightsDirty)
 		{
 			auto view = m_Registry.view<PointLightComponent>();
-			m_PointLights.clear();
-			m_PointLightsDebugRadii.clear();
+			m_PointLights.Clear();
+			m_DirtyPointLights.Clear(); // All lights are resent
+			m_PointLightsDebugRadii.Clear();
 			m_PointLightsDebugRadiiDirty = true;
 
 			for (auto entity : view)
@@ -347,9 +469,9 @@ namespace Eagle
 				auto& component = view.get<PointLightComponent>(entity);
 				if (component.DoesAffectWorld())
 				{
-					m_PointLights.push_back(&component);
+					m_PointLights.Add(&component);
 					if (component.VisualizeRadiusEnabled())
-						m_PointLightsDebugRadii.emplace(&component);
+						m_PointLightsDebugRadii.Add(&component);
 				}
 			}
 		}
@@ -372,8 +494,9 @@ namespace Eagle
 		if (m_DirtyFlags.bSpotLightsDirty)
 		{
 			auto view = m_Registry.view<SpotLightComponent>();
-			m_SpotLights.clear();
-			m_SpotLightsDebugRadii.clear();
+			m_SpotLights.Clear();
+			m_DirtySpotLights.Clear();
+			m_SpotLightsDebugRadii.Clear();
 			m_SpotLightsDebugRadiiDirty = true;
 
 			for (auto entity : view)
@@ -381,9 +504,9 @@ namespace Eagle
 				auto& component = view.get<SpotLightComponent>(entity);
 				if (component.DoesAffectWorld())
 				{
-					m_SpotLights.push_back(&component);
+					m_SpotLights.Add(&component);
 					if (component.VisualizeDistanceEnabled())
-						m_SpotLightsDebugRadii.emplace(&component);
+						m_SpotLightsDebugRadii.Add(&component);
 				}
 			}
 		}
@@ -393,26 +516,80 @@ namespace Eagle
 	{
 		EG_CPU_TIMING_SCOPED("Scene. Destroy Pending Entities");
 
+		if (m_EntitiesToDestroy.empty())
+			return;
+
 		//Remove entities when a new frame begins
-		for (auto& entity : m_EntitiesToDestroy)
+		// Sorted so that the same entity can be requested several times and it can be quickly checked if an entity is being destroyed
+		std::vector<entt::entity> entities;
+		entities.reserve(m_EntitiesToDestroy.size());
+		for (const Entity& entity : m_EntitiesToDestroy)
+			if (m_Registry.valid(entity.GetEnttID()))
+				entities.push_back(entity.GetEnttID());
+		m_EntitiesToDestroy.clear();
+
+		std::sort(entities.begin(), entities.end());
+		entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+		auto isDestroyed = [&entities](const Entity& entity)
+		{
+			return std::binary_search(entities.begin(), entities.end(), entity.GetEnttID());
+		};
+
+		// Children are reparented using the current world transforms
+		ResolveTransforms();
+
+		std::vector<Ref<PhysicsActor>> actors;
+		std::vector<Entity> parents; // Parents that are not destroyed. Destroyed entities are removed from their children
+		for (entt::entity e : entities)
 		{
+			Entity entity(e, this);
 			ScriptEngine::RemoveEntityScript(entity);
-			auto& actor = entity.GetPhysicsActor();
-			if (actor)
-				m_PhysicsScene->RemovePhysicsActor(actor);
+			if (const auto& actor = entity.GetPhysicsActor())
+				actors.push_back(actor);
 
 			auto& ownershipComponent = entity.GetComponent<OwnershipComponent>();
-			std::vector<Entity> children = ownershipComponent.Children; // Copy
-			Entity myParent = ownershipComponent.EntityParent;
-			entity.SetParent(Entity::Null);
+			if (ownershipComponent.EntityParent && !isDestroyed(ownershipComponent.EntityParent))
+				parents.push_back(ownershipComponent.EntityParent);
+
+			if (ownershipComponent.Children.empty())
+				continue;
+
+			// Children that stay alive are attached to the closest ancestor that stays alive
+			Entity newParent = ownershipComponent.EntityParent;
+			while (newParent && isDestroyed(newParent))
+				newParent = newParent.GetParent();
 
-			for (size_t i = 0; i < children.size(); ++i)
-				children[i].SetParent(myParent);
+			std::vector<Entity> children = std::move(ownershipComponent.Children);
+			ownershipComponent.Children.clear();
+			for (Entity& child : children)
+			{
+				if (isDestroyed(child))
+					continue;
 
-			m_AliveEntities.erase(entity.GetGUID());
-			m_Registry.destroy(entity.GetEnttID());
+				// The destroyed parent has already forgotten its children, so there's nothing to detach from
+				child.GetComponent<OwnershipComponent>().EntityParent = Entity::Null;
+				child.SetParent(newParent);
+			}
 		}
-		m_EntitiesToDestroy.clear();
+
+		// Destroyed children are removed with a single pass over each parent's children
+		std::sort(parents.begin(), parents.end(), [](const Entity& a, const Entity& b) { return a.GetEnttID() < b.GetEnttID(); });
+		parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+		for (Entity& parent : parents)
+		{
+			auto& children = parent.GetComponent<OwnershipComponent>().Children;
+			children.erase(std::remove_if(children.begin(), children.end(), isDestroyed), children.end());
+		}
+		m_TransformSystem.OnHierarchyChanged();
+
+		if (m_PhysicsScene)
+			m_PhysicsScene->RemovePhysicsActors(actors);
+
+		for (entt::entity e : entities)
+			m_AliveEntities.Erase(m_Registry.get<IDComponent>(e).ID);
+
+		// Components are removed storage by storage rather than entity by entity
+		m_Registry.destroy(entities.begin(), entities.end());
 	}
 
 	void Scene::UpdateScripts(Timestep ts)
@@ -452,6 +629,9 @@ namespace Eagle
 
 	CameraComponent* Scene::FindOrCreateRuntimeCamera()
 	{
+		if (m_RuntimeCamera && !m_bRuntimeCameraDirty)
+			return m_RuntimeCamera;
+
 		EG_CPU_TIMING_SCOPED("Scene. Find or Create runtime camera");
 
 		CameraComponent* camera = nullptr;
@@ -461,7 +641,7 @@ namespace Eagle
 		{
 			auto& cameraComponent = view.get<CameraComponent>(entity);
 
-			if (cameraComponent.Primary)
+			if (cameraComponent.IsPrimary())
 			{
 				camera = &cameraComponent;
 				break;
@@ -480,12 +660,13 @@ namespace Eagle
 
 				auto& cameraComp = m_RuntimeCameraHolder->AddComponent<CameraComponent>();
 				cameraComp.Camera = m_EditorCamera;
-				cameraComp.Primary = true;
+				cameraComp.SetPrimary(true);
 				cameraComp.SetWorldTransform(m_EditorCamera.GetTransform());
 			}
 			camera = &m_RuntimeCameraHolder->GetComponent<CameraComponent>();
 		}
 
+		m_bRuntimeCameraDirty = false;
 		return camera;
 	}
 
@@ -499,23 +680,30 @@ namespace Eagle
 		// Since meshes are going to be fully updated anyway
 		if (m_DirtyFlags.bMeshTransformsDirty && !m_DirtyFlags.bMeshesDirty)
 		{
-			m_SceneRenderer->UpdateMeshesTransforms(m_DirtyTransformMeshes);
+			m_SceneRenderer->UpdateMeshesTransforms(m_DirtyTransformMeshes.GetComponents());
 		}
-		m_DirtyTransformMeshes.clear();
+		m_DirtyTransformMeshes.Clear();
 
 		// Same for sprites
 		if (m_DirtyFlags.bSpriteTransformsDirty && !m_DirtyFlags.bSpritesDirty)
 		{
-			m_SceneRenderer->UpdateSpritesTransforms(m_DirtyTransformSprites);
+			m_SceneRenderer->UpdateSpritesTransforms(m_DirtyTransformSprites.GetComponents());
 		}
-		m_DirtyTransformSprites.clear();
+		m_DirtyTransformSprites.Clear();
 
 		// Same for texts
 		if (m_DirtyFlags.bTextTransformsDirty && !m_DirtyFlags.bTextDirty)
 		{
-			m_SceneRenderer->UpdateTextsTransforms(m_DirtyTransformTexts);
+			m_SceneRenderer->UpdateTextsTransforms(m_DirtyTransformTexts.GetComponents());
 		}
-		m_DirtyTransformTexts.clear();
+		m_DirtyTransformTexts.Clear();
+
+		// Same for billboards
+		if (m_DirtyFlags.bBillboardTransformsDirty && !m_DirtyFlags.bBillboardsDirty)
+		{
+			m_SceneRenderer->UpdateBillboardsTransforms(m_DirtyTransformBillboards.GetComponents());
+		}
+		m_DirtyTransformBillboards.Clear();
 
 		if (m_DirtyFlags.bMeshesDirty)
 		{
@@ -538,7 +726,7 @@ namespace Eagle
 			}
 		}
 
-		// Gather billboards
+		if (m_DirtyFlags.bBillboardsDirty)
 		{
 			auto view = m_Registry.view<BillboardComponent>();
 			m_Billboards.clear();
@@ -554,12 +742,12 @@ namespace Eagle
 			// Debug point lights attenuation radii
 			if (m_PointLightsDebugRadiiDirty)
 			{
-				m_DebugPointLines.clear();
+				m_DebugPointShapes.clear();
 				for (auto& light : m_PointLightsDebugRadii)
 				{
 					const glm::vec3& center = light->GetWorldTransform().Location;
 					const float radius = light->GetRadius();
-					Utils::DrawSphere(m_DebugPointLines, center, glm::vec3(0, 1, 0), radius);
+					Utils::AddDebugSphere(m_DebugPointShapes, center, glm::vec3(0, 1, 0), radius);
 				}
 				m_PointLightsDebugRadiiDirty = false;
 			}
@@ -567,60 +755,72 @@ namespace Eagle
 			// Debug spot lights attenuation distance
 			if (m_SpotLightsDebugRadiiDirty)
 			{
-				m_DebugSpotLines.clear();
+				m_DebugSpotShapes.clear();
 				for (auto& light : m_SpotLightsDebugRadii)
 				{
 					const glm::vec3& location = light->GetWorldTransform().Location;
-					const float distance = light->GetDistance();
-					const glm::vec3 center = location + light->GetForwardVector() * distance;
 					const glm::quat quat = light->GetWorldTransform().Rotation.GetQuat();
+					const glm::vec3 forward = light->GetForwardVector();
+					const float distance = light->GetDistance();
 					const float innerRadius = distance * glm::tan(glm::radians(light->GetInnerCutOffAngle()));
 					const float outerRadius = distance * glm::tan(glm::radians(light->GetOuterCutOffAngle()));
 
-					for (uint32_t i = 0; i < Utils::s_SphereLinesCount; ++i)
-					{
-						const float angle1 = (float(i) / Utils::s_SphereLinesCount) * Utils::s_2PI;
-						const float angle2 = (float(i + 1) / Utils::s_SphereLinesCount) * Utils::s_2PI;
-						const float cosAngle1 = glm::cos(angle1);
-						const float cosAngle2 = glm::cos(angle2);
-						const float sinAngle1 = glm::sin(angle1);
-						const float sinAngle2 = glm::sin(angle2);
-
-						auto& innerCircleLine = m_DebugSpotLines.emplace_back();
-						innerCircleLine.Start = center + glm::rotate(quat, innerRadius * glm::vec3(cosAngle1, sinAngle1, 0.f));
-						innerCircleLine.End = center + glm::rotate(quat, innerRadius * glm::vec3(cosAngle2, sinAngle2, 0.f));
-
-						auto& toInnerLine = m_DebugSpotLines.emplace_back();
-						toInnerLine.Start = location;
-						toInnerLine.End = innerCircleLine.Start;
-
-						auto& outerCircleLine = m_DebugSpotLines.emplace_back();
-						outerCircleLine.Start = center + glm::rotate(quat, outerRadius * glm::vec3(cosAngle1, sinAngle1, 0.f));
-						outerCircleLine.End = center + glm::rotate(quat, outerRadius * glm::vec3(cosAngle2, sinAngle2, 0.f));
-						outerCircleLine.Color = glm::vec3(0.75, 0.75f, 0.f);
-
-						auto& toOuterLine = m_DebugSpotLines.emplace_back();
-						toOuterLine.Start = location;
-						toOuterLine.End = outerCircleLine.Start;
-						toOuterLine.Color = glm::vec3(0.75, 0.75f, 0.f);
-					}
+					Utils::AddDebugCone(m_DebugSpotShapes, location, quat, forward, glm::vec3(0, 1, 0), distance, innerRadius);
+					Utils::AddDebugCone(m_DebugSpotShapes, location, quat, forward, glm::vec3(0.75, 0.75f, 0.f), distance, outerRadius);
 				}
 				m_SpotLightsDebugRadiiDirty = false;
 			}
 
-			// Debug spot lights attenuation distance
+			// Debug reverb radii
 			if (m_ReverbDebugBoxesDirty)
 			{
-				m_DebugReverbLines.clear();
+				m_DebugReverbShapes.clear();
 				for (auto& reverb : m_ReverbDebugBoxes)
 				{
 					const glm::vec3& center = reverb->GetReverb()->GetPosition();
-					Utils::DrawSphere(m_DebugReverbLines, center, glm::vec3(0, 1, 0), reverb->GetMinDistance());
-					Utils::DrawSphere(m_DebugReverbLines, center, glm::vec3(1, 0, 0), reverb->GetMaxDistance());
+					Utils::AddDebugSphere(m_DebugReverbShapes, center, glm::vec3(0, 1, 0), reverb->GetMinDistance());
+					Utils::AddDebugSphere(m_DebugReverbShapes, center, glm::vec3(1, 0, 0), reverb->GetMaxDistance());
 				}
 				m_ReverbDebugBoxesDirty = false;
 			}
 
+			// Primitive colliders
+			{
+				const glm::vec3 collisionColor = glm::vec3(0.f, 1.f, 0.f);
+				UpdateColliderDebugShapes<1>(m_Registry, m_BoxColliderShapes, [&collisionColor](const BoxColliderComponent& collider, RendererDebugShape* shapes)
+				{
+					const Transform& worldTransform = collider.GetWorldTransform();
+					shapes->Transform = glm::scale(Utils::ToUnscaledTransformMatrix(worldTransform), worldTransform.Scale3D * collider.GetSize());
+					shapes->Color = collisionColor;
+					shapes->Type = DebugShapeType::Box;
+				});
+
+				UpdateColliderDebugShapes<1>(m_Registry, m_SphereColliderShapes, [&collisionColor](const SphereColliderComponent& collider, RendererDebugShape* shapes)
+				{
+					const Transform& worldTransform = collider.GetWorldTransform();
+					const glm::vec3& scale = worldTransform.Scale3D;
+					const float radius = glm::max(scale.x, glm::max(scale.y, scale.z)) * collider.GetRadius();
+					Utils::WriteDebugSphere(*shapes, worldTransform.Location, collisionColor, radius);
+				});
+
+				UpdateColliderDebugShapes<3>(m_Registry, m_CapsuleColliderShapes, [&collisionColor](const CapsuleColliderComponent& collider, RendererDebugShape* shapes)
+				{
+					const Transform& worldTransform = collider.GetWorldTransform();
+					const glm::vec3& scale = worldTransform.Scale3D;
+					const float radius = glm::max(scale.x, scale.z) * collider.GetRadius();
+					const float halfHeight = collider.GetHeight() * 0.5f * scale.y;
+					Utils::WriteDebugCapsule(shapes, Utils::ToUnscaledTransformMatrix(worldTransform), collisionColor, radius, halfHeight);
+				});
+			}
+
+			// Only cached shapes are appended every frame
+			m_DebugShapesToDraw.clear();
+			m_DebugShapesToDraw.reserve(m_DebugPointShapes.size() + m_DebugSpotShapes.size() + m_DebugReverbShapes.size() +
+				m_BoxColliderShapes.Shapes.size() + m_SphereColliderShapes.Shapes.size() + m_CapsuleColliderShapes.Shapes.size());
+			for (const auto* shapes : { &m_DebugPointShapes, &m_DebugSpotShapes, &m_DebugReverbShapes,
+				&m_BoxColliderShapes.Shapes, &m_SphereColliderShapes.Shapes, &m_CapsuleColliderShapes.Shapes })
+				m_DebugShapesToDraw.insert(m_DebugShapesToDraw.end(), shapes->begin(), shapes->end());
+
 			auto& rb = m_PhysicsScene->GetRenderBuffer();
 			const uint32_t debugCollisionsLinesSize = rb.getNbLines();
 
@@ -630,10 +830,7 @@ namespace Eagle
 			debugDirLightLinesCount = dirLightsView.size() * linesPerDirLight;
 
 			m_DebugLinesToDraw.clear();
-			m_DebugLinesToDraw.reserve(debugCollisionsLinesSize + m_DebugPointLines.size() + m_DebugSpotLines.size() + m_DebugReverbLines.size() + m_UserDebugLines.size() + debugDirLightLinesCount);
-			m_DebugLinesToDraw = m_DebugPointLines;
-			m_DebugLinesToDraw.insert(m_DebugLinesToDraw.end(), m_DebugSpotLines.begin(), m_DebugSpotLines.end());
-			m_DebugLinesToDraw.insert(m_DebugLinesToDraw.end(), m_DebugReverbLines.begin(), m_DebugReverbLines.end());
+			m_DebugLinesToDraw.reserve(debugCollisionsLinesSize + m_UserDebugLines.size() + debugDirLightLinesCount);
 
 			for (auto entity : dirLightsView)
 			{
@@ -684,6 +881,7 @@ namespace Eagle
 		{
 			auto view = m_Registry.view<TextComponent>();
 			m_Texts.clear();
+			m_DirtyTexts.Clear(); // All texts are resent
 
 			for (auto entity : view)
 			{
@@ -697,6 +895,7 @@ namespace Eagle
 		{
 			auto view = m_Registry.view<Text2DComponent>();
 			m_Texts2D.clear();
+			m_DirtyTexts2D.Clear();
 
 			for (auto entity : view)
 			{
@@ -721,43 +920,65 @@ namespace Eagle
 		}
 
 		const Camera* camera = bIsPlaying ? (Camera*)&m_RuntimeCamera->Camera : (Camera*)&m_EditorCamera;
-		m_SceneRenderer->SetPointLights(m_PointLights, m_DirtyFlags.bPointLightsDirty);
-		m_SceneRenderer->SetSpotLights(m_SpotLights, m_DirtyFlags.bSpotLightsDirty);
+		m_SceneRenderer->SetPointLights(m_PointLights.GetComponents(), m_DirtyFlags.bPointLightsDirty);
+		m_SceneRenderer->SetSpotLights(m_SpotLights.GetComponents(), m_DirtyFlags.bSpotLightsDirty);
+		m_SceneRenderer->UpdatePointLights(m_DirtyPointLights.GetComponents());
+		m_SceneRenderer->UpdateSpotLights(m_DirtySpotLights.GetComponents());
+		m_DirtyPointLights.Clear();
+		m_DirtySpotLights.Clear();
 		m_SceneRenderer->SetDirectionalLight(m_DirectionalLight);
 		m_SceneRenderer->SetMeshes(m_Meshes, m_DirtyFlags.bMeshesDirty);
 		m_SceneRenderer->SetSprites(m_Sprites, m_DirtyFlags.bSpritesDirty);
 		m_SceneRenderer->SetDebugLines(m_DebugLinesToDraw);
-		m_SceneRenderer->SetBillboards(m_Billboards);
+		m_SceneRenderer->SetDebugShapes(m_DebugShapesToDraw);
+		m_SceneRenderer->SetBillboards(m_Billboards, m_DirtyFlags.bBillboardsDirty);
 		m_SceneRenderer->SetTexts(m_Texts, m_DirtyFlags.bTextDirty);
 		m_SceneRenderer->SetTexts2D(m_Texts2D, m_DirtyFlags.bText2DDirty);
+		m_SceneRenderer->UpdateTexts(m_DirtyTexts.GetComponents());
+		m_SceneRenderer->UpdateTexts2D(m_DirtyTexts2D.GetComponents());
+		m_DirtyTexts.Clear();
+		m_DirtyTexts2D.Clear();
 		m_SceneRenderer->SetImages2D(m_Images2D, m_DirtyFlags.bImage2DDirty);
 		m_SceneRenderer->SetIsRuntime(bIsPlaying);
 
 		const bool bDrawEditorHelpers = !bIsPlaying && bDrawMiscellaneous;
 		m_SceneRenderer->SetGridEnabled(bDrawEditorHelpers);
 
-		// Add engine billboards if necessary
-		if (bDrawEditorHelpers)
+		// Update engine billboards if necessary. They're kept by the renderer, so they're only resent when lights change
 		{
-			Transform transform;
-			transform.Scale3D = glm::vec3(0.25f);
-			for (auto& point : m_PointLights)
+			const glm::vec3 dirLightLocation = m_DirectionalLight ? m_DirectionalLight->GetWorldTransform().Location : glm::vec3(0.f);
+			const bool bDirLightChanged = m_DirectionalLight != m_DirectionalLightIcon || dirLightLocation != m_DirectionalLightIconLocation;
+			const bool bLightsChanged = m_DirtyFlags.bPointLightsDirty || m_DirtyFlags.bSpotLightsDirty || m_DirtyFlags.bLightTransformsDirty || bDirLightChanged;
+			if (m_DirtyFlags.bLightIconsDirty || bDrawEditorHelpers != m_bLightIconsVisible || (bDrawEditorHelpers && bLightsChanged))
 			{
-				transform.Location = point->GetWorldTransform().Location;
-				m_SceneRenderer->AddAdditionalBillboard(transform, Texture2D::PointLightIcon, (int)point->Parent.GetID());
-			}
-			for (auto& spot : m_SpotLights)
-			{
-				transform = spot->GetWorldTransform();
-				transform.Scale3D = glm::vec3(0.25f);
+				std::vector<RenderBillboardsTask::AdditionalBillboard> icons;
+				if (bDrawEditorHelpers)
+				{
+					icons.reserve(m_PointLights.Size() + m_SpotLights.Size() + 1);
 
-				m_SceneRenderer->AddAdditionalBillboard(transform, Texture2D::SpotLightIcon, (int)spot->Parent.GetID());
-			}
-			if (m_DirectionalLight)
-			{
-				transform = m_DirectionalLight->GetWorldTransform();
-				transform.Scale3D = glm::vec3(0.25f);
-				m_SceneRenderer->AddAdditionalBillboard(transform, Texture2D::DirectionalLightIcon, (int)m_DirectionalLight->Parent.GetID());
+					Transform transform;
+					transform.Scale3D = glm::vec3(0.25f);
+					for (auto& point : m_PointLights)
+					{
+						transform.Location = point->GetWorldTransform().Location;
+						icons.push_back({ transform, Texture2D::PointLightIcon, (int)point->Parent.GetID() });
+					}
+					for (auto& spot : m_SpotLights)
+					{
+						transform.Location = spot->GetWorldTransform().Location;
+						icons.push_back({ transform, Texture2D::SpotLightIcon, (int)spot->Parent.GetID() });
+					}
+					if (m_DirectionalLight)
+					{
+						transform.Location = dirLightLocation;
+						icons.push_back({ transform, Texture2D::DirectionalLightIcon, (int)m_DirectionalLight->Parent.GetID() });
+					}
+				}
+				m_SceneRenderer->SetAdditionalBillboards(std::move(icons));
+
+				m_DirectionalLightIcon = m_DirectionalLight;
+				m_DirectionalLightIconLocation = dirLightLocation;
+				m_bLightIconsVisible = bDrawEditorHelpers;
 			}
 		}
 
@@ -772,7 +993,21 @@ namespace Eagle
 	{
 		EG_EDITOR_TRACE("Runtime started");
 
+		EG_CPU_TIMING_SCOPED("Scene. Runtime Start");
+
 		bIsPlaying = true;
+
+		// Bodies without colliders don't get their actors when the scene is copied
+		{
+			m_PhysicsScene->BeginActorsBatch();
+			for (auto entt : m_Registry.view<RigidBodyComponent>())
+			{
+				Entity entity{ entt, this };
+				if (!m_PhysicsScene->GetPhysicsActor(entity))
+					m_PhysicsScene->CreatePhysicsActor(entity);
+			}
+			m_PhysicsScene->EndActorsBatch();
+		}
 		
 		// Update C# scripts
 		{
@@ -930,6 +1165,8 @@ namespace Eagle
 
 		m_PhysicsScene.reset();
 		m_Registry.clear();
+		m_AliveEntities.Clear();
+		m_TransformSystem.Reset();
 		m_SpawnedSounds.clear();
 	}
 
@@ -940,7 +1177,7 @@ namespace Eagle
 		for (auto entityID : view)
 		{
 			auto& cameraComponent = view.get<CameraComponent>(entityID);
-			if (cameraComponent.Primary)
+			if (cameraComponent.IsPrimary())
 			{
 				return Entity{entityID, this};
 			}
@@ -973,18 +1210,36 @@ namespace Eagle
 
 	Entity Scene::GetEntityByGUID(const GUID& guid) const
 	{
-		auto it = m_AliveEntities.find(guid);
-		return it != m_AliveEntities.end() ? it->second : Entity::Null;
+		const entt::entity* entity = m_AliveEntities.Find(guid);
+		return entity ? Entity(*entity, const_cast<Scene*>(this)) : Entity::Null;
+	}
+
+	EntityHandle Scene::GetEntityHandle(const GUID& guid) const
+	{
+		const entt::entity* entity = m_AliveEntities.Find(guid);
+		return entity ? EntityHandle{ *entity } : EntityHandle{};
+	}
+
+	Entity Scene::GetEntityByHandle(EntityHandle handle) const
+	{
+		return IsHandleValid(handle) ? Entity(handle.Handle, const_cast<Scene*>(this)) : Entity::Null;
 	}
 
 	const Ref<PhysicsActor>& Scene::GetPhysicsActor(const Entity& entity) const
 	{
-		return m_PhysicsScene->GetPhysicsActor(entity);
+		static const Ref<PhysicsActor> s_NoActor;
+		return m_PhysicsScene ? m_PhysicsScene->GetPhysicsActor(entity) : s_NoActor;
 	}
 
 	Ref<PhysicsActor>& Scene::GetPhysicsActor(const Entity& entity)
 	{
-		return m_PhysicsScene->GetPhysicsActor(entity);
+		// Reset in case the caller has assigned to it
+		static Ref<PhysicsActor> s_NoActor;
+		if (m_PhysicsScene)
+			return m_PhysicsScene->GetPhysicsActor(entity);
+
+		s_NoActor.reset();
+		return s_NoActor;
 	}
 
 	const CameraComponent* Scene::GetRuntimeCamera() const
@@ -1016,12 +1271,8 @@ namespace Eagle
 
 	void Scene::OnPointLightRemoved(entt::registry& r, entt::entity e)
 	{
-		Entity entity(e, this);
-		auto& light = entity.GetComponent<PointLightComponent>();
-		if (light.DoesAffectWorld())
-		{
-			m_DirtyFlags.bPointLightsDirty = true;
-		}
+		// Even if the light doesn't affect the world, removing it moves another light in the storage, so pointers need to be regathered
+		m_DirtyFlags.bPointLightsDirty = true;
 	}
 
 	void Scene::OnSpotLightAdded(entt::registry& r, entt::entity e)
@@ -1031,12 +1282,7 @@ namespace Eagle
 
 	void Scene::OnSpotLightRemoved(entt::registry& r, entt::entity e)
 	{
-		Entity entity(e, this);
-		auto& light = entity.GetComponent<SpotLightComponent>();
-		if (light.DoesAffectWorld())
-		{
-			m_DirtyFlags.bSpotLightsDirty = true;
-		}
+		m_DirtyFlags.bSpotLightsDirty = true;
 	}
 
 	void Scene::OnTextAddedRemoved(entt::registry& r, entt::entity e)
@@ -1055,6 +1301,26 @@ namespace Eagle
 		m_DirtyFlags.bImage2DDirty = true;
 	}
 
+	void Scene::OnBillboardAddedRemoved(entt::registry& r, entt::entity e)
+	{
+		m_DirtyFlags.bBillboardsDirty = true;
+		m_DirtyFlags.bBillboardTransformsDirty = true;
+	}
+
+	void Scene::OnCameraAddedRemoved(entt::registry& r, entt::entity e)
+	{
+		// Adding or removing a camera can move the cached one in the storage
+		m_bRuntimeCameraDirty = true;
+	}
+
+	void Scene::OnColliderAddedRemoved(entt::registry& r, entt::entity e)
+	{
+		// Adding or removing a collider can move other ones in the storage. Added ones might also be visible
+		m_BoxColliderShapes.bDirty = true;
+		m_SphereColliderShapes.bDirty = true;
+		m_CapsuleColliderShapes.bDirty = true;
+	}
+
 	void Scene::ConnectSignals()
 	{
 		m_Registry.on_destroy<StaticMeshComponent>().connect<&Scene::OnStaticMeshComponentRemoved>(*this);
@@ -1070,5 +1336,15 @@ namespace Eagle
 		m_Registry.on_destroy<Text2DComponent>().connect<&Scene::OnText2DAddedRemoved>(*this);
 		m_Registry.on_construct<Image2DComponent>().connect<&Scene::OnImage2DAddedRemoved>(*this);
 		m_Registry.on_destroy<Image2DComponent>().connect<&Scene::OnImage2DAddedRemoved>(*this);
+		m_Registry.on_construct<BillboardComponent>().connect<&Scene::OnBillboardAddedRemoved>(*this);
+		m_Registry.on_destroy<BillboardComponent>().connect<&Scene::OnBillboardAddedRemoved>(*this);
+		m_Registry.on_construct<CameraComponent>().connect<&Scene::OnCameraAddedRemoved>(*this);
+		m_Registry.on_destroy<CameraComponent>().connect<&Scene::OnCameraAddedRemoved>(*this);
+		m_Registry.on_construct<BoxColliderComponent>().connect<&Scene::OnColliderAddedRemoved>(*this);
+		m_Registry.on_construct<SphereColliderComponent>().connect<&Scene::OnColliderAddedRemoved>(*this);
+		m_Registry.on_construct<CapsuleColliderComponent>().connect<&Scene::OnColliderAddedRemoved>(*this);
+		m_Registry.on_destroy<BoxColliderComponent>().connect<&Scene::OnColliderAddedRemoved>(*this);
+		m_Registry.on_destroy<SphereColliderComponent>().connect<&Scene::OnColliderAddedRemoved>(*this);
+		m_Registry.on_destroy<CapsuleColliderComponent>().connect<&Scene::OnColliderAddedRemoved>(*this);
 	}
 }
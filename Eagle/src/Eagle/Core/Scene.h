@@ -6,6 +6,9 @@
 #include "Eagle/Audio/Sound3D.h"
 #include "GUID.h"
 #include "Notifications.h"
+#include "TransformSystem.h"
+#include "DenseComponentSet.h"
+#include "FlatHashMap.h"
 
 #include <entt.hpp>
 
@@ -13,6 +16,19 @@ namespace Eagle
 {
 	class Entity;
 	class Event;
+	class Prefab;
+
+	// Can be cached instead of a GUID to access an entity without a lookup. It's only valid for the scene it was received from.
+	// Entity versions are bumped when entities are destroyed, so a handle of a destroyed entity never resolves to a new one that reuses its index
+	struct EntityHandle
+	{
+		entt::entity Handle = entt::null;
+
+		bool IsNull() const { return Handle == entt::null; }
+		bool operator==(const EntityHandle& other) const { return Handle == other.Handle; }
+		bool operator!=(const EntityHandle& other) const { return Handle != other.Handle; }
+	};
+
 	class CameraComponent;
 	class PhysicsScene;
 	class PhysicsActor;
@@ -22,6 +38,9 @@ namespace Eagle
 	class DirectionalLightComponent;
 	class StaticMeshComponent;
 	class ReverbComponent;
+	class BoxColliderComponent;
+	class SphereColliderComponent;
+	class CapsuleColliderComponent;
 	class Sound2D;
 
 	struct SceneSoundData
@@ -30,6 +49,17 @@ namespace Eagle
 		Ref<Sound> Sound;
 	};
 
+	// Cached debug shapes of the visible colliders of one type, `ShapesPerCollider` shapes per collider in the order of `Visible`.
+	// Shapes of a collider are rebuilt only when it's moved or resized. If colliders are shown, hidden or removed, all shapes of the type are rebuilt
+	template<typename T>
+	struct ColliderDebugShapes
+	{
+		DenseComponentSet<T> Visible;
+		DenseComponentSet<T> Changed; // Visible colliders that were moved or resized
+		std::vector<RendererDebugShape> Shapes;
+		bool bDirty = true;
+	};
+
 	class Scene
 	{
 		struct DirtyFlags
@@ -40,10 +70,14 @@ namespace Eagle
 			bool bSpriteTransformsDirty = true;
 			bool bPointLightsDirty = true;
 			bool bSpotLightsDirty = true;
+			bool bLightTransformsDirty = true; // Some of the lights have moved, but they don't need to be regathered
 			bool bTextDirty = true;
 			bool bText2DDirty = true;
 			bool bTextTransformsDirty = true;
 			bool bImage2DDirty = true;
+			bool bBillboardsDirty = true;
+			bool bBillboardTransformsDirty = true;
+			bool bLightIconsDirty = true; // Editor light icons need to be resent. For example, the scene renderer was used by another scene
 
 			void SetEverythingDirty(bool bDirty)
 			{
@@ -53,22 +87,32 @@ namespace Eagle
 				bSpriteTransformsDirty = bDirty;
 				bPointLightsDirty = bDirty;
 				bSpotLightsDirty = bDirty;
+				bLightTransformsDirty = bDirty;
 				bTextDirty = bDirty;
 				bText2DDirty = bDirty;
 				bTextTransformsDirty = bDirty;
 				bImage2DDirty = bDirty;
+				bBillboardsDirty = bDirty;
+				bBillboardTransformsDirty = bDirty;
+				bLightIconsDirty = bDirty;
 			}
 		};
 
 	public:
-		Scene(const std::string& debugName, const Ref<SceneRenderer>& sceneRenderer = nullptr, bool bRuntime = false);
+		// Scenes without physics don't create physics actors, so colliders only keep their settings. Used by prefabs
+		Scene(const std::string& debugName, const Ref<SceneRenderer>& sceneRenderer = nullptr, bool bRuntime = false, bool bWithPhysics = true);
 		Scene(const Ref<Scene>& other, const std::string& debugName);
 		~Scene();
 
 		Entity CreateEntity(const std::string& name = std::string());
 		Entity CreateEntityWithGUID(GUID guid, const std::string& name = std::string());
 		Entity CreateFromEntity(const Entity& source);
+		// Creates a copy of the prefab for each transform. Storage is reserved once for the whole batch
+		// and physics actors are added to the physics scene with a single call
+		std::vector<Entity> SpawnBatch(const Prefab& prefab, const std::vector<Transform>& transforms);
 		void DestroyEntity(Entity entity);
+		// Entities are destroyed in one batch when the next frame begins, same as with DestroyEntity
+		void DestroyEntities(const std::vector<Entity>& entities);
 
 		void OnUpdate(Timestep ts, bool bRender = true);
 
@@ -84,6 +128,9 @@ namespace Eagle
 
 		bool IsPlaying() const { return bIsPlaying; }
 
+		// Updates world transforms of entities whose ancestors have moved. Called by the scene every frame, and by transform getters when needed
+		void ResolveTransforms() const { m_TransformSystem.Resolve(); }
+
 		// Needs to be called every frame
 		void DrawDebugLine(const RendererLine& line)
 		{
@@ -96,11 +143,19 @@ namespace Eagle
 
 		Ref<PhysicsScene>& GetPhysicsScene() { return m_PhysicsScene; }
 		const Ref<PhysicsScene>& GetPhysicsScene() const { return m_PhysicsScene; }
+		bool HasPhysics() const { return bool(m_PhysicsScene); }
 
 		const Ref<SceneRenderer>& GetSceneRenderer() const { return m_SceneRenderer; }
 		Ref<SceneRenderer>& GetSceneRenderer() { return m_SceneRenderer; }
 
 		Entity GetEntityByGUID(const GUID& guid) const;
+
+		// Returns a null handle if there's no such entity
+		EntityHandle GetEntityHandle(const GUID& guid) const;
+		// Returns Entity::Null if the entity was destroyed
+		Entity GetEntityByHandle(EntityHandle handle) const;
+		bool IsHandleValid(EntityHandle handle) const { return !handle.IsNull() && m_Registry.valid(handle.Handle); }
+		size_t GetAliveEntitiesCount() const { return m_AliveEntities.Size(); }
 		const Ref<PhysicsActor>& GetPhysicsActor(const Entity& entity) const;
 		Ref<PhysicsActor>& GetPhysicsActor(const Entity& entity);
 
@@ -174,6 +229,25 @@ namespace Eagle
 		void OnTextAddedRemoved(entt::registry& r, entt::entity e);
 		void OnText2DAddedRemoved(entt::registry& r, entt::entity e);
 		void OnImage2DAddedRemoved(entt::registry& r, entt::entity e);
+		void OnBillboardAddedRemoved(entt::registry& r, entt::entity e);
+		void OnCameraAddedRemoved(entt::registry& r, entt::entity e);
+		void OnColliderAddedRemoved(entt::registry& r, entt::entity e);
+
+		template<typename T>
+		static void OnColliderChanged(const T& component, Notification notification, ColliderDebugShapes<T>& debugShapes)
+		{
+			// No need to update if the colliders are dirty since all data will be recollected
+			if (debugShapes.bDirty)
+				return;
+
+			if (notification == Notification::OnDebugStateChanged)
+			{
+				if (component.IsCollisionVisible() ? debugShapes.Visible.Add(&component) : debugShapes.Visible.Remove(&component))
+					debugShapes.bDirty = true;
+			}
+			else if (debugShapes.Visible.Contains(&component))
+				debugShapes.Changed.Add(&component);
+		}
 
 		// T - is component type
 		template<typename T>
@@ -188,7 +262,7 @@ namespace Eagle
 				}
 				else if (notification == Notification::OnTransformChanged)
 				{
-					m_DirtyTransformMeshes.emplace(&component);
+					m_DirtyTransformMeshes.Add(&component);
 					m_DirtyFlags.bMeshTransformsDirty = true;
 				}
 			}
@@ -201,7 +275,7 @@ namespace Eagle
 				}
 				else if (notification == Notification::OnTransformChanged)
 				{
-					m_DirtyTransformSprites.emplace(&component);
+					m_DirtyTransformSprites.Add(&component);
 					m_DirtyFlags.bSpriteTransformsDirty = true;
 				}
 			}
@@ -210,7 +284,18 @@ namespace Eagle
 			{
 				if (notification == Notification::OnStateChanged || notification == Notification::OnTransformChanged)
 				{
-					m_DirtyFlags.bPointLightsDirty = true;
+					// Lights are regathered only if the light was added to or removed from the world. Otherwise, only this light is resent
+					if (!m_DirtyFlags.bPointLightsDirty)
+					{
+						if (component.DoesAffectWorld() != m_PointLights.Contains(&component))
+							m_DirtyFlags.bPointLightsDirty = true;
+						else if (component.DoesAffectWorld())
+						{
+							m_DirtyPointLights.Add(&component);
+							m_DirtyFlags.bLightTransformsDirty |= notification == Notification::OnTransformChanged;
+							m_PointLightsDebugRadiiDirty |= m_PointLightsDebugRadii.Contains(&component);
+						}
+					}
 				}
 				else if (notification == Notification::OnDebugStateChanged)
 				{
@@ -219,17 +304,12 @@ namespace Eagle
 					{
 						if (component.VisualizeRadiusEnabled())
 						{
-							m_PointLightsDebugRadii.emplace(&component);
-							m_PointLightsDebugRadiiDirty = true;
+							if (m_PointLightsDebugRadii.Add(&component))
+								m_PointLightsDebugRadiiDirty = true;
 						}
-						else
+						else if (m_PointLightsDebugRadii.Remove(&component))
 						{
-							auto it = m_PointLightsDebugRadii.find(&component);
-							if (it != m_PointLightsDebugRadii.end())
-							{
-								m_PointLightsDebugRadii.erase(it);
-								m_PointLightsDebugRadiiDirty = true;
-							}
+							m_PointLightsDebugRadiiDirty = true;
 						}
 					}
 				}
@@ -239,9 +319,19 @@ namespace Eagle
 			{
 				if (notification == Notification::OnStateChanged || notification == Notification::OnTransformChanged)
 				{
-					m_DirtyFlags.bSpotLightsDirty = true;
+					// Same as for point lights
+					if (!m_DirtyFlags.bSpotLightsDirty)
+					{
+						if (component.DoesAffectWorld() != m_SpotLights.Contains(&component))
+							m_DirtyFlags.bSpotLightsDirty = true;
+						else if (component.DoesAffectWorld())
+						{
+							m_DirtySpotLights.Add(&component);
+							m_DirtyFlags.bLightTransformsDirty |= notification == Notification::OnTransformChanged;
+							m_SpotLightsDebugRadiiDirty |= m_SpotLightsDebugRadii.Contains(&component);
+						}
+					}
 				}
-
 				else if (notification == Notification::OnDebugStateChanged)
 				{
 					// No need to updated if spot lights are dirty since all data will be recollected
@@ -249,17 +339,12 @@ namespace Eagle
 					{
 						if (component.VisualizeDistanceEnabled())
 						{
-							m_SpotLightsDebugRadii.emplace(&component);
-							m_SpotLightsDebugRadiiDirty = true;
+							if (m_SpotLightsDebugRadii.Add(&component))
+								m_SpotLightsDebugRadiiDirty = true;
 						}
-						else
+						else if (m_SpotLightsDebugRadii.Remove(&component))
 						{
-							auto it = m_SpotLightsDebugRadii.find(&component);
-							if (it != m_SpotLightsDebugRadii.end())
-							{
-								m_SpotLightsDebugRadii.erase(it);
-								m_SpotLightsDebugRadiiDirty = true;
-							}
+							m_SpotLightsDebugRadiiDirty = true;
 						}
 					}
 				}
@@ -271,17 +356,12 @@ namespace Eagle
 				{
 					if (component.IsVisualizeRadiusEnabled())
 					{
-						m_ReverbDebugBoxes.emplace(&component);
-						m_ReverbDebugBoxesDirty = true;
+						if (m_ReverbDebugBoxes.Add(&component))
+							m_ReverbDebugBoxesDirty = true;
 					}
-					else
+					else if (m_ReverbDebugBoxes.Remove(&component))
 					{
-						auto it = m_ReverbDebugBoxes.find(&component);
-						if (it != m_ReverbDebugBoxes.end())
-						{
-							m_ReverbDebugBoxes.erase(it);
-							m_ReverbDebugBoxesDirty = true;
-						}
+						m_ReverbDebugBoxesDirty = true;
 					}
 				}
 			}
@@ -290,11 +370,13 @@ namespace Eagle
 			{
 				if (notification == Notification::OnStateChanged)
 				{
-					m_DirtyFlags.bTextDirty = true;
+					// Texts are regathered only if they were added or removed. Otherwise, only this text is relayouted
+					if (!m_DirtyFlags.bTextDirty)
+						m_DirtyTexts.Add(&component);
 				}
 				else if (notification == Notification::OnTransformChanged)
 				{
-					m_DirtyTransformTexts.emplace(&component);
+					m_DirtyTransformTexts.Add(&component);
 					m_DirtyFlags.bTextTransformsDirty = true;
 				}
 			}
@@ -303,7 +385,8 @@ namespace Eagle
 			{
 				if (notification == Notification::OnStateChanged)
 				{
-					m_DirtyFlags.bText2DDirty = true;
+					if (!m_DirtyFlags.bText2DDirty)
+						m_DirtyTexts2D.Add(&component);
 				}
 			}
 
@@ -314,6 +397,32 @@ namespace Eagle
 					m_DirtyFlags.bImage2DDirty = true;
 				}
 			}
+
+			if constexpr (std::is_base_of<CameraComponent, T>::value)
+			{
+				if (notification == Notification::OnStateChanged)
+					m_bRuntimeCameraDirty = true;
+			}
+
+			if constexpr (std::is_base_of<BillboardComponent, T>::value)
+			{
+				if (notification == Notification::OnStateChanged)
+				{
+					m_DirtyFlags.bBillboardsDirty = true;
+				}
+				else if (notification == Notification::OnTransformChanged)
+				{
+					m_DirtyTransformBillboards.Add(&component);
+					m_DirtyFlags.bBillboardTransformsDirty = true;
+				}
+			}
+
+			if constexpr (std::is_base_of<BoxColliderComponent, T>::value)
+				OnColliderChanged<BoxColliderComponent>(component, notification, m_BoxColliderShapes);
+			if constexpr (std::is_base_of<SphereColliderComponent, T>::value)
+				OnColliderChanged<SphereColliderComponent>(component, notification, m_SphereColliderShapes);
+			if constexpr (std::is_base_of<CapsuleColliderComponent, T>::value)
+				OnColliderChanged<CapsuleColliderComponent>(component, notification, m_CapsuleColliderShapes);
 		}
 
 	public:
@@ -332,17 +441,25 @@ namespace Eagle
 		
 		std::unordered_map<GUID, Ref<Sound>> m_SpawnedSounds;
 
-		std::set<const StaticMeshComponent*> m_DirtyTransformMeshes;
-		std::set<const SpriteComponent*> m_DirtyTransformSprites;
-		std::set<const TextComponent*> m_DirtyTransformTexts;
-
-		std::map<GUID, Entity> m_AliveEntities;
-		std::vector<const PointLightComponent*> m_PointLights;
-		std::vector<const SpotLightComponent*> m_SpotLights;
+		// Components which transforms have changed this frame. Cleared when the scene is rendered
+		DenseComponentSet<StaticMeshComponent> m_DirtyTransformMeshes;
+		DenseComponentSet<SpriteComponent> m_DirtyTransformSprites;
+		DenseComponentSet<TextComponent> m_DirtyTransformTexts;
+		DenseComponentSet<BillboardComponent> m_DirtyTransformBillboards;
+
+		FlatHashMap<GUID, entt::entity> m_AliveEntities{ GUID(0, 0) };
+		DenseComponentSet<PointLightComponent> m_PointLights; // Lights that affect the world
+		DenseComponentSet<SpotLightComponent> m_SpotLights;
+		DenseComponentSet<PointLightComponent> m_DirtyPointLights; // Lights that have changed this frame, but weren't added or removed
+		DenseComponentSet<SpotLightComponent> m_DirtySpotLights;
+		DenseComponentSet<TextComponent> m_DirtyTexts; // Texts that have changed this frame, but weren't added or removed
+		DenseComponentSet<Text2DComponent> m_DirtyTexts2D;
 		DirectionalLightComponent* m_DirectionalLight = nullptr;
 		std::vector<Entity> m_EntitiesToDestroy;
 		entt::registry m_Registry;
+		mutable TransformSystem m_TransformSystem{ this }; // Mutable since world transforms are resolved lazily
 		CameraComponent* m_RuntimeCamera = nullptr;
+		bool m_bRuntimeCameraDirty = true; // Cameras were added, removed or changed their `Primary` flag. The primary camera needs to be searched again
 
 		// It's a pointer because `Entity` is forward declared.
 		Entity* m_RuntimeCameraHolder = nullptr; //In case there's no user provided runtime primary-camera
@@ -362,20 +479,35 @@ namespace Eagle
 		// Debug lines
 		std::vector<RendererLine> m_UserDebugLines;
 		std::vector<RendererLine> m_DebugLinesToDraw;
-		std::vector<RendererLine> m_DebugPointLines;
-		std::vector<RendererLine> m_DebugSpotLines;
-		std::vector<RendererLine> m_DebugReverbLines;
 
-		std::set<const PointLightComponent*> m_PointLightsDebugRadii;
+		// Debug shapes
+		std::vector<RendererDebugShape> m_DebugShapesToDraw;
+		std::vector<RendererDebugShape> m_DebugPointShapes;
+		std::vector<RendererDebugShape> m_DebugSpotShapes;
+		std::vector<RendererDebugShape> m_DebugReverbShapes;
+
+		DenseComponentSet<PointLightComponent> m_PointLightsDebugRadii;
 		bool m_PointLightsDebugRadiiDirty = true;
 
-		std::set<const SpotLightComponent*> m_SpotLightsDebugRadii;
+		DenseComponentSet<SpotLightComponent> m_SpotLightsDebugRadii;
 		bool m_SpotLightsDebugRadiiDirty = true;
 
-		std::set<const ReverbComponent*> m_ReverbDebugBoxes;
+		DenseComponentSet<ReverbComponent> m_ReverbDebugBoxes;
 		bool m_ReverbDebugBoxesDirty = true;
 
+		// Mesh colliders are drawn by PhysX as lines
+		ColliderDebugShapes<BoxColliderComponent> m_BoxColliderShapes;
+		ColliderDebugShapes<SphereColliderComponent> m_SphereColliderShapes;
+		ColliderDebugShapes<CapsuleColliderComponent> m_CapsuleColliderShapes;
+
+		// Editor light icons. Used to detect when they need to be rebuilt
+		const DirectionalLightComponent* m_DirectionalLightIcon = nullptr;
+		glm::vec3 m_DirectionalLightIconLocation = glm::vec3(0.f);
+		bool m_bLightIconsVisible = false;
+
 		friend class Entity;
+		friend class TransformSystem;
+		friend class ComponentsNotificationSystem;
 		friend class SceneSerializer;
 		friend class SceneHierarchyPanel;
 	};
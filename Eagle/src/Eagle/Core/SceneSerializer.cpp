@@ -115,21 +115,61 @@ namespace Eagle
 		}
 
 		DeserializeSkybox(data);
+		DeserializeEntities(data);
 
-		if (auto entities = data["Entities"])
+		return true;
+	}
+
+	bool SceneSerializer::SerializeEntities(const Path& filepath, const std::vector<Entity>& entities)
+	{
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << YAML::Key << "Version" << YAML::Value << EG_VERSION;
+		out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+		for (Entity entity : entities)
+			SerializeEntityWithChildren(out, entity);
+		out << YAML::EndSeq;
+		out << YAML::EndMap;
+
+		std::ofstream fout(filepath);
+		fout << out.c_str();
+
+		return fout.good();
+	}
+
+	void SceneSerializer::DeserializeEntities(YAML::Node& data, std::vector<Entity>* outEntities)
+	{
+		auto entities = data["Entities"];
+		if (!entities)
+			return;
+
+		m_AllEntities.clear();
+		m_Childs.clear();
+		for (auto& entityNode : entities)
+			DeserializeEntity(m_Scene, entityNode);
+
+		// Parents that are not in the file are not found, so their children become root entities
+		for (std::pair<uint32_t, uint32_t> element : m_Childs)
 		{
-			for (auto& entityNode : entities)
-				DeserializeEntity(m_Scene, entityNode);
+			Entity& parent = m_AllEntities[element.second];
+			Entity child((entt::entity)element.first, m_Scene.get());
+			child.SetParent(parent);
+		}
 
-			for (std::pair<uint32_t, uint32_t> element : m_Childs)
-			{
-				Entity& parent = m_AllEntities[element.second];
-				Entity child((entt::entity)element.first, m_Scene.get());
-				child.SetParent(parent);
-			}
+		if (outEntities)
+		{
+			outEntities->reserve(outEntities->size() + m_AllEntities.size());
+			for (auto& [id, entity] : m_AllEntities)
+				if (entity)
+					outEntities->push_back(entity);
 		}
+	}
 
-		return true;
+	void SceneSerializer::SerializeEntityWithChildren(YAML::Emitter& out, Entity& entity)
+	{
+		SerializeEntity(out, entity);
+		for (Entity child : entity.GetChildren())
+			SerializeEntityWithChildren(out, child);
 	}
 
 	bool SceneSerializer::SerializeBinary(const Path& filepath)
@@ -211,7 +251,7 @@ namespace Eagle
 
 			SerializeRelativeTransform(out, cameraComponent.GetRelativeTransform());
 
-			out << YAML::Key << "Primary"			<< YAML::Value << cameraComponent.Primary;
+			out << YAML::Key << "Primary"			<< YAML::Value << cameraComponent.IsPrimary();
 			out << YAML::Key << "FixedAspectRatio"	<< YAML::Value << cameraComponent.FixedAspectRatio;
 
 			out << YAML::EndMap; //CameraComponent;
@@ -246,7 +286,7 @@ namespace Eagle
 			out << YAML::BeginMap; //BillboardComponent
 
 			SerializeRelativeTransform(out, component.GetRelativeTransform());
-			Serializer::SerializeTexture(out, component.Texture, "Texture");
+			Serializer::SerializeTexture(out, component.GetTexture(), "Texture");
 
 			out << YAML::EndMap; //BillboardComponent
 		}
@@ -660,7 +700,7 @@ namespace Eagle
 
 			cameraComponent.SetRelativeTransform(relativeTransform);
 
-			cameraComponent.Primary = cameraComponentNode["Primary"].as<bool>();
+			cameraComponent.SetPrimary(cameraComponentNode["Primary"].as<bool>());
 			cameraComponent.FixedAspectRatio = cameraComponentNode["FixedAspectRatio"].as<bool>();
 		}
 
@@ -696,8 +736,11 @@ namespace Eagle
 			auto& billboardComponent = deserializedEntity.AddComponent<BillboardComponent>();
 			Transform relativeTransform;
 
+			Ref<Texture2D> texture;
 			DeserializeRelativeTransform(billboardComponentNode, relativeTransform);
-			Serializer::DeserializeTexture2D(billboardComponentNode, billboardComponent.Texture, "Texture");
+			Serializer::DeserializeTexture2D(billboardComponentNode, texture, "Texture");
+
+			billboardComponent.SetTexture(texture);
 
 			billboardComponent.SetRelativeTransform(relativeTransform);
 		}
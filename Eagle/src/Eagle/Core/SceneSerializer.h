@@ -15,9 +15,18 @@ namespace Eagle
 
 		bool Deserialize(const Path& filepath);
 		bool DeserializeBinary(const Path& filepath);
+
+		// Writes only `entities` and their children. Used to store parts of a scene separately (see WorldPartition)
+		bool SerializeEntities(const Path& filepath, const std::vector<Entity>& entities);
+
+		// Adds entities of `data` to the scene. `data` is either a loaded scene or a file written by `SerializeEntities`.
+		// Parsing the file doesn't touch the scene, so it can be done on another thread.
+		// `outEntities` (optional) receives all created entities
+		void DeserializeEntities(YAML::Node& data, std::vector<Entity>* outEntities = nullptr);
 	
 	private:
 		void SerializeEntity(YAML::Emitter& out, Entity& entity);
+		void SerializeEntityWithChildren(YAML::Emitter& out, Entity& entity);
 		void DeserializeEntity(Ref<Scene>& scene, YAML::iterator::value_type& entityNode);
 
 		void SerializeRelativeTransform(YAML::Emitter& out, const Transform& relativeTransform);
@@ -0,0 +1,179 @@
+#include "egpch.h"
+
+#include "TransformSystem.h"
+#include "Entity.h"
+#include "ThreadPool.h"
+#include "Eagle/Components/Components.h"
+#include "Eagle/Physics/PhysicsActor.h"
+
+namespace Eagle
+{
+	bool TransformSystem::s_bParallelResolve = true;
+
+	void TransformSystem::MarkDirty(entt::entity entity)
+	{
+		const uint32_t entityIndex = GetEntityIndex(entity);
+		if (entityIndex >= m_DirtyMask.size())
+			m_DirtyMask.resize(size_t(entityIndex) + 1, false);
+
+		if (m_DirtyMask[entityIndex])
+			return;
+
+		m_DirtyMask[entityIndex] = true;
+		m_DirtyEntities.push_back(entity);
+	}
+
+	void TransformSystem::Reset()
+	{
+		m_Nodes.clear();
+		m_WorldTransforms.clear();
+		m_Components.clear();
+		m_EntityToNode.clear();
+		m_DirtyEntities.clear();
+		m_DirtyMask.clear();
+		m_bHierarchyDirty = true;
+	}
+
+	void TransformSystem::RebuildHierarchy()
+	{
+		EG_CPU_TIMING_SCOPED("Scene. Rebuild Transform Hierarchy");
+
+		m_Nodes.clear();
+		std::fill(m_EntityToNode.begin(), m_EntityToNode.end(), s_InvalidIndex);
+
+		auto view = m_Scene->m_Registry.view<OwnershipComponent>();
+		for (auto entity : view)
+		{
+			const auto& ownership = view.get<OwnershipComponent>(entity);
+			if (!ownership.EntityParent && !ownership.Children.empty())
+				AddSubtree(entity, s_InvalidIndex);
+		}
+
+		m_WorldTransforms.resize(m_Nodes.size());
+		m_Components.resize(m_Nodes.size());
+		m_bHierarchyDirty = false;
+	}
+
+	void TransformSystem::AddSubtree(entt::entity entity, uint32_t parent)
+	{
+		const uint32_t index = uint32_t(m_Nodes.size());
+		m_Nodes.push_back({ entity, parent, 0 });
+
+		const uint32_t entityIndex = GetEntityIndex(entity);
+		if (entityIndex >= m_EntityToNode.size())
+			m_EntityToNode.resize(size_t(entityIndex) + 1, s_InvalidIndex);
+		m_EntityToNode[entityIndex] = index;
+
+		for (const Entity& child : m_Scene->m_Registry.get<OwnershipComponent>(entity).Children)
+			AddSubtree(child.GetEnttID(), index);
+
+		m_Nodes[index].SubtreeEnd = uint32_t(m_Nodes.size());
+	}
+
+	void TransformSystem::ResolveDirty()
+	{
+		EG_CPU_TIMING_SCOPED("Scene. Resolve Transforms");
+
+		// Components that are notified during resolve might read world transforms
+		m_bResolving = true;
+
+		if (m_bHierarchyDirty)
+			RebuildHierarchy();
+
+		auto& registry = m_Scene->m_Registry;
+		m_DirtyRoots.clear();
+		for (entt::entity entity : m_DirtyEntities)
+		{
+			const uint32_t entityIndex = GetEntityIndex(entity);
+			m_DirtyMask[entityIndex] = false;
+
+			if (!registry.valid(entity) || entityIndex >= m_EntityToNode.size())
+				continue;
+
+			const uint32_t node = m_EntityToNode[entityIndex];
+			if (node != s_InvalidIndex)
+				m_DirtyRoots.push_back(node);
+		}
+		m_DirtyEntities.clear();
+
+		// Dirty entities that are descendants of other dirty entities are resolved with them.
+		// World transforms of the roots are already up to date, so subtrees of their children don't depend on each other
+		std::sort(m_DirtyRoots.begin(), m_DirtyRoots.end());
+		m_Subtrees.clear();
+		uint32_t resolvedEnd = 0;
+		uint32_t descendantsCount = 0;
+		for (uint32_t root : m_DirtyRoots)
+		{
+			if (root < resolvedEnd)
+				continue;
+
+			resolvedEnd = m_Nodes[root].SubtreeEnd;
+			descendantsCount += resolvedEnd - root - 1;
+
+			m_WorldTransforms[root] = registry.get<TransformComponent>(m_Nodes[root].Entity).WorldTransform;
+			for (uint32_t i = root + 1; i < resolvedEnd; ++i)
+				m_Components[i] = &registry.get<TransformComponent>(m_Nodes[i].Entity);
+
+			for (uint32_t child = root + 1; child < resolvedEnd; child = m_Nodes[child].SubtreeEnd)
+				m_Subtrees.push_back(child);
+		}
+
+		const uint32_t subtreesCount = uint32_t(m_Subtrees.size());
+		if (s_bParallelResolve && descendantsCount >= s_MinParallelCount && subtreesCount > 1)
+		{
+			auto& pool = Application::Get().GetWorkerPool();
+			pool->parallelize_loop(0u, subtreesCount, [this](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; ++i)
+					UpdateSubtree(m_Subtrees[i], m_Nodes[m_Subtrees[i]].SubtreeEnd);
+			}).wait();
+		}
+		else
+		{
+			for (uint32_t subtree : m_Subtrees)
+				UpdateSubtree(subtree, m_Nodes[subtree].SubtreeEnd);
+		}
+
+		// Physics and components aren't thread-safe, so they're updated after all transforms are known
+		m_ResolvedEntities.clear();
+		m_ResolvedEntities.reserve(descendantsCount);
+		for (uint32_t subtree : m_Subtrees)
+		{
+			const uint32_t subtreeEnd = m_Nodes[subtree].SubtreeEnd;
+			for (uint32_t i = subtree; i < subtreeEnd; ++i)
+			{
+				Entity entity(m_Nodes[i].Entity, m_Scene);
+				if (const auto& physicsActor = entity.GetPhysicsActor())
+				{
+					const Transform& worldTransform = m_WorldTransforms[i];
+					physicsActor->SetLocation(worldTransform.Location);
+					physicsActor->SetRotation(worldTransform.Rotation);
+				}
+
+				m_ResolvedEntities.push_back(m_Nodes[i].Entity);
+			}
+		}
+		ComponentsNotificationSystem::Notify(*m_Scene, m_ResolvedEntities, Notification::OnParentTransformChanged);
+
+		m_bResolving = false;
+	}
+
+	void TransformSystem::UpdateSubtree(uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			const Transform& parentWorldTransform = m_WorldTransforms[m_Nodes[i].Parent];
+			TransformComponent& component = *m_Components[i];
+			const Transform& relativeTransform = component.RelativeTransform;
+			Transform& worldTransform = m_WorldTransforms[i];
+
+			worldTransform.Rotation = relativeTransform.Rotation * parentWorldTransform.Rotation;
+			worldTransform.Scale3D = parentWorldTransform.Scale3D * relativeTransform.Scale3D;
+
+			glm::vec3 rotated = glm::rotate(parentWorldTransform.Rotation.GetQuat(), relativeTransform.Location);
+			worldTransform.Location = parentWorldTransform.Location + rotated;
+
+			component.WorldTransform = worldTransform;
+		}
+	}
+}
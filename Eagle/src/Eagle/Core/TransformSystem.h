@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Transform.h"
+
+#include <entt.hpp>
+#include <vector>
+
+namespace Eagle
+{
+	class Scene;
+	class TransformComponent;
+
+	// Keeps the entity hierarchy of a scene in flat arrays, where each parent is stored before its children
+	// and a subtree occupies a contiguous range. When a world transform of an entity with children changes,
+	// the entity is marked dirty instead of eagerly updating all of its descendants.
+	// World transforms of the descendants are resolved in a single pass, either once per frame by the scene or lazily when one of them is read.
+	// Descendants of different dirty entities are resolved in parallel if there're enough of them
+	class TransformSystem
+	{
+	public:
+		TransformSystem(Scene* scene) : m_Scene(scene) {}
+
+		// Should be called when an entity gets or loses a parent. Arrays are rebuilt on the next resolve
+		void OnHierarchyChanged() { m_bHierarchyDirty = true; }
+
+		// World transform of an entity has changed. Its descendants will be updated on the next resolve
+		void MarkDirty(entt::entity entity);
+		bool HasDirtyEntities() const { return !m_DirtyEntities.empty(); }
+
+		// Updates world transforms of the descendants of dirty entities, teleports their physics actors and notifies their components
+		void Resolve()
+		{
+			if (!m_DirtyEntities.empty() && !m_bResolving)
+				ResolveDirty();
+		}
+
+		void Reset();
+
+		static void SetParallelResolveEnabled(bool bEnabled) { s_bParallelResolve = bEnabled; }
+		static bool IsParallelResolveEnabled() { return s_bParallelResolve; }
+
+	private:
+		void RebuildHierarchy();
+		void AddSubtree(entt::entity entity, uint32_t parent);
+		void ResolveDirty();
+		void UpdateSubtree(uint32_t begin, uint32_t end);
+
+		static uint32_t GetEntityIndex(entt::entity entity) { return uint32_t(entt::entt_traits<entt::entity>::to_entity(entity)); }
+
+	private:
+		static constexpr uint32_t s_InvalidIndex = uint32_t(-1);
+		static constexpr uint32_t s_MinParallelCount = 2048; // Resolves with fewer dirty descendants are done on the calling thread
+		static bool s_bParallelResolve;
+
+		struct Node
+		{
+			entt::entity Entity = entt::null;
+			uint32_t Parent = s_InvalidIndex;
+			uint32_t SubtreeEnd = 0; // Descendants of the node are stored in [index + 1, SubtreeEnd)
+		};
+
+		Scene* m_Scene = nullptr;
+
+		// Only entities that are a part of a hierarchy are stored
+		std::vector<Node> m_Nodes;
+		std::vector<Transform> m_WorldTransforms; // World transforms of the nodes, valid only for the nodes that are being resolved
+		std::vector<TransformComponent*> m_Components; // Fetched for each resolve since component storages can be reallocated
+		std::vector<uint32_t> m_EntityToNode; // Indexed by the entity index
+
+		std::vector<entt::entity> m_DirtyEntities;
+		std::vector<bool> m_DirtyMask; // Indexed by the entity index. Prevents adding the same entity several times
+		std::vector<uint32_t> m_DirtyRoots;
+		std::vector<uint32_t> m_Subtrees; // Begin indices of independent subtrees that are resolved
+		std::vector<entt::entity> m_ResolvedEntities; // Their components are notified in one batch
+
+		bool m_bHierarchyDirty = true;
+		bool m_bResolving = false;
+	};
+}
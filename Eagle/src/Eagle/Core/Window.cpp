@@ -2,6 +2,7 @@
 #include "Window.h"
 
 #include "Platform/Vulkan/VulkanSwapchain.h"
+#include "Platform/Headless/HeadlessWindow.h"
 
 #ifdef EG_PLATFORM_WINDOWS
 	#include "Platform/Windows/WindowsWindow.h"
@@ -9,12 +10,17 @@
 
 namespace Eagle
 {
+	float Window::s_HighDPIScaleFactor = 1.0f;
+
 	Ref<Window> Window::Create(const WindowProps& props)
 	{
+		if (RendererContext::IsHeadless())
+			return MakeRef<HeadlessWindow>(props);
+
 		#ifdef EG_PLATFORM_WINDOWS
 			return MakeRef<WindowsWindow>(props);
 		#else
-			EG_CORE_ASSERT(false, "Unknown platform!");
+			EG_CORE_ASSERT(false, "Only headless windows are supported on this platform!");
 			return nullptr;
 		#endif
 	}
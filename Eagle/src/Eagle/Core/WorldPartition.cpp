@@ -0,0 +1,210 @@
+#include "egpch.h"
+#include "WorldPartition.h"
+#include "SceneSerializer.h"
+
+#include "Eagle/Components/Components.h"
+#include "Eagle/Debug/CPUTimings.h"
+
+namespace Eagle
+{
+	static constexpr const char* s_CellFileExtension = ".eagle";
+
+	WorldPartition::WorldPartition(const Ref<Scene>& scene, const Path& folder, const WorldPartitionSettings& settings)
+		: m_Scene(scene)
+		, m_Folder(folder)
+		, m_Settings(settings)
+	{
+		EG_CORE_ASSERT(m_Settings.UnloadDistance >= m_Settings.LoadDistance, "Cells would be unloaded right after being loaded");
+
+		if (!std::filesystem::exists(folder))
+		{
+			EG_CORE_WARN("[WorldPartition] Folder '{}' doesn't exist", folder);
+			return;
+		}
+
+		for (const auto& file : std::filesystem::directory_iterator(folder))
+		{
+			if (file.path().extension() != s_CellFileExtension)
+				continue;
+
+			glm::ivec2 coords;
+			if (sscanf(file.path().stem().u8string().c_str(), "Cell_%d_%d", &coords.x, &coords.y) != 2)
+				continue;
+
+			Cell& cell = m_Cells[GetCellKey(coords)];
+			cell.Coords = coords;
+		}
+		m_ActiveCells.reserve(m_Cells.size());
+	}
+
+	bool WorldPartition::WriteCells(const Ref<Scene>& scene, const std::vector<Entity>& entities, const Path& folder, float cellSize)
+	{
+		std::unordered_map<uint64_t, std::pair<glm::ivec2, std::vector<Entity>>> cells;
+		for (const Entity& entity : entities)
+		{
+			EG_CORE_ASSERT(!entity.HasParent(), "Only root entities can be written into cells");
+			const glm::ivec2 coords = GetCellCoords(entity.GetWorldTransform().Location, cellSize);
+			auto& cell = cells[GetCellKey(coords)];
+			cell.first = coords;
+			cell.second.push_back(entity);
+		}
+
+		std::filesystem::create_directories(folder);
+
+		bool bResult = true;
+		SceneSerializer serializer(scene);
+		for (auto& [key, cell] : cells)
+			bResult &= serializer.SerializeEntities(GetCellPath(folder, cell.first), cell.second);
+		return bResult;
+	}
+
+	void WorldPartition::Update(const glm::vec3& location)
+	{
+		EG_CPU_TIMING_SCOPED("World Partition. Update");
+
+		const glm::ivec2 center = GetCellCoords(location, m_Settings.CellSize);
+		const int range = int(glm::ceil(m_Settings.LoadDistance / m_Settings.CellSize));
+		for (int z = center.y - range; z <= center.y + range; ++z)
+		{
+			for (int x = center.x - range; x <= center.x + range; ++x)
+			{
+				auto it = m_Cells.find(GetCellKey({ x, z }));
+				if (it == m_Cells.end())
+					continue;
+
+				Cell& cell = it->second;
+				if (cell.State == CellState::Unloaded && !cell.bBroken && GetDistance(cell, location) <= m_Settings.LoadDistance)
+					Load(cell);
+			}
+		}
+
+		// Cells that went out of range while being loaded are dropped once their data is ready
+		uint32_t createdCount = 0;
+		for (Cell* activeCell : m_ActiveCells)
+		{
+			Cell& cell = *activeCell;
+			const bool bTooFar = GetDistance(cell, location) > m_Settings.UnloadDistance;
+			if (cell.State == CellState::Loading)
+			{
+				const bool bReady = cell.Data.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+				if (bReady && !bTooFar && createdCount < m_Settings.MaxCellsCreatedPerFrame)
+				{
+					Create(cell);
+					++createdCount;
+				}
+				else if (bReady && bTooFar)
+					Unload(cell);
+			}
+			else if (cell.State == CellState::PendingDestroy)
+			{
+				if (IsDestroyed(cell))
+				{
+					cell.Entities.clear();
+					cell.State = CellState::Unloaded;
+				}
+			}
+			else if (bTooFar)
+				Unload(cell);
+		}
+		RemoveUnloadedCells();
+	}
+
+	void WorldPartition::UnloadAll()
+	{
+		for (Cell* cell : m_ActiveCells)
+		{
+			// The worker thread only touches the data of the task, so there's no need to wait for it
+			Unload(*cell);
+		}
+		RemoveUnloadedCells();
+	}
+
+	glm::ivec2 WorldPartition::GetCellCoords(const glm::vec3& location, float cellSize)
+	{
+		return glm::ivec2(glm::floor(glm::vec2(location.x, location.z) / cellSize));
+	}
+
+	Path WorldPartition::GetCellPath(const Path& folder, glm::ivec2 coords)
+	{
+		return folder / ("Cell_" + std::to_string(coords.x) + "_" + std::to_string(coords.y) + s_CellFileExtension);
+	}
+
+	float WorldPartition::GetDistance(const Cell& cell, const glm::vec3& location) const
+	{
+		// Distance on the XZ plane to the closest point of the cell
+		const glm::vec2 cellMin = glm::vec2(cell.Coords) * m_Settings.CellSize;
+		const glm::vec2 point = glm::vec2(location.x, location.z);
+		const glm::vec2 closest = glm::clamp(point, cellMin, cellMin + m_Settings.CellSize);
+		return glm::distance(point, closest);
+	}
+
+	void WorldPartition::Load(Cell& cell)
+	{
+		auto& pool = Application::Get().GetWorkerPool();
+		cell.Data = pool->submit([path = GetCellPath(m_Folder, cell.Coords)]() -> std::optional<YAML::Node>
+		{
+			try
+			{
+				return YAML::LoadFile(path.string());
+			}
+			catch (const YAML::Exception& e)
+			{
+				EG_CORE_ERROR("[WorldPartition] Failed to load cell '{}': {}", path, e.what());
+				return std::nullopt;
+			}
+		});
+		cell.State = CellState::Loading;
+		m_ActiveCells.push_back(&cell);
+	}
+
+	void WorldPartition::Create(Cell& cell)
+	{
+		EG_CPU_TIMING_SCOPED("World Partition. Create Cell");
+
+		std::optional<YAML::Node> data = cell.Data.get();
+		if (!data)
+		{
+			cell.Data = {};
+			cell.State = CellState::Unloaded;
+			cell.bBroken = true;
+			return;
+		}
+
+		SceneSerializer serializer(m_Scene);
+		serializer.DeserializeEntities(*data, &cell.Entities);
+
+		cell.State = CellState::Loaded;
+		++m_LoadedCellsCount;
+		m_ResidentEntitiesCount += cell.Entities.size();
+	}
+
+	void WorldPartition::Unload(Cell& cell)
+	{
+		if (cell.State == CellState::PendingDestroy)
+			return;
+
+		cell.Data = {};
+		if (cell.State == CellState::Loaded)
+		{
+			// Entities are destroyed in one batch with the rest of the pending entities.
+			// They're kept until then, so that the cell isn't loaded again while they're alive
+			m_Scene->DestroyEntities(cell.Entities);
+			--m_LoadedCellsCount;
+			m_ResidentEntitiesCount -= cell.Entities.size();
+			cell.State = CellState::PendingDestroy;
+		}
+		else
+			cell.State = CellState::Unloaded;
+	}
+
+	bool WorldPartition::IsDestroyed(const Cell& cell) const
+	{
+		return std::none_of(cell.Entities.begin(), cell.Entities.end(), [this](const Entity& entity) { return m_Scene->IsHandleValid(entity.GetHandle()); });
+	}
+
+	void WorldPartition::RemoveUnloadedCells()
+	{
+		auto it = std::remove_if(m_ActiveCells.begin(), m_ActiveCells.end(), [](const Cell* cell) { return cell->State == CellState::Unloaded; });
+		m_ActiveCells.erase(it, m_ActiveCells.end());
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Entity.h"
+
+#include <glm/glm.hpp>
+#include <yaml-cpp/yaml.h>
+#include <future>
+#include <optional>
+
+namespace Eagle
+{
+	struct WorldPartitionSettings
+	{
+		float CellSize = 256.f;
+		float LoadDistance = 512.f; // Cells that are closer than this to the streaming location are loaded
+		float UnloadDistance = 768.f; // Should be greater than `LoadDistance`, so that cells on the border aren't loaded and unloaded every frame
+		uint32_t MaxCellsCreatedPerFrame = 2; // Limits the time spent on creating entities during a frame
+	};
+
+	// Splits a large world into square cells on the XZ plane. Each cell is stored in its own file, and only cells around
+	// the streaming location (usually the camera) are resident in the scene, so the memory and the per-frame costs
+	// depend on what's around the camera rather than on the size of the world.
+	// Cell files are read and parsed on worker threads. Entities of a cell are created and destroyed on the calling thread,
+	// together with their meshes, lights and physics actors.
+	// Entities that aren't a part of any cell (for example, the camera) are not affected
+	class WorldPartition
+	{
+	public:
+		// Looks for the cell files in `folder`
+		WorldPartition(const Ref<Scene>& scene, const Path& folder, const WorldPartitionSettings& settings = {});
+
+		// Groups root `entities` by the cell their world location belongs to and writes each group with the children into its cell file.
+		// Entities stay in the scene
+		static bool WriteCells(const Ref<Scene>& scene, const std::vector<Entity>& entities, const Path& folder, float cellSize);
+
+		// Requests cells that are within `LoadDistance` of `location` and unloads the ones that are farther than `UnloadDistance`
+		void Update(const glm::vec3& location);
+
+		// Destroys entities of all loaded cells. Cells that are being loaded are dropped.
+		// Unloaded cells can't be loaded again until the scene has destroyed their entities
+		void UnloadAll();
+
+		const WorldPartitionSettings& GetSettings() const { return m_Settings; }
+		size_t GetCellsCount() const { return m_Cells.size(); }
+		size_t GetLoadedCellsCount() const { return m_LoadedCellsCount; }
+		size_t GetResidentEntitiesCount() const { return m_ResidentEntitiesCount; }
+
+		static glm::ivec2 GetCellCoords(const glm::vec3& location, float cellSize);
+		static Path GetCellPath(const Path& folder, glm::ivec2 coords);
+
+	private:
+		enum class CellState
+		{
+			Unloaded,
+			Loading,
+			Loaded,
+			PendingDestroy // Unloaded, but the scene hasn't destroyed the entities yet. Loading it now would create entities with the same GUIDs
+		};
+
+		struct Cell
+		{
+			glm::ivec2 Coords = glm::ivec2(0);
+			CellState State = CellState::Unloaded;
+			std::future<std::optional<YAML::Node>> Data; // Valid while the cell is loading. Empty if the file couldn't be read or parsed
+			std::vector<Entity> Entities;
+			bool bBroken = false; // The file failed to load. It isn't requested again
+		};
+
+		static uint64_t GetCellKey(glm::ivec2 coords) { return (uint64_t(uint32_t(coords.x)) << 32) | uint64_t(uint32_t(coords.y)); }
+		float GetDistance(const Cell& cell, const glm::vec3& location) const;
+
+		void Load(Cell& cell);
+		void Create(Cell& cell);
+		void Unload(Cell& cell);
+		bool IsDestroyed(const Cell& cell) const;
+		void RemoveUnloadedCells();
+
+	private:
+		Ref<Scene> m_Scene;
+		Path m_Folder;
+		WorldPartitionSettings m_Settings;
+
+		std::unordered_map<uint64_t, Cell> m_Cells; // Only cells that have a file
+		std::vector<Cell*> m_ActiveCells; // Cells that are loading or loaded
+		size_t m_LoadedCellsCount = 0;
+		size_t m_ResidentEntitiesCount = 0;
+	};
+}
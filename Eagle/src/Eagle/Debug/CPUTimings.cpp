@@ -3,16 +3,201 @@
 #ifdef EG_CPU_TIMINGS
 
 #include "CPUTimings.h"
-#include "Eagle/Core/Application.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace Eagle
 {
-	static thread_local std::vector<CPUTiming*> s_TimingsStack;
+	using CPUTimingClock = std::chrono::high_resolution_clock;
+
+	struct CPUTimingEvent
+	{
+		std::string_view Name;
+		CPUTimingClock::rep Time;
+		bool bBegin;
+	};
+
+	// Slots are read while the owner might be overwriting them, so the fields are relaxed atomics.
+	// On x86 and ARM, these loads and stores are plain moves
+	struct CPUTimingEventSlot
+	{
+		std::atomic<const char*> NameData = nullptr;
+		std::atomic<size_t> NameSize = 0;
+		std::atomic<CPUTimingClock::rep> Time = 0;
+		std::atomic<bool> bBegin = false;
+	};
+
+	// Single producer (owning thread) ring buffer of events.
+	// The reader never blocks the producer. If the producer laps the reader, the overwritten events are dropped.
+	// Works as a seqlock: the write index is published after a slot is written, and the reader re-checks it after copying slots
+	class CPUTimingsBuffer
+	{
+	public:
+		static constexpr uint64_t Capacity = 1ull << 14; // Must be a power of two
+
+		CPUTimingsBuffer() : ThreadID(std::this_thread::get_id()), m_Events(new CPUTimingEventSlot[Capacity]) {}
+
+		void Push(std::string_view name, bool bBegin)
+		{
+			const uint64_t index = m_WriteIndex.load(std::memory_order_relaxed);
+
+			// Pairs with the acquire fence in `GetFirstValidIndex`. A reader that has seen any of the stores below
+			// is guaranteed to see a write index of at least `index`, so it knows that the old event of the slot is gone
+			std::atomic_thread_fence(std::memory_order_release);
+
+			CPUTimingEventSlot& slot = m_Events[index & (Capacity - 1)];
+			slot.NameData.store(name.data(), std::memory_order_relaxed);
+			slot.NameSize.store(name.size(), std::memory_order_relaxed);
+			slot.Time.store(CPUTimingClock::now().time_since_epoch().count(), std::memory_order_relaxed);
+			slot.bBegin.store(bBegin, std::memory_order_relaxed);
+			m_WriteIndex.store(index + 1, std::memory_order_release);
+		}
+
+		uint64_t GetWriteIndex() const { return m_WriteIndex.load(std::memory_order_acquire); }
+
+		// The copy might be torn. It can be used only if `GetFirstValidIndex` called after the copy is not greater than `index`
+		CPUTimingEvent CopyEvent(uint64_t index) const
+		{
+			const CPUTimingEventSlot& slot = m_Events[index & (Capacity - 1)];
+			CPUTimingEvent event;
+			event.Name = std::string_view(slot.NameData.load(std::memory_order_relaxed), slot.NameSize.load(std::memory_order_relaxed));
+			event.Time = slot.Time.load(std::memory_order_relaxed);
+			event.bBegin = slot.bBegin.load(std::memory_order_relaxed);
+			return event;
+		}
+
+		// Events before the returned index could have been overwritten by the owner, including the one that's being written right now
+		uint64_t GetFirstValidIndex() const
+		{
+			// Orders the copies made by `CopyEvent` before the load of the write index
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const uint64_t writeIndex = m_WriteIndex.load(std::memory_order_relaxed);
+			return writeIndex >= Capacity ? writeIndex - Capacity + 1 : 0;
+		}
+
+	public:
+		const std::thread::id ThreadID;
+
+		// Everything below is accessed only under `s_BuffersMutex`
+		uint64_t PrevFrameEnd = 0;
+		uint64_t FrameEnd = 0;
+
+		struct OpenScope
+		{
+			CPUTiming::Data Data;
+			CPUTimingClock::rep Start;
+		};
+
+		// Reader state. Scopes can span several frames so the stack is kept between resolves
+		std::vector<OpenScope> Stack;
+		std::vector<CPUTiming::Data> LastFrame;
+		uint64_t Cursor = 0;
+		uint64_t ResolvedFrameEnd = uint64_t(-1);
+
+	private:
+		std::atomic<uint64_t> m_WriteIndex = 0;
+		Scope<CPUTimingEventSlot[]> m_Events;
+	};
+
+	static std::mutex s_BuffersMutex;
+
+	static std::vector<Ref<CPUTimingsBuffer>>& GetBuffers()
+	{
+		static std::vector<Ref<CPUTimingsBuffer>> s_Buffers;
+		return s_Buffers;
+	}
+
+	// Buffers are shared with the registry so that timings of a thread are still readable after it has exited
+	static CPUTimingsBuffer& GetThreadBuffer()
+	{
+		static thread_local Ref<CPUTimingsBuffer> s_ThreadBuffer;
+		if (!s_ThreadBuffer)
+		{
+			s_ThreadBuffer = MakeRef<CPUTimingsBuffer>();
+
+			std::scoped_lock lock(s_BuffersMutex);
+			GetBuffers().push_back(s_ThreadBuffer);
+		}
+		return *s_ThreadBuffer;
+	}
 
-	Eagle::CPUTiming::CPUTiming(const std::string_view name, bool bScoped)
-		: m_bScoped(bScoped)
+	static float TicksToMs(CPUTimingClock::rep ticks)
+	{
+		using Period = CPUTimingClock::period;
+		return float(double(ticks) * 1000.0 * double(Period::num) / double(Period::den));
+	}
+
+	// Processes events up to the end of the last frame. Should be called under `s_BuffersMutex`
+	static void Resolve(CPUTimingsBuffer& buffer)
+	{
+		const uint64_t frameEnd = buffer.FrameEnd;
+		if (buffer.ResolvedFrameEnd == frameEnd)
+			return;
+
+		buffer.ResolvedFrameEnd = frameEnd;
+		buffer.LastFrame.clear();
+
+		uint64_t begin = buffer.Cursor;
+		buffer.Cursor = frameEnd;
+		if (frameEnd - begin > CPUTimingsBuffer::Capacity)
+		{
+			begin = frameEnd - CPUTimingsBuffer::Capacity;
+			buffer.Stack.clear();
+		}
+
+		std::vector<CPUTimingEvent> events;
+		events.reserve(frameEnd - begin);
+		for (uint64_t i = begin; i < frameEnd; ++i)
+			events.push_back(buffer.CopyEvent(i));
+
+		// The owner could have overwritten some of the events while they were being copied
+		const uint64_t firstValid = buffer.GetFirstValidIndex();
+		size_t firstEvent = 0;
+		if (firstValid > begin)
+		{
+			firstEvent = size_t(std::min(firstValid, frameEnd) - begin);
+			buffer.Stack.clear();
+		}
+
+		const size_t eventsCount = events.size();
+		for (size_t i = firstEvent; i < eventsCount; ++i)
+		{
+			const CPUTimingEvent& event = events[i];
+			if (event.bBegin)
+			{
+				auto& scope = buffer.Stack.emplace_back();
+				scope.Data.Name = event.Name;
+				scope.Start = event.Time;
+				continue;
+			}
+
+			// The beginning of the scope was lost
+			if (buffer.Stack.empty())
+				continue;
+
+			CPUTiming::Data data = std::move(buffer.Stack.back().Data);
+			data.Timing = TicksToMs(event.Time - buffer.Stack.back().Start);
+			buffer.Stack.pop_back();
+
+			if (!buffer.Stack.empty())
+				buffer.Stack.back().Data.Children.push_back(std::move(data));
+			else if (begin + i >= buffer.PrevFrameEnd) // Top-level scopes of older frames are skipped
+			{
+				auto it = std::find_if(buffer.LastFrame.begin(), buffer.LastFrame.end(), [&data](const CPUTiming::Data& other) { return other.Name == data.Name; });
+				if (it != buffer.LastFrame.end())
+					*it = std::move(data);
+				else
+					buffer.LastFrame.push_back(std::move(data));
+			}
+		}
+	}
+
+	CPUTiming::CPUTiming(const std::string_view name, bool bScoped)
+		: m_Name(name)
+		, m_bScoped(bScoped)
 	{
-		m_Data.Name = name;
 		Start();
 	}
 
@@ -24,29 +209,87 @@ namespace Eagle
 
 	void CPUTiming::Start()
 	{
-		m_StartTime = std::chrono::high_resolution_clock::now();
+		GetThreadBuffer().Push(m_Name, true);
+	}
 
-		if (!s_TimingsStack.empty())
+	void CPUTiming::End()
+	{
+		GetThreadBuffer().Push(m_Name, false);
+	}
+
+	void CPUTiming::BeginFrame()
+	{
+		std::scoped_lock lock(s_BuffersMutex);
+		for (auto& buffer : GetBuffers())
 		{
-			SetParent(s_TimingsStack.back());
+			buffer->PrevFrameEnd = buffer->FrameEnd;
+			buffer->FrameEnd = buffer->GetWriteIndex();
 		}
-		s_TimingsStack.push_back(this);
 	}
 
-	void CPUTiming::End()
+	uint32_t CPUTiming::GetLastFramePhases(ScopeTiming* outTimings, uint32_t maxCount)
 	{
-		auto duration = std::chrono::high_resolution_clock::now() - m_StartTime;
-		m_Data.Timing = float(std::chrono::duration_cast<std::chrono::duration<double>>(duration).count() * 1000.0);
+		CPUTimingsBuffer& buffer = GetThreadBuffer();
+		uint64_t begin = 0;
+		uint64_t end = 0;
+		{
+			std::scoped_lock lock(s_BuffersMutex);
+			begin = buffer.PrevFrameEnd;
+			end = buffer.FrameEnd;
+		}
+
+		// The calling thread owns the buffer, so the events can't be overwritten while they're read. But they could have been before
+		if (end - begin > CPUTimingsBuffer::Capacity)
+			return 0;
 
-		if (m_Parent)
+		uint32_t count = 0;
+		uint32_t depth = 0;
+		std::string_view phaseName;
+		CPUTimingClock::rep phaseStart = 0;
+		for (uint64_t i = begin; i < end; ++i)
 		{
-			m_Parent->m_Data.Children.push_back(m_Data);
+			const CPUTimingEvent event = buffer.CopyEvent(i);
+			if (event.bBegin)
+			{
+				if (++depth == 2)
+				{
+					phaseName = event.Name;
+					phaseStart = event.Time;
+				}
+				continue;
+			}
+
+			// The scope has begun during one of the earlier frames
+			if (depth == 0)
+				continue;
+			if (depth-- != 2)
+				continue;
+
+			ScopeTiming* timing = std::find_if(outTimings, outTimings + count, [&phaseName](const ScopeTiming& other) { return other.Name == phaseName; });
+			if (timing == outTimings + count)
+			{
+				if (count == maxCount)
+					continue;
+				*timing = { phaseName, 0.f };
+				++count;
+			}
+			timing->Timing += TicksToMs(event.Time - phaseStart);
 		}
-		else
+		return count;
+	}
+
+	std::unordered_map<std::thread::id, std::vector<CPUTiming::Data>> CPUTiming::GetLastFrameTimings()
+	{
+		std::unordered_map<std::thread::id, std::vector<Data>> result;
+
+		std::scoped_lock lock(s_BuffersMutex);
+		for (auto& buffer : GetBuffers())
 		{
-			Application::Get().AddCPUTiming(this);
+			Resolve(*buffer);
+			if (!buffer->LastFrame.empty())
+				result[buffer->ThreadID] = buffer->LastFrame;
 		}
-		s_TimingsStack.pop_back();
+		return result;
 	}
 }
 
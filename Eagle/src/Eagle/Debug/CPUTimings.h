@@ -4,8 +4,13 @@
 
 #ifdef EG_CPU_TIMINGS
 
+#include <thread>
+
 namespace Eagle
 {
+	// Records begin/end events of a scope into a buffer of the calling thread.
+	// Recording doesn't lock or allocate. Events are turned into trees only when timings are requested.
+	// `name` must outlive the timing data (string literals are expected)
 	class CPUTiming
 	{
 	public:
@@ -27,26 +32,29 @@ namespace Eagle
 			}
 		};
 
-		std::string_view GetName() const { return m_Data.Name; }
-		float GetTiming() const { return m_Data.Timing; }
-		const std::vector<Data>& GetChildren() const { return m_Data.Children; }
-		const Data& GetData() const { return m_Data; }
-
-	private:
-		void SetParent(CPUTiming* parent)
+		struct ScopeTiming
 		{
-			m_Parent = parent;
-		}
+			std::string_view Name;
+			float Timing = 0.f;
+		};
 
-		const CPUTiming* GetParent() const { return m_Parent; }
+		std::string_view GetName() const { return m_Name; }
 
-	private:
-		CPUTiming* m_Parent = nullptr;
+		// Should be called by the main thread at the start of a frame.
+		// Marks where events of the previous frame end in every thread's buffer
+		static void BeginFrame();
 
-		std::chrono::high_resolution_clock::time_point m_StartTime;
+		// Resolves the events of the last finished frame into trees. Only top-level scopes that ended during that frame are returned.
+		// If there're several top-level scopes with the same name, only the last one is returned
+		static std::unordered_map<std::thread::id, std::vector<Data>> GetLastFrameTimings();
 
-		Data m_Data;
+		// Durations of the scopes that are directly under the top-level scopes of the calling thread and that ended during the last finished frame.
+		// For the main thread, these are the phases of "Whole frame". Scopes with the same name are summed.
+		// Doesn't allocate, so it can be called every frame. Returns the number of written timings
+		static uint32_t GetLastFramePhases(ScopeTiming* outTimings, uint32_t maxCount);
 
+	private:
+		std::string_view m_Name;
 		bool m_bScoped = false;
 	};
 }
@@ -0,0 +1,197 @@
+#include "egpch.h"
+#include "FrameHistory.h"
+
+#include "Eagle/Core/Scene.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace Eagle
+{
+	std::deque<FrameHistory::Frame> FrameHistory::s_Frames;
+	std::deque<FrameHistory::Snapshot> FrameHistory::s_Hitches;
+	FrameHistory::Snapshot FrameHistory::s_LastFrame;
+	uint64_t FrameHistory::s_FrameIndex = 0;
+	float FrameHistory::s_HistoryDuration = 10.f;
+	float FrameHistory::s_HitchThreshold = 50.f;
+	uint32_t FrameHistory::s_MaxHitches = 32u;
+	bool FrameHistory::s_bEnabled = true;
+	bool FrameHistory::s_bCaptureLastFrame = false;
+
+	static void FillSnapshot(FrameHistory::Snapshot& snapshot, const FrameHistory::Frame& frame)
+	{
+		snapshot.Index = frame.Index;
+		snapshot.Time = frame.Time;
+		snapshot.FrameTime = frame.FrameTime;
+#ifdef EG_CPU_TIMINGS
+		snapshot.CPUTimings = Application::Get().GetCPUTimings();
+#endif
+		snapshot.GPUTimings = RenderManager::GetTimings();
+		snapshot.RHIStats = RenderManager::GetRHIStats();
+		if (const auto& scene = Scene::GetCurrentScene())
+		{
+			const auto& sceneRenderer = scene->GetSceneRenderer();
+			snapshot.RendererStats = sceneRenderer->GetStats();
+			snapshot.RendererStats2D = sceneRenderer->GetStats2D();
+		}
+		else
+		{
+			snapshot.RendererStats = {};
+			snapshot.RendererStats2D = {};
+		}
+	}
+
+	void FrameHistory::AddFrame(double time, float frameTime)
+	{
+		if (!s_bEnabled)
+			return;
+
+		EG_CPU_TIMING_SCOPED("Frame History");
+
+		Frame& frame = s_Frames.emplace_back();
+		frame.Index = s_FrameIndex++;
+		frame.Time = time;
+		frame.FrameTime = frameTime;
+		frame.RHIStats = RenderManager::GetRHICounters();
+#ifdef EG_CPU_TIMINGS
+		frame.CPUPhasesCount = CPUTiming::GetLastFramePhases(frame.CPUPhases.data(), MaxFrameTimings);
+#endif
+		frame.GPUPassesCount = RenderManager::GetPassTimings(frame.GPUPasses.data(), MaxFrameTimings);
+
+		while (!s_Frames.empty() && (time - s_Frames.front().Time) > s_HistoryDuration)
+			s_Frames.pop_front();
+
+		const bool bHitch = frameTime > s_HitchThreshold;
+		if (!bHitch)
+		{
+			if (s_bCaptureLastFrame)
+				FillSnapshot(s_LastFrame, frame);
+			return;
+		}
+
+		EG_CORE_WARN("[FrameHistory] Hitch detected. Frame #{} took {:.2f}ms", frame.Index, frameTime);
+
+		Snapshot& hitch = s_Hitches.emplace_back();
+		FillSnapshot(hitch, frame);
+		if (s_bCaptureLastFrame)
+			s_LastFrame = hitch;
+
+		while (s_Hitches.size() > s_MaxHitches)
+			s_Hitches.pop_front();
+	}
+
+	void FrameHistory::SetEnabled(bool bEnabled)
+	{
+		s_bEnabled = bEnabled;
+		if (!s_bEnabled)
+			s_Frames.clear();
+	}
+
+	void FrameHistory::SetMaxHitches(uint32_t count)
+	{
+		s_MaxHitches = count;
+		while (s_Hitches.size() > s_MaxHitches)
+			s_Hitches.pop_front();
+	}
+
+	// Works for both CPU and GPU timings
+	template<typename Children>
+	static void SerializeTiming(YAML::Emitter& out, std::string_view name, float timing, const Children& children)
+	{
+		out << YAML::BeginMap;
+		out << YAML::Key << "Name" << YAML::Value << std::string(name);
+		out << YAML::Key << "Time" << YAML::Value << timing;
+		if (!children.empty())
+		{
+			out << YAML::Key << "Children" << YAML::Value << YAML::BeginSeq;
+			for (const auto& child : children)
+				SerializeTiming(out, child.Name, child.Timing, child.Children);
+			out << YAML::EndSeq;
+		}
+		out << YAML::EndMap;
+	}
+
+	static void SerializeRHICounters(YAML::Emitter& out, const RHICounters& counters)
+	{
+		out << YAML::BeginMap;
+		out << YAML::Key << "Draws" << YAML::Value << counters.Draws;
+		out << YAML::Key << "Dispatches" << YAML::Value << counters.Dispatches;
+		out << YAML::Key << "RenderPassBegins" << YAML::Value << counters.RenderPassBegins;
+		out << YAML::Key << "PipelineBinds" << YAML::Value << counters.PipelineBinds;
+		out << YAML::Key << "DescriptorBinds" << YAML::Value << counters.DescriptorBinds;
+		out << YAML::Key << "DescriptorWrites" << YAML::Value << counters.DescriptorWrites;
+		out << YAML::Key << "DescriptorCacheHits" << YAML::Value << counters.DescriptorCacheHits;
+		out << YAML::Key << "VertexBufferBinds" << YAML::Value << counters.VertexBufferBinds;
+		out << YAML::Key << "IndexBufferBinds" << YAML::Value << counters.IndexBufferBinds;
+		out << YAML::Key << "Barriers" << YAML::Value << counters.Barriers;
+		out << YAML::Key << "StagingAllocations" << YAML::Value << counters.StagingAllocations;
+		out << YAML::Key << "BytesWritten" << YAML::Value << counters.BytesWritten;
+		out << YAML::EndMap;
+	}
+
+	bool FrameHistory::ExportHitches(const Path& path)
+	{
+		YAML::Emitter out;
+		out << YAML::BeginMap;
+		out << YAML::Key << "HitchThreshold" << YAML::Value << s_HitchThreshold;
+		out << YAML::Key << "Hitches" << YAML::Value << YAML::BeginSeq;
+		for (const auto& hitch : s_Hitches)
+		{
+			out << YAML::BeginMap;
+			out << YAML::Key << "Frame" << YAML::Value << hitch.Index;
+			out << YAML::Key << "Time" << YAML::Value << hitch.Time;
+			out << YAML::Key << "FrameTime" << YAML::Value << hitch.FrameTime;
+
+#ifdef EG_CPU_TIMINGS
+			out << YAML::Key << "CPUTimings" << YAML::Value << YAML::BeginSeq;
+			for (const auto& [threadID, timings] : hitch.CPUTimings)
+			{
+				out << YAML::BeginMap;
+				out << YAML::Key << "Thread" << YAML::Value << std::string(Application::Get().GetThreadName(threadID));
+				out << YAML::Key << "Timings" << YAML::Value << YAML::BeginSeq;
+				for (const auto& timing : timings)
+					SerializeTiming(out, timing.Name, timing.Timing, timing.Children);
+				out << YAML::EndSeq;
+				out << YAML::EndMap;
+			}
+			out << YAML::EndSeq;
+#endif
+
+			out << YAML::Key << "GPUTimings" << YAML::Value << YAML::BeginSeq;
+			for (const auto& timing : hitch.GPUTimings)
+				SerializeTiming(out, timing.Name, timing.Timing, timing.Children);
+			out << YAML::EndSeq;
+
+			out << YAML::Key << "RHIStats" << YAML::Value;
+			SerializeRHICounters(out, hitch.RHIStats);
+
+			out << YAML::Key << "RHIPasses" << YAML::Value << YAML::BeginMap;
+			for (const auto& [passName, counters] : hitch.RHIStats.Passes)
+			{
+				out << YAML::Key << std::string(passName) << YAML::Value;
+				SerializeRHICounters(out, counters);
+			}
+			out << YAML::EndMap;
+
+			out << YAML::Key << "RendererStats" << YAML::BeginMap;
+			out << YAML::Key << "DrawCalls" << YAML::Value << hitch.RendererStats.DrawCalls;
+			out << YAML::Key << "Vertices" << YAML::Value << hitch.RendererStats.Vertices;
+			out << YAML::Key << "Indices" << YAML::Value << hitch.RendererStats.Indeces;
+			out << YAML::Key << "DrawCalls2D" << YAML::Value << hitch.RendererStats2D.DrawCalls;
+			out << YAML::Key << "Quads2D" << YAML::Value << hitch.RendererStats2D.QuadCount;
+			out << YAML::EndMap;
+
+			out << YAML::EndMap;
+		}
+		out << YAML::EndSeq;
+		out << YAML::EndMap;
+
+		std::ofstream fout(path);
+		if (!fout)
+		{
+			EG_CORE_ERROR("[FrameHistory] Failed to export hitches to '{}'", path.u8string());
+			return false;
+		}
+		fout << out.c_str();
+		return true;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Eagle/Core/Core.h"
+#include "Eagle/Core/Application.h"
+#include "Eagle/Renderer/RenderManager.h"
+#include "Eagle/Renderer/SceneRenderer.h"
+
+#include <array>
+#include <deque>
+
+namespace Eagle
+{
+	// Rolling history of frame times, main thread phase timings, GPU pass timings and RHI counters.
+	// Full CPU and GPU timings are only resolved for frames that take longer than the hitch threshold,
+	// and for the last frame while it's requested by `SetCaptureLastFrame` (for example, by an open debug window).
+	// Should only be used by the main thread
+	class FrameHistory
+	{
+	public:
+		// Phases and passes that don't fit are dropped
+		static constexpr uint32_t MaxFrameTimings = 12;
+
+		struct Frame
+		{
+			uint64_t Index = 0; // Number of frames recorded before this one
+			double Time = 0.0; // Application time when the frame has started
+			float FrameTime = 0.f; // ms
+			RHICounters RHIStats;
+#ifdef EG_CPU_TIMINGS
+			std::array<CPUTiming::ScopeTiming, MaxFrameTimings> CPUPhases; // Scopes directly under "Whole frame" of the main thread. In ms
+			uint32_t CPUPhasesCount = 0;
+#endif
+			// Passes directly under the top-level GPU scopes. In ms. GPU timings are read back with a delay of a few frames
+			std::array<GPUPassTiming, MaxFrameTimings> GPUPasses;
+			uint32_t GPUPassesCount = 0;
+		};
+
+		// Full stats of a frame
+		struct Snapshot
+		{
+			uint64_t Index = 0;
+			double Time = 0.0;
+			float FrameTime = 0.f; // ms
+#ifdef EG_CPU_TIMINGS
+			CPUTimingsContainer CPUTimings;
+#endif
+			GPUTimingsContainer GPUTimings; // GPU timings are read back with a delay of a few frames, so they might belong to one of the earlier frames
+			RHIStatistics RHIStats;
+			SceneRenderer::Statistics RendererStats;
+			SceneRenderer::Statistics2D RendererStats2D;
+		};
+
+		// Called by the application once per frame, when the timings of the previous frame are ready.
+		// `time` - start time of the previous frame; `frameTime` - its duration in ms
+		static void AddFrame(double time, float frameTime);
+
+		static const std::deque<Frame>& GetFrames() { return s_Frames; }
+		static const std::deque<Snapshot>& GetHitches() { return s_Hitches; }
+		static void ClearHitches() { s_Hitches.clear(); }
+
+		// If enabled, every frame is snapshotted into `GetLastFrame`, which is as expensive as a hitch
+		static void SetCaptureLastFrame(bool bCapture) { s_bCaptureLastFrame = bCapture; }
+		static const Snapshot& GetLastFrame() { return s_LastFrame; }
+
+		static void SetEnabled(bool bEnabled);
+		static bool IsEnabled() { return s_bEnabled; }
+
+		// How many seconds of frames are kept
+		static void SetHistoryDuration(float seconds) { s_HistoryDuration = glm::max(seconds, 0.f); }
+		static float GetHistoryDuration() { return s_HistoryDuration; }
+
+		// Frames that take longer than this are reported as hitches. In ms
+		static void SetHitchThreshold(float threshold) { s_HitchThreshold = glm::max(threshold, 0.f); }
+		static float GetHitchThreshold() { return s_HitchThreshold; }
+
+		// Older hitches are discarded when the limit is reached
+		static void SetMaxHitches(uint32_t count);
+		static uint32_t GetMaxHitches() { return s_MaxHitches; }
+
+		// Writes all snapshotted hitches into a yaml file
+		static bool ExportHitches(const Path& path);
+
+	private:
+		static std::deque<Frame> s_Frames;
+		static std::deque<Snapshot> s_Hitches;
+		static Snapshot s_LastFrame;
+		static uint64_t s_FrameIndex;
+		static float s_HistoryDuration;
+		static float s_HitchThreshold;
+		static uint32_t s_MaxHitches;
+		static bool s_bEnabled;
+		static bool s_bCaptureLastFrame;
+	};
+}
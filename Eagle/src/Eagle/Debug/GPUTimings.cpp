@@ -1,12 +1,11 @@
 #include "egpch.h"
 
-#ifdef EG_GPU_TIMINGS
-
 #include "GPUTimings.h"
 #include "Eagle/Renderer/VidWrappers/RenderCommandManager.h"
 #include "Eagle/Renderer/RenderManager.h"
 
 #include "Platform/Vulkan/VulkanGPUTimings.h"
+#include "Platform/Null/NullGPUTimings.h"
 
 namespace Eagle
 {
@@ -16,6 +15,7 @@ namespace Eagle
 		switch (RenderManager::GetAPI())
 		{
 			case RendererAPIType::Vulkan: result = MakeRef<VulkanGPUTiming>(); break;
+			case RendererAPIType::Null: result = MakeRef<NullGPUTiming>(); break;
 			default: EG_ASSERT(false);
 		}
 
@@ -23,8 +23,6 @@ namespace Eagle
 		return result;
 	}
 
-	static std::vector<RHIGPUTiming*> s_TimingsStack;
-
 	void RHIGPUTiming::SetParent(RHIGPUTiming* parent)
 	{
 		if (m_Parent == parent)
@@ -37,6 +35,13 @@ namespace Eagle
 		if (m_Parent)
 			m_Parent->AddChild(this);
 	}
+}
+
+#ifdef EG_GPU_TIMINGS
+
+namespace Eagle
+{
+	static std::vector<RHIGPUTiming*> s_TimingsStack;
 
 	GPUTiming::GPUTiming(const Ref<CommandBuffer>& cmd, const std::string_view name)
 		: m_Cmd(cmd), m_Name(name)
@@ -69,6 +74,7 @@ namespace Eagle
 		m_GPUTiming->bIsUsed = true;
 
 		m_FrameIndex = RenderManager::GetCurrentFrameIndex();
+		m_StartCounters = RenderManager::GetCurrentRHIStats();
 		m_Cmd->StartTiming(m_GPUTiming, m_FrameIndex);
 #if EG_GPU_MARKERS
 		m_Cmd->BeginMarker(m_Name);
@@ -98,6 +104,9 @@ namespace Eagle
 #endif
 
 		s_TimingsStack.pop_back();
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		stats.Passes[m_Name] += stats - m_StartCounters;
 	}
 }
 
@@ -2,10 +2,10 @@
 
 #include "Eagle/Core/Core.h"
 
-#ifdef EG_GPU_TIMINGS
-
 namespace Eagle
 {
+	// Timestamp query pair per frame in flight.
+	// Available in all builds, since besides the profiler it's used by the systems that depend on GPU time (for example, dynamic resolution)
 	class RHIGPUTiming
 	{
 	public:
@@ -62,9 +62,17 @@ namespace Eagle
 		std::vector <RHIGPUTiming*> m_Children;
 		float m_Timing = 0.f;
 	};
+}
+
+#ifdef EG_GPU_TIMINGS
+
+#include "Eagle/Renderer/RendererUtils.h"
 
+namespace Eagle
+{
 	class CommandBuffer;
 
+	// Also attributes the RHI calls recorded inside of the scope to `RHIStatistics::Passes`
 	class GPUTiming
 	{
 	public:
@@ -78,6 +86,7 @@ namespace Eagle
 		Ref<CommandBuffer> m_Cmd;
 		Ref<RHIGPUTiming> m_GPUTiming;
 		std::string_view m_Name;
+		RHICounters m_StartCounters;
 		uint32_t m_FrameIndex = uint32_t(-1);
 		bool m_bStarted = false;
 	};
@@ -4,6 +4,7 @@
 #include "Eagle/Renderer/RenderManager.h"
 #include "Eagle/UI/UI.h"
 #include "Platform/Vulkan/VulkanImGuiLayer.h"
+#include "Platform/Null/NullImGuiLayer.h"
 
 namespace Eagle
 {
@@ -16,6 +17,7 @@ namespace Eagle
 		switch (RenderManager::GetAPI())
 		{
 			case RendererAPIType::Vulkan: return MakeRef<VulkanImGuiLayer>();
+			case RendererAPIType::Null: return MakeRef<NullImGuiLayer>();
 		}
 		EG_CORE_ASSERT(false, "Unknown renderer API");
 		return nullptr;
@@ -128,7 +128,10 @@ namespace Eagle
 
         Ref<PhysicsActor> actor = MakeRef<PhysicsActor>(entity, m_Settings);
         m_Actors[entity.GetGUID()] = actor;
-        m_Scene->addActor(*actor->m_RigidActor);
+        if (m_bBatchingActors)
+            m_BatchedActors.push_back(actor->m_RigidActor);
+        else
+            m_Scene->addActor(*actor->m_RigidActor);
 
         actor->SetSimulationData();
         
@@ -146,6 +149,44 @@ namespace Eagle
         physicsActor->m_RigidActor = nullptr;
         m_Actors.erase(physicsActor->GetEntity().GetGUID());
     }
+
+    void PhysicsScene::EndActorsBatch()
+    {
+        m_bBatchingActors = false;
+        if (m_BatchedActors.empty())
+            return;
+
+        m_Scene->addActors(m_BatchedActors.data(), physx::PxU32(m_BatchedActors.size()));
+        m_BatchedActors.clear();
+    }
+
+    void PhysicsScene::RemovePhysicsActors(const std::vector<Ref<PhysicsActor>>& physicsActors)
+    {
+        std::vector<physx::PxActor*> rigidActors;
+        rigidActors.reserve(physicsActors.size());
+        for (auto& physicsActor : physicsActors)
+        {
+            if (physicsActor && physicsActor->m_RigidActor)
+            {
+                physicsActor->RemoveAllColliders();
+                rigidActors.push_back(physicsActor->m_RigidActor);
+            }
+        }
+
+        if (rigidActors.empty())
+            return;
+
+        m_Scene->removeActors(rigidActors.data(), physx::PxU32(rigidActors.size()));
+        for (auto& physicsActor : physicsActors)
+        {
+            if (physicsActor && physicsActor->m_RigidActor)
+            {
+                physicsActor->m_RigidActor->release();
+                physicsActor->m_RigidActor = nullptr;
+                m_Actors.erase(physicsActor->GetEntity().GetGUID());
+            }
+        }
+    }
     
     bool PhysicsScene::Raycast(const glm::vec3& origin, const glm::vec3& dir, float maxDistance, RaycastHit* outHit) const
     {
@@ -202,9 +243,7 @@ namespace Eagle
     {
         if (m_Scene)
         {
-            while (m_Actors.size())
-                RemovePhysicsActor(m_Actors.begin()->second);
-
+            RemoveAllActors();
             m_Actors.clear(); //Just in case
         }
     }
@@ -216,6 +255,16 @@ namespace Eagle
         m_NumSubsteps = 0;
     }
 
+    void PhysicsScene::RemoveAllActors()
+    {
+        std::vector<Ref<PhysicsActor>> actors;
+        actors.reserve(m_Actors.size());
+        for (auto& [id, actor] : m_Actors)
+            actors.push_back(actor);
+
+        RemovePhysicsActors(actors);
+    }
+
     void PhysicsScene::Destroy()
     {
         if (m_Scene)
@@ -224,9 +273,7 @@ namespace Eagle
             if (m_Settings.DebugOnPlay && PhysXDebugger::IsDebugging())
                 PhysXDebugger::StopDebugging();
         #endif
-            while(m_Actors.size())
-                RemovePhysicsActor(m_Actors.begin()->second);
-
+            RemoveAllActors();
             m_Actors.clear(); //Just in case
             m_Scene->release();
             m_Scene = nullptr;
@@ -35,6 +35,13 @@ namespace Eagle
 		//Adds RigidBodyComponent to the entity if none provided.
 		Ref<PhysicsActor> CreatePhysicsActor(Entity& entity);
 		void RemovePhysicsActor(const Ref<PhysicsActor>& physicsActor);
+		// Removes all actors from the PhysX scene with a single call
+		void RemovePhysicsActors(const std::vector<Ref<PhysicsActor>>& physicsActors);
+
+		// Actors that are created between these calls are added to the PhysX scene with a single call when the batch ends.
+		// They can't be woken up or moved kinematically until then
+		void BeginActorsBatch() { m_bBatchingActors = true; }
+		void EndActorsBatch();
 
 		glm::vec3 GetGravity() const { return PhysXUtils::FromPhysXVector(m_Scene->getGravity()); }
 		void SetGravity(const glm::vec3& gravity) { m_Scene->setGravity(PhysXUtils::ToPhysXVector(gravity)); }
@@ -59,6 +66,7 @@ namespace Eagle
 		void UpdateActors();
 		void SyncTransforms();
 
+		void RemoveAllActors();
 		void Destroy();
 
 		bool OverlapGeometry(const glm::vec3& origin, const physx::PxGeometry& geometry, std::array<physx::PxOverlapHit, OVERLAP_MAX_COLLIDERS>& buffer, uint32_t& count) const;
@@ -67,10 +75,12 @@ namespace Eagle
 		PhysicsSettings m_Settings;
 		physx::PxScene* m_Scene = nullptr;
 		std::unordered_map<GUID, Ref<PhysicsActor>> m_Actors;
+		std::vector<physx::PxActor*> m_BatchedActors;
 
 		float m_SubstepSize;
 		float m_Accumulator = 0.f;
 		uint32_t m_NumSubsteps = 0;
 		const uint32_t s_MaxSubsteps = 16;
+		bool m_bBatchingActors = false;
 	};
 }
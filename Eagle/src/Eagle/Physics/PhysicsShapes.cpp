@@ -50,7 +50,7 @@ namespace Eagle
 		m_Shape->setFlag(physx::PxShapeFlag::Enum::eSIMULATION_SHAPE, !bTrigger);
 		m_Shape->setFlag(physx::PxShapeFlag::Enum::eTRIGGER_SHAPE, bTrigger);
 		m_Shape->setLocalPose(PhysXUtils::ToPhysXTranform(m_Component.GetRelativeTransform()));
-		SetShowCollision(m_Component.IsCollisionVisible());
+		SetShowCollision(false); // Primitive colliders are visualized by the renderer using debug shapes
 	}
 
 	void BoxColliderShape::SetSize(const glm::vec3& size)
@@ -74,7 +74,7 @@ namespace Eagle
 		m_Shape->setFlag(physx::PxShapeFlag::Enum::eSIMULATION_SHAPE, !bTrigger);
 		m_Shape->setFlag(physx::PxShapeFlag::Enum::eTRIGGER_SHAPE, bTrigger);
 		m_Shape->setLocalPose(PhysXUtils::ToPhysXTranform(m_Component.GetRelativeTransform()));
-		SetShowCollision(m_Component.IsCollisionVisible());
+		SetShowCollision(false);
 	}
 
 	void SphereColliderShape::SetRadius(float radius)
@@ -99,7 +99,7 @@ namespace Eagle
 		m_Shape->setFlag(physx::PxShapeFlag::Enum::eSIMULATION_SHAPE, !bTrigger);
 		m_Shape->setFlag(physx::PxShapeFlag::Enum::eTRIGGER_SHAPE, bTrigger);
 		m_Shape->setLocalPose(PhysXUtils::ToPhysXTranform(m_Component.GetRelativeTransform()));
-		SetShowCollision(m_Component.IsCollisionVisible());
+		SetShowCollision(false);
 	}
 
 	void CapsuleColliderShape::SetHeightAndRadius(float height, float radius)
@@ -24,6 +24,7 @@ namespace Eagle
 	std::mutex g_ImGuiMutex;
 #endif
 	std::mutex g_TimingsMutex;
+	static std::mutex s_RHIStatsMutex;
 
 	struct RendererData
 	{
@@ -56,6 +57,9 @@ namespace Eagle
 		Ref<Image> DummyDepthImage;
 		Ref<Image> DummyCubeDepthImage;
 		Ref<Image> BRDFLUTImage;
+		Ref<Buffer> UnitQuadVertexBuffer;
+		Ref<Buffer> UnitQuadIndexBuffer;
+		Ref<Buffer> UnitDoubleSidedQuadIndexBuffer;
 		Ref<TextureCube> DummyIBL;
 		Ref<TextureCube> IBLTexture;
 
@@ -72,6 +76,9 @@ namespace Eagle
 		uint32_t CurrentFrameIndex = 0;
 		uint32_t CurrentReleaseFrameIndex = 0;
 		uint64_t FrameNumber = 0;
+
+		RHIStatistics RHIStats;
+		RHIStatistics LastRHIStats;
 	};
 
 	struct ShaderDependencies
@@ -197,7 +204,7 @@ namespace Eagle
 		ColorAttachment colorAttachment;
 		colorAttachment.Image = swapchainImages[0];
 		colorAttachment.InitialLayout = ImageLayoutType::Unknown;
-		colorAttachment.FinalLayout = ImageLayoutType::Present;
+		colorAttachment.FinalLayout = s_RendererData->Swapchain->GetPresentLayout();
 		colorAttachment.ClearOperation = ClearOperation::Clear;
 		colorAttachment.ClearColor = glm::vec4{ 0.f, 0.f, 0.f, 1.f };
 
@@ -273,15 +280,19 @@ namespace Eagle
 
 		InitHaltonSequence();
 
-		s_RendererData->Swapchain->SetOnSwapchainRecreatedCallback([data = s_RendererData]()
+		// There's no swapchain if the renderer API is null. Nothing is presented in that case
+		if (s_RendererData->Swapchain)
 		{
-			data->PresentFramebuffers.clear();
-			auto& swapchainImages = data->Swapchain->GetImages();
-			glm::uvec2 size = s_RendererData->Swapchain->GetSize();
-			const void* renderPassHandle = data->PresentPipeline->GetRenderPassHandle();
-			for (auto& image : swapchainImages)
-				data->PresentFramebuffers.push_back(Framebuffer::Create({ image }, size, data->PresentPipeline->GetRenderPassHandle()));
-		});
+			s_RendererData->Swapchain->SetOnSwapchainRecreatedCallback([data = s_RendererData]()
+			{
+				data->PresentFramebuffers.clear();
+				auto& swapchainImages = data->Swapchain->GetImages();
+				glm::uvec2 size = s_RendererData->Swapchain->GetSize();
+				const void* renderPassHandle = data->PresentPipeline->GetRenderPassHandle();
+				for (auto& image : swapchainImages)
+					data->PresentFramebuffers.push_back(Framebuffer::Create({ image }, size, data->PresentPipeline->GetRenderPassHandle()));
+			});
+		}
 
 		s_RendererData->GraphicsCommandManager = CommandManager::Create(CommandQueueFamily::Graphics, true);
 		s_RendererData->CommandBuffers.reserve(RendererConfig::FramesInFlight);
@@ -358,10 +369,28 @@ namespace Eagle
 		s_RendererData->DummyCubeDepthImage = CreateDepthImage(glm::uvec3{ 1, 1, 1 }, "DummyDepthImage_Cube", true);
 		s_RendererData->DummyDepthImage = CreateDepthImage(glm::uvec3{ 1, 1, 1 }, "DummyDepthImage", false);
 
+		{
+			BufferSpecifications vertexSpecs;
+			vertexSpecs.Size = sizeof(glm::vec2) * 8;
+			vertexSpecs.Layout = BufferReadAccess::Vertex;
+			vertexSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
+			s_RendererData->UnitQuadVertexBuffer = Buffer::Create(vertexSpecs, "UnitQuad_VertexBuffer");
+
+			BufferSpecifications indexSpecs;
+			indexSpecs.Size = sizeof(Index) * UnitQuadIndexCount;
+			indexSpecs.Layout = BufferReadAccess::Index;
+			indexSpecs.Usage = BufferUsage::IndexBuffer | BufferUsage::TransferDst;
+			s_RendererData->UnitQuadIndexBuffer = Buffer::Create(indexSpecs, "UnitQuad_IndexBuffer");
+
+			indexSpecs.Size = sizeof(Index) * UnitDoubleSidedQuadIndexCount;
+			s_RendererData->UnitDoubleSidedQuadIndexBuffer = Buffer::Create(indexSpecs, "UnitQuad_DoubleSided_IndexBuffer");
+		}
+
 		MaterialSystem::Init();
 		TextureSystem::Init();
 		// Init renderer pipelines
-		SetupPresentPipeline();
+		if (s_RendererData->Swapchain)
+			SetupPresentPipeline();
 		SetupIBLPipeline();
 		SetupBRDFLUTPipeline();
 
@@ -375,6 +404,17 @@ namespace Eagle
 			cmd->TransitionLayout(s_RendererData->DummyImageCube, ImageLayoutType::Unknown, ImageReadAccess::PixelShaderRead);
 			cmd->TransitionLayout(s_RendererData->DummyImageR16, ImageLayoutType::Unknown, ImageReadAccess::PixelShaderRead);
 			cmd->TransitionLayout(s_RendererData->DummyImageR16Cube, ImageLayoutType::Unknown, ImageReadAccess::PixelShaderRead);
+
+			constexpr glm::vec2 quadVertices[8] = { { 0.f, 1.f }, { 1.f, 1.f }, { 1.f, 0.f }, { 0.f, 0.f },
+													{ 0.f, 1.f }, { 1.f, 1.f }, { 1.f, 0.f }, { 0.f, 0.f } };
+			constexpr Index quadIndices[UnitQuadIndexCount] = { 0, 1, 2, 2, 3, 0 };
+			constexpr Index doubleSidedQuadIndices[UnitDoubleSidedQuadIndexCount] = { 0, 1, 2, 2, 3, 0, 6, 5, 4, 4, 7, 6 };
+			cmd->Write(s_RendererData->UnitQuadVertexBuffer, quadVertices, sizeof(quadVertices), 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->Write(s_RendererData->UnitQuadIndexBuffer, quadIndices, sizeof(quadIndices), 0, BufferLayoutType::Unknown, BufferReadAccess::Index);
+			cmd->Write(s_RendererData->UnitDoubleSidedQuadIndexBuffer, doubleSidedQuadIndices, sizeof(doubleSidedQuadIndices), 0, BufferLayoutType::Unknown, BufferReadAccess::Index);
+			cmd->TransitionLayout(s_RendererData->UnitQuadVertexBuffer, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(s_RendererData->UnitQuadIndexBuffer, BufferReadAccess::Index, BufferReadAccess::Index);
+			cmd->TransitionLayout(s_RendererData->UnitDoubleSidedQuadIndexBuffer, BufferReadAccess::Index, BufferReadAccess::Index);
 		});
 
 		// Render BRDF LUT
@@ -464,6 +504,21 @@ namespace Eagle
 		return s_RendererData->DummyImage3D;
 	}
 
+	const Ref<Buffer>& RenderManager::GetUnitQuadVertexBuffer()
+	{
+		return s_RendererData->UnitQuadVertexBuffer;
+	}
+
+	const Ref<Buffer>& RenderManager::GetUnitQuadIndexBuffer()
+	{
+		return s_RendererData->UnitQuadIndexBuffer;
+	}
+
+	const Ref<Buffer>& RenderManager::GetUnitDoubleSidedQuadIndexBuffer()
+	{
+		return s_RendererData->UnitDoubleSidedQuadIndexBuffer;
+	}
+
 	const glm::vec2 RenderManager::GetHalton(uint32_t index)
 	{
 		EG_ASSERT(index < s_JitterSize);
@@ -550,6 +605,9 @@ namespace Eagle
 	{
 		RenderManager::Submit([](Ref<CommandBuffer>& cmd)
 		{
+			if (!s_RendererData->Swapchain)
+				return;
+
 			struct PushData
 			{
 				uint32_t FlipX = 0;
@@ -588,7 +646,8 @@ namespace Eagle
 
 			auto& fence = s_RendererData->Fences[frameIndex];
 			auto& semaphore = s_RendererData->Semaphores[frameIndex];
-			auto& imageAcquireSemaphore = s_RendererData->Swapchain->AcquireImage(&s_RendererData->SwapchainImageIndex);
+			auto& swapchain = s_RendererData->Swapchain;
+			Ref<Semaphore> imageAcquireSemaphore = swapchain ? swapchain->AcquireImage(&s_RendererData->SwapchainImageIndex) : nullptr;
 			fence->Reset();
 
 			UpdateGPUTimings();
@@ -603,14 +662,29 @@ namespace Eagle
 			}
 			cmd->End();
 
+			{
+				std::scoped_lock lock(s_RHIStatsMutex);
+				std::swap(s_RendererData->LastRHIStats, s_RendererData->RHIStats);
+			}
+			// Passes are cleared instead of reallocated, so that the buckets are reused
+			static_cast<RHICounters&>(s_RendererData->RHIStats) = RHICounters();
+			s_RendererData->RHIStats.Passes.clear();
+
 			{
 				EG_CPU_TIMING_SCOPED("Submit & Present");
-				s_RendererData->GraphicsCommandManager->Submit(cmd.get(), 1, fence, imageAcquireSemaphore.get(), 1, semaphore.get(), 1);
+				if (swapchain && !swapchain->IsOffscreen())
 				{
+					s_RendererData->GraphicsCommandManager->Submit(cmd.get(), 1, fence, imageAcquireSemaphore.get(), 1, semaphore.get(), 1);
 #ifdef EG_WITH_EDITOR // TODO: Check if this is needed
 					std::scoped_lock lock(g_ImGuiMutex); // Required. Otherwise new ImGui windows will cause crash
 #endif
-					s_RendererData->Swapchain->Present(semaphore);
+					swapchain->Present(semaphore);
+				}
+				else
+				{
+					s_RendererData->GraphicsCommandManager->Submit(cmd.get(), 1, fence);
+					if (swapchain)
+						swapchain->Present(nullptr);
 				}
 			}
 
@@ -761,7 +835,7 @@ namespace Eagle
 
 	void* RenderManager::GetPresentRenderPassHandle()
 	{
-		return s_RendererData->PresentPipeline->GetRenderPassHandle();
+		return s_RendererData->PresentPipeline ? s_RendererData->PresentPipeline->GetRenderPassHandle() : nullptr;
 	}
 
 	uint64_t RenderManager::GetFrameNumber()
@@ -769,6 +843,23 @@ namespace Eagle
 		return s_RendererData->FrameNumber;
 	}
 
+	RHIStatistics RenderManager::GetRHIStats()
+	{
+		std::scoped_lock lock(s_RHIStatsMutex);
+		return s_RendererData->LastRHIStats;
+	}
+
+	RHICounters RenderManager::GetRHICounters()
+	{
+		std::scoped_lock lock(s_RHIStatsMutex);
+		return s_RendererData->LastRHIStats;
+	}
+
+	RHIStatistics& RenderManager::GetCurrentRHIStats()
+	{
+		return s_RendererData->RHIStats;
+	}
+
 	GPUTimingsContainer RenderManager::GetTimings()
 	{
 		GPUTimingsContainer result;
@@ -780,6 +871,27 @@ namespace Eagle
 		return result;
 	}
 
+	uint32_t RenderManager::GetPassTimings(GPUPassTiming* outTimings, uint32_t maxCount)
+	{
+		uint32_t count = 0;
+#ifdef EG_GPU_TIMINGS
+		std::scoped_lock lock(g_TimingsMutex);
+		for (auto& [name, weakTiming] : s_RendererData->RHIGPUTimingsParentless)
+		{
+			Ref<RHIGPUTiming> timing = weakTiming.lock();
+			if (!timing)
+				continue;
+
+			const auto& children = timing->GetChildren();
+			if (children.empty() && count < maxCount)
+				outTimings[count++] = { timing->GetName(), timing->GetTiming() };
+			for (size_t i = 0; i < children.size() && count < maxCount; ++i)
+				outTimings[count++] = { children[i]->GetName(), children[i]->GetTiming() };
+		}
+#endif
+		return count;
+	}
+
 #ifdef EG_GPU_TIMINGS
 	void RenderManager::RegisterGPUTiming(Ref<RHIGPUTiming>& timing, std::string_view name)
 	{
@@ -34,6 +34,7 @@ namespace Eagle
 	class Texture;
 	class Texture2D;
 	class TextureCube;
+	class Buffer;
 	struct Transform;
 
 	struct GPUTimingData
@@ -45,6 +46,12 @@ namespace Eagle
 
 	using GPUTimingsContainer = std::vector<GPUTimingData>;
 
+	struct GPUPassTiming
+	{
+		std::string_view Name;
+		float Timing = 0.f;
+	};
+
 	class RenderManager
 	{
 	public:
@@ -78,10 +85,23 @@ namespace Eagle
 		static const Ref<Image>& GetDummyImageR16Cube();
 		static const Ref<Image>& GetDummyImage3D();
 
+		// Static quad that is used for instanced rendering of sprites, billboards, glyphs, etc.
+		// Vertex buffer contains 4 `vec2` corners: (0, 1), (1, 1), (1, 0), (0, 0), and then the same 4 corners again for back faces.
+		// Index buffer contains 6 indices of the front face. Double-sided index buffer also contains 6 indices of the back face (vertices 4-7)
+		static const Ref<Buffer>& GetUnitQuadVertexBuffer();
+		static const Ref<Buffer>& GetUnitQuadIndexBuffer();
+		static const Ref<Buffer>& GetUnitDoubleSidedQuadIndexBuffer();
+		static constexpr uint32_t UnitQuadIndexCount = 6u;
+		static constexpr uint32_t UnitDoubleSidedQuadIndexCount = 12u;
+
 		static const glm::vec2 GetHalton(uint32_t index);
 		static const glm::vec2 GetHalton() { return GetHalton(GetFrameNumber() % s_JitterSize); }
 
 		static GPUTimingsContainer GetTimings();
+		// Timings of the passes that are directly under the top-level GPU scopes (for example, under "Whole frame").
+		// Top-level scopes without children are written as is. Doesn't allocate, so it can be called every frame.
+		// Returns the number of written timings
+		static uint32_t GetPassTimings(GPUPassTiming* outTimings, uint32_t maxCount);
 #ifdef EG_GPU_TIMINGS
 		static void RegisterGPUTiming(Ref<RHIGPUTiming>& timing, std::string_view name);
 		static void RegisterGPUTimingParentless(Ref<RHIGPUTiming>& timing, std::string_view name);
@@ -142,6 +162,13 @@ namespace Eagle
 		static void* GetPresentRenderPassHandle();
 		static uint64_t GetFrameNumber();
 
+		// Stats of the last recorded frame. Returns a copy since the render thread replaces them every frame
+		static RHIStatistics GetRHIStats();
+		// Same as `GetRHIStats` but without per-pass counters, so it's cheap enough to be called every frame
+		static RHICounters GetRHICounters();
+		// Stats of the frame that is being recorded. Should only be used by the render thread
+		static RHIStatistics& GetCurrentRHIStats();
+
 		static void SetImmediateDeletionMode(bool bEnabled) { bImmediateDeletionMode = bEnabled; }
 
 	private:
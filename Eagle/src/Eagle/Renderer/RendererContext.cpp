@@ -1,16 +1,19 @@
 #include "egpch.h"
 #include "RendererContext.h"
 #include "Platform/Vulkan/VulkanContext.h"
+#include "Platform/Null/NullContext.h"
 
 namespace Eagle
 {
 	RendererAPIType RendererContext::s_API = RendererAPIType::None;
+	bool RendererContext::s_bHeadless = false;
 
 	Ref<RendererContext> RendererContext::Create()
 	{
 		switch (RendererContext::Current())
 		{
 			case RendererAPIType::Vulkan: return MakeRef<VulkanContext>();
+			case RendererAPIType::Null: return MakeRef<NullContext>();
 		}
 
 		EG_CORE_ASSERT(false, "Unknown Renderer API");
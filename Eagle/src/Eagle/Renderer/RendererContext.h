@@ -7,7 +7,8 @@ namespace Eagle
 	enum class RendererAPIType
 	{
 		None = 0,
-		Vulkan = 1
+		Vulkan = 1,
+		Null = 2 // No GPU work is done. Used for headless CPU benchmarks
 	};
 
 	struct RendererCapabilities
@@ -36,10 +37,16 @@ namespace Eagle
 		static RendererAPIType Current() { return s_API; }
 		static void SetAPI(RendererAPIType api) { s_API = api; }
 
+		// Headless: there's no window and no surface. Frames are rendered into an offscreen image ring instead of a swapchain.
+		// Must be set before the context is created
+		static bool IsHeadless() { return s_bHeadless; }
+		static void SetHeadless(bool bHeadless) { s_bHeadless = bHeadless; }
+
 		static Ref<RendererContext> Create();
 
 	protected:
 		RendererCapabilities m_Caps;
 		static RendererAPIType s_API;
+		static bool s_bHeadless;
 	};
 }
@@ -3,6 +3,8 @@
 #include "Eagle/Core/Core.h"
 #include <glm/glm.hpp>
 #include <array>
+#include <atomic>
+#include <unordered_map>
 
 namespace Eagle
 {
@@ -426,6 +428,30 @@ namespace Eagle
         TAA
     };
 
+    // Temporal upscaling. The scene is rendered at a lower resolution and reconstructed to the output resolution by TAA.
+    // Requires TAA
+    enum class UpscalingMode
+    {
+        Native,
+        Quality,
+        Balanced,
+        Performance,
+        UltraPerformance
+    };
+
+    // Returns the fraction of the output resolution (per axis) that the scene is rendered at
+    inline constexpr float GetUpscalingRenderScale(UpscalingMode mode)
+    {
+        switch (mode)
+        {
+            case UpscalingMode::Quality: return 1.f / 1.5f;
+            case UpscalingMode::Balanced: return 1.f / 1.7f;
+            case UpscalingMode::Performance: return 1.f / 2.f;
+            case UpscalingMode::UltraPerformance: return 1.f / 3.f;
+            default: return 1.f;
+        }
+    }
+
     struct PhotoLinearTonemappingSettings
     {
         float Sensitivity = 0.4f;
@@ -474,6 +500,77 @@ namespace Eagle
         // TODO: Remove it by implementing a better descriptors system, that will allow them to be reused and created separetely from pipelines (currently, descriptors are created per pipeline).
         // Max Textures that can be imported. It also applies to fonts and shadow maps.
         static constexpr uint32_t MaxTextures = 1024;
+
+        // Cached descriptor sets that weren't used for this number of frames are freed
+        static constexpr uint32_t DescriptorSetLifetime = 120;
+    };
+
+    // Unlike API handles, which can be reused by the driver once an object is destroyed, these IDs are never reused.
+    // Images, buffers and samplers get a new one each time their API object is created, so caches can be keyed by it
+    inline uint64_t GenerateRenderResourceID()
+    {
+        static std::atomic<uint64_t> s_NextID = 1;
+        return s_NextID.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Counters of the RHI calls
+    struct RHICounters
+    {
+        uint32_t DescriptorWrites = 0; // Number of descriptor sets written
+        uint32_t DescriptorBinds = 0;
+        uint32_t DescriptorCacheHits = 0; // Number of times a cached descriptor set was reused instead of writing a new one
+        uint32_t PipelineBinds = 0;
+        uint32_t VertexBufferBinds = 0;
+        uint32_t IndexBufferBinds = 0;
+        uint32_t RenderPassBegins = 0;
+        uint32_t Draws = 0;
+        uint32_t Dispatches = 0;
+        uint32_t Barriers = 0; // Image and buffer barriers, including the ones issued internally by copies and writes
+        uint32_t StagingAllocations = 0; // Staging buffers acquired by `CommandBuffer::Write`
+        uint64_t BytesWritten = 0; // Bytes uploaded by `CommandBuffer::Write`
+
+        RHICounters& operator+= (const RHICounters& other)
+        {
+            DescriptorWrites += other.DescriptorWrites;
+            DescriptorBinds += other.DescriptorBinds;
+            DescriptorCacheHits += other.DescriptorCacheHits;
+            PipelineBinds += other.PipelineBinds;
+            VertexBufferBinds += other.VertexBufferBinds;
+            IndexBufferBinds += other.IndexBufferBinds;
+            RenderPassBegins += other.RenderPassBegins;
+            Draws += other.Draws;
+            Dispatches += other.Dispatches;
+            Barriers += other.Barriers;
+            StagingAllocations += other.StagingAllocations;
+            BytesWritten += other.BytesWritten;
+            return *this;
+        }
+
+        RHICounters operator- (const RHICounters& other) const
+        {
+            RHICounters result = *this;
+            result.DescriptorWrites -= other.DescriptorWrites;
+            result.DescriptorBinds -= other.DescriptorBinds;
+            result.DescriptorCacheHits -= other.DescriptorCacheHits;
+            result.PipelineBinds -= other.PipelineBinds;
+            result.VertexBufferBinds -= other.VertexBufferBinds;
+            result.IndexBufferBinds -= other.IndexBufferBinds;
+            result.RenderPassBegins -= other.RenderPassBegins;
+            result.Draws -= other.Draws;
+            result.Dispatches -= other.Dispatches;
+            result.Barriers -= other.Barriers;
+            result.StagingAllocations -= other.StagingAllocations;
+            result.BytesWritten -= other.BytesWritten;
+            return result;
+        }
+    };
+
+    // Counters of the RHI calls made during a frame
+    struct RHIStatistics : public RHICounters
+    {
+        // Counters of each GPU timing scope, keyed by its name. They include the counters of the nested scopes.
+        // If a scope is recorded several times during a frame, its counters are summed up
+        std::unordered_map<std::string_view, RHICounters> Passes;
     };
 
     class Texture2D;
@@ -561,10 +658,16 @@ namespace Eagle
         }
         float GetRadius() const { return m_Radius; }
 
+        // If set, each frame computes AO only for one pixel of every 2x2 quad (rotating each frame),
+        // and the denoiser accumulates the rest over time. Roughly 4x cheaper AO pass
+        void SetTemporal(bool bTemporal) { m_bTemporal = bTemporal; }
+        bool IsTemporal() const { return m_bTemporal; }
+
         bool operator== (const GTAOSettings& other) const
         {
             return m_NumberOfSamples == other.m_NumberOfSamples &&
-                m_Radius == other.m_Radius;
+                m_Radius == other.m_Radius &&
+                m_bTemporal == other.m_bTemporal;
         }
 
         bool operator!= (const GTAOSettings& other) const { return !(*this == other); }
@@ -572,6 +675,7 @@ namespace Eagle
     private:
         uint32_t m_NumberOfSamples = 8; // For each direction
         float m_Radius = 0.5f;
+        bool m_bTemporal = false;
     };
 
     enum class FogEquation
@@ -608,6 +712,7 @@ namespace Eagle
         float CascadesSmoothTransitionAlpha = 3.5f / 100.f;
         bool bJitter = false;
         bool bMotionBuffer = false;
+        bool bScaledRendering = false; // Scene is rendered into a sub-rect of render targets and upscaled by TAA
     };
 
     struct PBRConstantsKernelInfo
@@ -649,9 +754,16 @@ namespace Eagle
         bool bEnableCumulusClouds = false;
     };
 
+    enum class VolumetricLightsMethod
+    {
+        Froxels,     // Scattering is evaluated in a camera-aligned 3D grid and reused across frames. Cost doesn't depend on the resolution
+        RayMarching  // Scattering is ray-marched per pixel at half resolution. More precise but much slower
+    };
+
     struct VolumetricLightsSettings
     {
-        uint32_t Samples = 20;
+        VolumetricLightsMethod Method = VolumetricLightsMethod::Froxels;
+        uint32_t Samples = 20; // Used only by `RayMarching`
         float MaxScatteringDistance = 250.f;
         float FogSpeed = 1.f;
         bool bFogEnable = true;
@@ -659,7 +771,8 @@ namespace Eagle
 
         bool operator== (const VolumetricLightsSettings& other) const
         {
-            return Samples == other.Samples &&
+            return Method == other.Method &&
+                Samples == other.Samples &&
                 MaxScatteringDistance == other.MaxScatteringDistance &&
                 FogSpeed == other.FogSpeed &&
                 bFogEnable == other.bFogEnable &&
@@ -672,6 +785,30 @@ namespace Eagle
         }
     };
 
+    // Scales the internal render resolution to keep the GPU time of a scene close to `TargetGPUTime`.
+    // Render targets are kept at the viewport size, the scene is rendered into their top-left part and TAA upsamples it.
+    // If upscaling is used, `MaxScale` is limited by its scale. Requires TAA
+    struct DynamicResolutionSettings
+    {
+        float TargetGPUTime = 16.f; // In ms
+        float MinScale = 0.5f;
+        float MaxScale = 1.f;
+        bool bEnable = false;
+
+        bool operator== (const DynamicResolutionSettings& other) const
+        {
+            return TargetGPUTime == other.TargetGPUTime &&
+                MinScale == other.MinScale &&
+                MaxScale == other.MaxScale &&
+                bEnable == other.bEnable;
+        }
+
+        bool operator!= (const DynamicResolutionSettings& other) const
+        {
+            return !((*this) == other);
+        }
+    };
+
     struct ShadowMapsSettings
     {
         uint32_t PointLightShadowMapSize = 2048u;
@@ -716,6 +853,7 @@ namespace Eagle
         FogSettings FogSettings;
         ShadowMapsSettings ShadowsSettings;
         VolumetricLightsSettings VolumetricSettings;
+        DynamicResolutionSettings DynamicResolution;
         PhotoLinearTonemappingSettings PhotoLinearTonemappingParams;
         FilmicTonemappingSettings FilmicTonemappingParams;
         float Gamma = 2.2f;
@@ -724,6 +862,7 @@ namespace Eagle
         TonemappingMethod Tonemapping = TonemappingMethod::ACES;
         AmbientOcclusion AO = AmbientOcclusion::None;
         AAMethod AA = AAMethod::None;
+        UpscalingMode Upscaling = UpscalingMode::Native;
         bool bTranslucentShadows = true;
         bool bEnableSoftShadows = true;
         bool bEnableCSMSmoothTransition = true;
@@ -743,12 +882,14 @@ namespace Eagle
                 FogSettings == other.FogSettings &&
                 ShadowsSettings == other.ShadowsSettings &&
                 VolumetricSettings == other.VolumetricSettings &&
+                DynamicResolution == other.DynamicResolution &&
                 Gamma == other.Gamma &&
                 Exposure == other.Exposure &&
                 LineWidth == other.LineWidth &&
                 Tonemapping == other.Tonemapping &&
                 AO == other.AO &&
                 AA == other.AA &&
+                Upscaling == other.Upscaling &&
                 bTranslucentShadows == other.bTranslucentShadows &&
                 bEnableSoftShadows == other.bEnableSoftShadows &&
                 bEnableCSMSmoothTransition == other.bEnableCSMSmoothTransition &&
@@ -773,6 +914,29 @@ namespace Eagle
         glm::vec3 End = glm::vec3(0.f);
     };
 
+    // Wireframe shapes that are rendered instanced. All of them are unit sized:
+    // Sphere - radius of 1 around the origin;
+    // Box - size of 1 (extents of 0.5) around the origin;
+    // Cylinder - radius of 1 around X axis, from x = -1 to x = 1. Without caps, used for capsules;
+    // Hemisphere - radius of 1, the dome is pointing towards +X. Used for capsules;
+    // Cone - apex is at the origin, the base has a radius of 1 and is at z = 1.
+    enum class DebugShapeType : uint8_t
+    {
+        Sphere,
+        Box,
+        Cylinder,
+        Hemisphere,
+        Cone,
+        Count
+    };
+
+    struct RendererDebugShape
+    {
+        glm::mat4 Transform = glm::mat4(1.f);
+        glm::vec3 Color = glm::vec3(0, 1, 0);
+        DebugShapeType Type = DebugShapeType::Sphere;
+    };
+
     // Returns bits
     inline constexpr uint32_t GetImageFormatBPP(ImageFormat format)
     {
@@ -980,6 +1144,33 @@ namespace Eagle
         } while (current > 0u);
         return r;
     }
+
+    // Finds a range of elements [outBegin; outEnd) of `current` that differ from `prev`. Used to upload only changed parts of CPU-side data.
+    // The range is merged into the passed one, so that it can be accumulated between uploads. Returns false if nothing has changed
+    template<typename T>
+    inline bool AccumulateChangedRange(const std::vector<T>& prev, const std::vector<T>& current, size_t& outBegin, size_t& outEnd)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        const size_t commonSize = glm::min(prev.size(), current.size());
+        size_t begin = 0;
+        while (begin < commonSize && memcmp(&prev[begin], &current[begin], sizeof(T)) == 0)
+            ++begin;
+
+        size_t end = current.size();
+        if (prev.size() == current.size())
+        {
+            while (end > begin && memcmp(&prev[end - 1], &current[end - 1], sizeof(T)) == 0)
+                --end;
+        }
+
+        if (begin >= end)
+            return prev.size() != current.size();
+
+        outBegin = glm::min(outBegin, begin);
+        outEnd = glm::max(outEnd, end);
+        return true;
+    }
 }
 
 namespace std
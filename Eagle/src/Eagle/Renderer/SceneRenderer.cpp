@@ -23,6 +23,25 @@
 
 namespace Eagle
 {
+	static constexpr std::string_view s_SceneRendererTimingName = "Scene Renderer";
+	static constexpr float s_MinRenderScale = 0.25f;
+	static constexpr float s_RenderScaleStep = 0.05f;
+
+	// Remaps NDC so that [-1; 1] covers only the top-left `scale` part of render targets.
+	// This way shaders that reconstruct positions from UVs of render targets keep working without knowing about the scale
+	static glm::mat4 ApplyRenderScale(const glm::mat4& proj, float scale)
+	{
+		if (scale == 1.f)
+			return proj;
+
+		glm::mat4 remap = glm::mat4(1.f);
+		remap[0][0] = scale;
+		remap[1][1] = scale;
+		remap[3][0] = scale - 1.f;
+		remap[3][1] = scale - 1.f;
+		return remap * proj;
+	}
+
 	template <typename TaskClass, typename Task, typename... Args>
 	static void InitOptionalTask(Scope<Task>& task, const SceneRendererSettings& settings, bool bEnabled, Args&&... args)
 	{
@@ -57,6 +76,8 @@ namespace Eagle
 
 		m_GBuffer.Init({ m_Size, 1 });
 		m_GBuffer.InitOptional(m_Options.InternalState, glm::uvec3(m_Size, 1u));
+		m_FrameGPUTiming = RHIGPUTiming::Create(s_SceneRendererTimingName);
+
 		// Create tasks
 		m_RenderMeshesTask = MakeScope<RenderMeshesTask>(*this);
 		m_RenderSpritesTask = MakeScope<RenderSpritesTask>(*this);
@@ -115,9 +136,25 @@ namespace Eagle
 			renderer->m_PrevView = renderer->m_View;
 			renderer->m_PrevProjection = renderer->m_Projection;
 			renderer->m_PrevViewProjection = renderer->m_ViewProjection;
+			renderer->m_PrevRenderScale = renderer->m_RenderScale;
+
+			// The GPU has finished the frame that used the same frame-in-flight index, so its timestamps are available
+			const uint32_t frameInFlight = RenderManager::GetCurrentFrameIndex();
+			renderer->m_FrameGPUTiming->QueryTiming(frameInFlight);
+
+			const auto& rtOptions = renderer->m_Options_RT;
+			if (rtOptions.InternalState.bScaledRendering)
+			{
+				if (rtOptions.DynamicResolution.bEnable)
+					renderer->UpdateRenderScale();
+				else
+					renderer->m_RenderScale = GetUpscalingRenderScale(rtOptions.Upscaling);
+			}
+			else
+				renderer->m_RenderScale = 1.f;
 
 			renderer->m_View = viewMat;
-			renderer->m_Projection = proj;
+			renderer->m_Projection = ApplyRenderScale(proj, renderer->m_RenderScale);
 			renderer->m_ViewProjection = renderer->m_Projection * renderer->m_View;
 			renderer->m_ViewPos = viewPosition;
 			renderer->m_CameraCascadeProjections = std::move(cascadeProjections);
@@ -130,11 +167,25 @@ namespace Eagle
 				// In order to use these numbers as offset for jittering,
 				// we need to adjust the range so that the positions are jittered both in positiveand negative directionsand are not jittered more than the size
 				glm::vec2 jitter = RenderManager::GetHalton();
+				if (renderer->m_RenderScale < 1.f)
+				{
+					// When upscaling, each output pixel needs to be covered by enough samples.
+					// So the sequence length grows with the upscaling ratio
+					const float ratio = 1.f / renderer->m_RenderScale;
+					const uint32_t phases = glm::clamp(uint32_t(glm::ceil(8.f * ratio * ratio)), s_JitterSize, 128u);
+					const uint32_t index = uint32_t(RenderManager::GetFrameNumber() % phases);
+					jitter = glm::vec2(CreateHaltonSequence(index + 1u, 2u), CreateHaltonSequence(index + 1u, 3u));
+				}
 				jitter = ((jitter - 0.5f) / glm::vec2(renderer->m_Size)) * 2.f;
+				renderer->m_JitterOffset = jitter;
 				cmd->Write(renderer->m_Jitter, &jitter, sizeof(glm::vec2), 0, BufferLayoutType::Unknown, BufferReadAccess::Uniform);
 				cmd->Barrier(renderer->m_Jitter);
 			}
 
+			EG_GPU_TIMING_SCOPED(cmd, s_SceneRendererTimingName);
+			cmd->StartTiming(renderer->m_FrameGPUTiming, frameInFlight);
+			cmd->SetRenderAreaScale(renderer->m_RenderScale);
+
 			renderer->m_LightsManagerTask->RecordCommandBuffer(cmd);
 			renderer->m_GeometryManagerTask->RecordCommandBuffer(cmd);
 			renderer->m_RenderMeshesTask->RecordCommandBuffer(cmd);
@@ -162,6 +213,12 @@ namespace Eagle
 			
 			renderer->m_TransparencyTask->RecordCommandBuffer(cmd);
 
+			// When the scene is rendered at a lower resolution, the grid needs to be upscaled too since it's depth tested against the scene
+			const bool bScaledRendering = renderer->m_Options_RT.InternalState.bScaledRendering;
+			if (bRenderGrid && bScaledRendering)
+				renderer->m_GridTask->RecordCommandBuffer(cmd);
+
+			cmd->SetRenderAreaScale(1.f);
 			if (renderer->m_Options_RT.AA == AAMethod::TAA)
 				renderer->m_TAATask->RecordCommandBuffer(cmd);
 
@@ -172,7 +229,7 @@ namespace Eagle
 				renderer->m_BloomTask->RecordCommandBuffer(cmd);
 			renderer->m_PostProcessingPassTask->RecordCommandBuffer(cmd);
 
-			if (bRenderGrid)
+			if (bRenderGrid && !bScaledRendering)
 				renderer->m_GridTask->RecordCommandBuffer(cmd);
 
 			// Handle object picking. Always enabled in editor mode
@@ -200,6 +257,7 @@ namespace Eagle
 				renderer->m_GBuffer.ObjectIDCopy.reset();
 			}
 
+			cmd->EndTiming(renderer->m_FrameGPUTiming, frameInFlight);
 			renderer->m_FrameIndex = (renderer->m_FrameIndex + 1) % RendererConfig::FramesInFlight;
 		});
 	}
@@ -243,6 +301,7 @@ namespace Eagle
 		const bool bTAAEnabled = m_Options.AA == AAMethod::TAA;
 		m_Options.InternalState.bMotionBuffer = (m_Options.AO == AmbientOcclusion::GTAO) || bTAAEnabled;
 		m_Options.InternalState.bJitter = bTAAEnabled;
+		m_Options.InternalState.bScaledRendering = bTAAEnabled && (m_Options.DynamicResolution.bEnable || m_Options.Upscaling != UpscalingMode::Native);
 	}
 
 	void SceneRenderer::SetViewportSize(const glm::uvec2 size)
@@ -341,6 +400,46 @@ namespace Eagle
 		InitOptionalTask<FogPassTask>(m_FogTask, options, options.FogSettings.bEnable, *this, m_HDRRTImage);
 	}
 
+	void SceneRenderer::UpdateRenderScale()
+	{
+		const auto& settings = m_Options_RT.DynamicResolution;
+		const float upscalingScale = GetUpscalingRenderScale(m_Options_RT.Upscaling);
+		const float minScale = glm::clamp(settings.MinScale, s_MinRenderScale, upscalingScale);
+		const float maxScale = glm::clamp(settings.MaxScale, minScale, upscalingScale);
+		m_RenderScale = glm::clamp(m_RenderScale, minScale, maxScale);
+
+		const float gpuTime = m_FrameGPUTiming->GetTiming();
+		if (gpuTime <= 0.f)
+			return;
+
+		m_SmoothedGPUTime = m_SmoothedGPUTime == 0.f ? gpuTime : glm::mix(m_SmoothedGPUTime, gpuTime, 0.1f);
+
+		// GPU timings are read back with a delay, so give the new scale time to affect them
+		if (m_RenderScaleCooldown > 0)
+		{
+			--m_RenderScaleCooldown;
+			return;
+		}
+
+		// Don't go up if there's not enough headroom. Otherwise the scale will keep jumping up and down
+		const float targetTime = glm::max(settings.TargetGPUTime, 0.1f);
+		const float ratio = targetTime / m_SmoothedGPUTime;
+		if (ratio > 1.f && ratio < 1.1f)
+			return;
+
+		// GPU time is roughly proportional to the amount of pixels
+		float scale = m_RenderScale * glm::sqrt(ratio);
+		scale = glm::clamp(scale, m_RenderScale - 2.f * s_RenderScaleStep, m_RenderScale + s_RenderScaleStep); // Drop fast, recover slowly
+		scale = glm::round(scale / s_RenderScaleStep) * s_RenderScaleStep;
+		scale = glm::clamp(scale, minScale, maxScale);
+
+		if (scale != m_RenderScale)
+		{
+			m_RenderScale = scale;
+			m_RenderScaleCooldown = RendererConfig::FramesInFlight * 2u;
+		}
+	}
+
 	void GBuffer::Init(const glm::uvec3& size)
 	{
 		ImageSpecifications depthSpecs;
@@ -35,6 +35,7 @@ namespace Eagle
 	class StaticMesh;
 	class Material;
 	class TextureCube;
+	class RHIGPUTiming;
 	
 	class Camera;
 
@@ -81,23 +82,31 @@ namespace Eagle
 		void SetSprites(const std::vector<const SpriteComponent*>& sprites, bool bDirty) { m_GeometryManagerTask->SetSprites(sprites, bDirty); }
 		void SetPointLights(const std::vector<const PointLightComponent*>& pointLights, bool bDirty) { m_LightsManagerTask->SetPointLights(pointLights, bDirty); }
 		void SetSpotLights(const std::vector<const SpotLightComponent*>& spotLights, bool bDirty) { m_LightsManagerTask->SetSpotLights(spotLights, bDirty); }
+		void UpdatePointLights(const std::vector<const PointLightComponent*>& pointLights) { m_LightsManagerTask->UpdatePointLights(pointLights); }
+		void UpdateSpotLights(const std::vector<const SpotLightComponent*>& spotLights) { m_LightsManagerTask->UpdateSpotLights(spotLights); }
 		void SetTexts(const std::vector<const TextComponent*>& texts, bool bDirty) { m_GeometryManagerTask->SetTexts(texts, bDirty); }
 		void SetTexts2D(const std::vector<const Text2DComponent*>& texts, bool bDirty) { m_Text2DTask->SetTexts(texts, bDirty); }
+		void UpdateTexts(const std::vector<const TextComponent*>& texts) { m_GeometryManagerTask->UpdateTexts(texts); }
+		void UpdateTexts2D(const std::vector<const Text2DComponent*>& texts) { m_Text2DTask->UpdateTexts(texts); }
 		void SetImages2D(const std::vector<const Image2DComponent*>& images, bool bDirty) { m_Images2DTask->SetImages(images, bDirty); }
+		void SetBillboards(const std::vector<const BillboardComponent*>& billboards, bool bDirty) { m_RenderBillboardsTask->SetBillboards(billboards, bDirty); }
+
+		// Replaces engine billboards (light icons, etc). They're kept until the next call, so there's no need to call it each frame
+		void SetAdditionalBillboards(std::vector<RenderBillboardsTask::AdditionalBillboard>&& billboards) { m_RenderBillboardsTask->SetAdditionalBillboards(std::move(billboards)); } // For internal usage
 		//--------------------------------------------------------------------------------------
 		//---------------------------------- Render functions ----------------------------------
-		void SetBillboards(const std::vector<const BillboardComponent*>& billboards) { m_RenderBillboardsTask->SetBillboards(billboards); }
 		void SetDebugLines(const std::vector<RendererLine>& lines) { m_RenderLinesTask->SetDebugLines(lines); }
-		void AddAdditionalBillboard(const Transform& worldTransform, const Ref<Texture2D>& texture, int entityID = -1) { m_RenderBillboardsTask->AddAdditionalBillboard(worldTransform, texture, entityID); } // For internal usage
+		void SetDebugShapes(const std::vector<RendererDebugShape>& shapes) { m_RenderLinesTask->SetDebugShapes(shapes); }
 
 		// `directionalLight` can be set to nullptr to disable directional light
 		void SetDirectionalLight(const DirectionalLightComponent* directionalLight) { m_LightsManagerTask->SetDirectionalLight(directionalLight); }
 
 		// Instead of using `SetMeshes` and triggering all buffers recollection/uploading
 		// This function can be used to update transforms of meshes that were already set
-		void UpdateMeshesTransforms(const std::set<const StaticMeshComponent*>& meshes) { m_GeometryManagerTask->SetTransforms(meshes); }
-		void UpdateSpritesTransforms(const std::set<const SpriteComponent*>& sprites) { m_GeometryManagerTask->SetTransforms(sprites); }
-		void UpdateTextsTransforms(const std::set<const TextComponent*>& texts) { m_GeometryManagerTask->SetTransforms(texts); }
+		void UpdateMeshesTransforms(const std::vector<const StaticMeshComponent*>& meshes) { m_GeometryManagerTask->SetTransforms(meshes); }
+		void UpdateSpritesTransforms(const std::vector<const SpriteComponent*>& sprites) { m_GeometryManagerTask->SetTransforms(sprites); }
+		void UpdateTextsTransforms(const std::vector<const TextComponent*>& texts) { m_GeometryManagerTask->SetTransforms(texts); }
+		void UpdateBillboardsTransforms(const std::vector<const BillboardComponent*>& billboards) { m_RenderBillboardsTask->SetTransforms(billboards); }
 
 		void SetGridEnabled(bool bEnabled) { m_bGridEnabled = bEnabled; }
 
@@ -123,6 +132,11 @@ namespace Eagle
 		void SetOptions(const SceneRendererSettings& options);
 		void SetViewportSize(const glm::uvec2 size);
 		glm::uvec2 GetViewportSize() const { return m_Size; }
+		// Size of the area of render targets that the scene is rendered into. Equals viewport size if dynamic resolution is disabled
+		glm::uvec2 GetRenderSize() const { return glm::min(m_Size, glm::uvec2(glm::ceil(glm::vec2(m_Size) * m_RenderScale))); }
+		float GetRenderScale() const { return m_RenderScale; }
+		float GetPrevRenderScale() const { return m_PrevRenderScale; }
+		glm::vec2 GetJitterOffset() const { return m_JitterOffset; } // In NDC
 		float GetAspectRatio() const { return float(m_Size.x) / float(m_Size.y); }
 
 		// ----------- Getters from other tasks -----------
@@ -243,6 +257,7 @@ namespace Eagle
 
 	private:
 		void InitWithOptions();
+		void UpdateRenderScale();
 
 	private:
 		Scope<GeometryManagerTask> m_GeometryManagerTask;
@@ -293,6 +308,12 @@ namespace Eagle
 		float m_MaxShadowDistance = 1.f;
 
 		glm::uvec2 m_Size = { 1, 1 };
+		float m_RenderScale = 1.f;
+		float m_PrevRenderScale = 1.f;
+		glm::vec2 m_JitterOffset = glm::vec2(0.f);
+		Ref<RHIGPUTiming> m_FrameGPUTiming; // Used by dynamic resolution. Unlike the profiler timings, it's measured in all builds
+		float m_SmoothedGPUTime = 0.f; // Used by dynamic resolution
+		uint32_t m_RenderScaleCooldown = 0;
 		float m_PhotoLinearScale = 1.f;
 		SceneRendererSettings m_Options_RT; // Render thread
 		SceneRendererSettings m_Options;
@@ -46,7 +46,9 @@ namespace Eagle
 		specs.Usage = ImageUsage::Sampled | ImageUsage::TransferDst;
 		m_DenoisedPrev = Image::Create(specs, "GTAO_Denoised_Prev");
 
-		m_Samples = m_Renderer.GetOptions_RT().GTAOSettings.GetNumberOfSamples();
+		const auto& gtaoSettings = m_Renderer.GetOptions_RT().GTAOSettings;
+		m_Samples = gtaoSettings.GetNumberOfSamples();
+		bTemporal = gtaoSettings.IsTemporal();
 		InitPipeline();
 	}
 
@@ -59,6 +61,10 @@ namespace Eagle
 		const ImageLayout oldDepthLayout = gBuffer.Depth->GetLayout();
 		cmd->TransitionLayout(gBuffer.Depth, oldDepthLayout, ImageReadAccess::PixelShaderRead);
 
+		// Diagonal pixels go one after another so that a half of the quads is covered every two frames
+		constexpr glm::ivec2 temporalOffsets[] = { {0, 0}, {1, 1}, {1, 0}, {0, 1} };
+		m_TemporalOffset = temporalOffsets[RenderManager::GetFrameNumber() % 4];
+
 		Downsample(cmd);
 		GTAO(cmd);
 		Denoiser(cmd);
@@ -98,6 +104,7 @@ namespace Eagle
 			glm::vec3 ViewRow3;
 			float Radius;
 			float RadRotationTemporal;
+			uint32_t TemporalOffset;
 		} pushData;
 		static_assert(sizeof(PushData) <= 128);
 
@@ -115,6 +122,10 @@ namespace Eagle
 		pushData.ViewRow2 = view[1];
 		pushData.ViewRow3 = view[2];
 		pushData.RadRotationTemporal = aRotation[frameNumber % 6];
+		pushData.TemporalOffset = uint32_t(m_TemporalOffset.x) | (uint32_t(m_TemporalOffset.y) << 1u);
+
+		// If temporal, only one pixel of each 2x2 quad is computed
+		const glm::uvec2 numGroups = bTemporal ? glm::uvec2(glm::ceil(glm::vec2(m_HalfNumGroups) / 2.f)) : m_HalfNumGroups;
 
 		m_GTAOPipeline->SetImageSampler(m_HalfDepth, Sampler::PointSamplerClamp, 0, 0);
 		m_GTAOPipeline->SetImageSampler(m_Renderer.GetGBuffer().Geometry_Shading_Normals, Sampler::PointSamplerClamp, 0, 1);
@@ -123,7 +134,7 @@ namespace Eagle
 		cmd->TransitionLayout(m_GTAOPassImage, m_GTAOPassImage->GetLayout(), ImageLayoutType::StorageImage);
 		cmd->Barrier(m_HalfDepth);
 
-		cmd->Dispatch(m_GTAOPipeline, m_HalfNumGroups.x, m_HalfNumGroups.y, 1, &pushData);
+		cmd->Dispatch(m_GTAOPipeline, numGroups.x, numGroups.y, 1, &pushData);
 
 		cmd->TransitionLayout(m_GTAOPassImage, m_GTAOPassImage->GetLayout(), ImageReadAccess::PixelShaderRead);
 	}
@@ -143,11 +154,13 @@ namespace Eagle
 		{
 			glm::uvec2 Size;
 			glm::vec2 TexelSize;
+			glm::ivec2 TemporalOffset;
 		} pushData;
 		static_assert(sizeof(PushData) <= 128);
 
 		pushData.Size = m_HalfSize;
 		pushData.TexelSize = m_HalfTexelSize;
+		pushData.TemporalOffset = m_TemporalOffset;
 
 		// Output
 		m_DenoiserPipeline->SetImage(m_Denoised, 0, 5);
@@ -199,6 +212,10 @@ namespace Eagle
 			m_DownsamplePipeline = PipelineGraphics::Create(downsamplesState);
 		}
 
+		ShaderDefines defines;
+		if (bTemporal)
+			defines["EG_GTAO_TEMPORAL"] = "";
+
 		// GTAO Pipeline
 		{
 			ShaderSpecializationInfo constants;
@@ -208,7 +225,7 @@ namespace Eagle
 			
 			PipelineComputeState state;
 			state.ComputeSpecializationInfo = constants;
-			state.ComputeShader = Shader::Create("assets/shaders/gtao.comp", ShaderType::Compute);
+			state.ComputeShader = Shader::Create("assets/shaders/gtao.comp", ShaderType::Compute, defines);
 
 			m_GTAOPipeline = PipelineCompute::Create(state);
 		}
@@ -216,7 +233,7 @@ namespace Eagle
 		// Denoiser pipeline
 		{
 			PipelineComputeState state;
-			state.ComputeShader = Shader::Create("assets/shaders/gtao_denoiser.comp", ShaderType::Compute);
+			state.ComputeShader = Shader::Create("assets/shaders/gtao_denoiser.comp", ShaderType::Compute, defines);
 
 			m_DenoiserPipeline = PipelineCompute::Create(state);
 		}
@@ -29,10 +29,12 @@ namespace Eagle
 
 		void InitWithOptions(const SceneRendererSettings& settings) override
 		{
-			if (m_Samples == settings.GTAOSettings.GetNumberOfSamples())
+			const auto& gtaoSettings = settings.GTAOSettings;
+			if (m_Samples == gtaoSettings.GetNumberOfSamples() && bTemporal == gtaoSettings.IsTemporal())
 				return;
 
-			m_Samples = settings.GTAOSettings.GetNumberOfSamples();
+			m_Samples = gtaoSettings.GetNumberOfSamples();
+			bTemporal = gtaoSettings.IsTemporal();
 			InitPipeline();
 		}
 
@@ -64,6 +66,8 @@ namespace Eagle
 		glm::uvec2 m_HalfNumGroups = glm::uvec2(1u);
 
 		uint32_t m_Samples = 0;
+		glm::ivec2 m_TemporalOffset = glm::ivec2(0); // Pixel of 2x2 quads that is computed this frame if temporal
+		bool bTemporal = false;
 
 		constexpr static uint32_t s_TileSize = 8;
 	};
@@ -15,38 +15,12 @@
 #include "Eagle/Debug/CPUTimings.h"
 #include "Eagle/Debug/GPUTimings.h"
 
-#include <codecvt>
 
 // TODO: Test this functionality on heavy scenes and check if it's faster than uploading the whole buffer at once
 #define EG_UPLOAD_ONLY_REQUIRED_TRANSFORMS 1
 
 namespace Eagle
 {
-	static constexpr float s_QuadPosition = 0.5f;
-	static constexpr glm::vec4 s_QuadVertexPosition[4] = { { -s_QuadPosition, -s_QuadPosition, 0.0f, 1.0f },
-														   {  s_QuadPosition, -s_QuadPosition, 0.0f, 1.0f },
-														   {  s_QuadPosition,  s_QuadPosition, 0.0f, 1.0f },
-														   { -s_QuadPosition,  s_QuadPosition, 0.0f, 1.0f } };
-
-	static constexpr glm::vec4 s_QuadVertexNormal = { 0.0f,  0.0f, 1.0f, 0.0f };
-
-	static constexpr glm::vec2 s_TexCoords[4] = { {0.0f, 1.0f}, { 1.f, 1.f }, { 1.f, 0.f }, { 0.f, 0.f } };
-	static constexpr glm::vec3 Edge1 = s_QuadVertexPosition[1] - s_QuadVertexPosition[0];
-	static constexpr glm::vec3 Edge2 = s_QuadVertexPosition[2] - s_QuadVertexPosition[0];
-	static constexpr glm::vec2 DeltaUV1 = s_TexCoords[1] - s_TexCoords[0];
-	static constexpr glm::vec2 DeltaUV2 = s_TexCoords[2] - s_TexCoords[0];
-	static constexpr float f = 1.0f / (DeltaUV1.x * DeltaUV2.y - DeltaUV2.x * DeltaUV1.y);
-
-	static constexpr glm::vec4 s_Tangent = glm::vec4(f * (DeltaUV2.y * Edge1.x - DeltaUV1.y * Edge2.x),
-		f * (DeltaUV2.y * Edge1.y - DeltaUV1.y * Edge2.y),
-		f * (DeltaUV2.y * Edge1.z - DeltaUV1.y * Edge2.z),
-		0.f);
-
-	static constexpr glm::vec4 s_Bitangent = glm::vec4(f * (-DeltaUV2.x * Edge1.x + DeltaUV1.x * Edge2.x),
-		f * (-DeltaUV2.x * Edge1.y + DeltaUV1.x * Edge2.y),
-		f * (-DeltaUV2.x * Edge1.z + DeltaUV1.x * Edge2.z),
-		0.f);
-
 	static void UploadIndexBuffer(const Ref<CommandBuffer>& cmd, Ref<Buffer>& buffer)
 	{
 		const size_t ibSize = buffer->GetSize();
@@ -227,57 +201,31 @@ namespace Eagle
 
 		// Create Sprite buffers
 		{
-			BufferSpecifications vertexSpecs;
-			vertexSpecs.Size = s_SpritesBaseVertexBufferSize;
-			vertexSpecs.Layout = BufferReadAccess::Vertex;
-			vertexSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
-
-			BufferSpecifications indexSpecs;
-			indexSpecs.Size = s_SpritesBaseIndexBufferSize;
-			indexSpecs.Layout = BufferReadAccess::Index;
-			indexSpecs.Usage = BufferUsage::IndexBuffer | BufferUsage::TransferDst;
+			BufferSpecifications instanceSpecs;
+			instanceSpecs.Size = s_SpritesBaseInstanceBufferSize;
+			instanceSpecs.Layout = BufferReadAccess::Vertex;
+			instanceSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
 
 			BufferSpecifications transformsBufferSpecs;
 			transformsBufferSpecs.Size = sizeof(glm::mat4) * 100; // 100 transforms
 			transformsBufferSpecs.Layout = BufferLayoutType::StorageBuffer;
 			transformsBufferSpecs.Usage = BufferUsage::StorageBuffer | BufferUsage::TransferDst | BufferUsage::TransferSrc;
 
-			m_OpaqueSpritesData.VertexBuffer = Buffer::Create(vertexSpecs, "VertexBuffer_2D_Opaque");
-			m_OpaqueSpritesData.IndexBuffer = Buffer::Create(indexSpecs, "IndexBuffer_2D_Opaque");
-
-			m_MaskedSpritesData.VertexBuffer = Buffer::Create(vertexSpecs, "VertexBuffer_2D_Masked");
-			m_MaskedSpritesData.IndexBuffer = Buffer::Create(indexSpecs, "IndexBuffer_2D_Masked");
-
-			m_OpaqueNonShadowSpritesData.VertexBuffer = Buffer::Create(vertexSpecs, "VertexBuffer_2D_Opaque_NotCastingShadow");
-			m_OpaqueNonShadowSpritesData.IndexBuffer = Buffer::Create(indexSpecs, "IndexBuffer_2D_Opaque_NotCastingShadow");
-
-			m_MaskedNonShadowSpritesData.VertexBuffer = Buffer::Create(vertexSpecs, "VertexBuffer_2D_Masked_NotCastingShadow");
-			m_MaskedNonShadowSpritesData.IndexBuffer = Buffer::Create(indexSpecs, "IndexBuffer_2D_Masked_NotCastingShadow");
-
-			m_TranslucentSpritesData.VertexBuffer = Buffer::Create(vertexSpecs, "VertexBuffer_2D_Translucent");
-			m_TranslucentSpritesData.IndexBuffer = Buffer::Create(indexSpecs, "IndexBuffer_2D_Translucent");
-
-			m_TranslucentNonShadowSpritesData.VertexBuffer = Buffer::Create(vertexSpecs, "VertexBuffer_2D_Translucent_NotCastingShadow");
-			m_TranslucentNonShadowSpritesData.IndexBuffer = Buffer::Create(indexSpecs, "IndexBuffer_2D_Translucent_NotCastingShadow");
+			m_OpaqueSpritesData.InstanceBuffer = Buffer::Create(instanceSpecs, "InstanceBuffer_2D_Opaque");
+			m_MaskedSpritesData.InstanceBuffer = Buffer::Create(instanceSpecs, "InstanceBuffer_2D_Masked");
+			m_OpaqueNonShadowSpritesData.InstanceBuffer = Buffer::Create(instanceSpecs, "InstanceBuffer_2D_Opaque_NotCastingShadow");
+			m_MaskedNonShadowSpritesData.InstanceBuffer = Buffer::Create(instanceSpecs, "InstanceBuffer_2D_Masked_NotCastingShadow");
+			m_TranslucentSpritesData.InstanceBuffer = Buffer::Create(instanceSpecs, "InstanceBuffer_2D_Translucent");
+			m_TranslucentNonShadowSpritesData.InstanceBuffer = Buffer::Create(instanceSpecs, "InstanceBuffer_2D_Translucent_NotCastingShadow");
 
 			m_SpritesTransformsBuffer = Buffer::Create(transformsBufferSpecs, "Sprites_TransformsBuffer");
 
-			m_OpaqueSpritesData.QuadVertices.reserve(s_SpritesDefaultVerticesCount);
-			m_OpaqueNonShadowSpritesData.QuadVertices.reserve(s_SpritesDefaultVerticesCount);
-			m_MaskedSpritesData.QuadVertices.reserve(s_SpritesDefaultVerticesCount);
-			m_MaskedNonShadowSpritesData.QuadVertices.reserve(s_SpritesDefaultVerticesCount);
-			m_TranslucentSpritesData.QuadVertices.reserve(s_SpritesDefaultVerticesCount);
-			m_TranslucentNonShadowSpritesData.QuadVertices.reserve(s_SpritesDefaultVerticesCount);
-
-			RenderManager::Submit([this](Ref<CommandBuffer>& cmd)
-			{
-				UploadIndexBuffer(cmd, m_OpaqueSpritesData.IndexBuffer);
-				UploadIndexBuffer(cmd, m_OpaqueNonShadowSpritesData.IndexBuffer);
-				UploadIndexBuffer(cmd, m_MaskedSpritesData.IndexBuffer);
-				UploadIndexBuffer(cmd, m_MaskedNonShadowSpritesData.IndexBuffer);
-				UploadIndexBuffer(cmd, m_TranslucentSpritesData.IndexBuffer);
-				UploadIndexBuffer(cmd, m_TranslucentNonShadowSpritesData.IndexBuffer);
-			});
+			m_OpaqueSpritesData.Instances.reserve(s_SpritesDefaultQuadCount);
+			m_OpaqueNonShadowSpritesData.Instances.reserve(s_SpritesDefaultQuadCount);
+			m_MaskedSpritesData.Instances.reserve(s_SpritesDefaultQuadCount);
+			m_MaskedNonShadowSpritesData.Instances.reserve(s_SpritesDefaultQuadCount);
+			m_TranslucentSpritesData.Instances.reserve(s_SpritesDefaultQuadCount);
+			m_TranslucentNonShadowSpritesData.Instances.reserve(s_SpritesDefaultQuadCount);
 		}
 	
 		// Create Text buffers
@@ -421,11 +369,12 @@ namespace Eagle
 				UploadTexts(cmd, m_UnlitTextData);
 				UploadTexts(cmd, m_UnlitNonShadowTextData);
 			}
-			const bool bTransformBufferGarbage = bUploadTextQuads;
+			const bool bTransformBufferGarbage = bTextTransformsReassigned;
 			UploadTransforms(cmd, m_TextTransforms, m_TextTransformsBuffer, m_TextPrevTransformsBuffer, m_TextUploadSpecificTransforms,
 				&bUploadTextTransforms, &bUploadTextSpecificTransforms, bMotionRequired, bTransformBufferGarbage, "Texts. Upload Transforms buffer");
 
 			bUploadTextQuads = false;
+			bTextTransformsReassigned = false;
 		}
 	}
 
@@ -457,18 +406,66 @@ namespace Eagle
 		}
 	}
 
+	static constexpr uint32_t s_InvalidTransformSlot = uint32_t(-1);
+
+	static uint32_t GetEntityIndex(const Entity& entity)
+	{
+		return uint32_t(entt::entt_traits<entt::entity>::to_entity(entity.GetEnttID()));
+	}
+
+	static void SetTransformSlot(std::vector<uint32_t>& slots, const Entity& entity, uint32_t slot)
+	{
+		const uint32_t entityIndex = GetEntityIndex(entity);
+		if (entityIndex >= slots.size())
+			slots.resize(size_t(entityIndex) + 1, s_InvalidTransformSlot);
+		slots[entityIndex] = slot;
+	}
+
+	static uint32_t GetTransformSlot(const std::vector<uint32_t>& slots, const Entity& entity)
+	{
+		const uint32_t entityIndex = GetEntityIndex(entity);
+		return entityIndex < slots.size() ? slots[entityIndex] : s_InvalidTransformSlot;
+	}
+
+	// Main thread. Components without a slot aren't rendered
+	template<typename T>
+	static void GatherTransformUpdates(const std::vector<const T*>& components, const std::vector<uint32_t>& slots, TransformUpdates& updates)
+	{
+		for (auto& component : components)
+		{
+			const uint32_t slot = GetTransformSlot(slots, component->Parent);
+			if (slot == s_InvalidTransformSlot)
+				continue;
+
+			updates.Transforms.push_back(Math::ToTransformMatrix(component->GetWorldTransform()));
+			updates.Indices.push_back(slot);
+		}
+	}
+
+	// Render thread
+	static void ApplyTransformUpdates(TransformUpdates& updates, std::vector<glm::mat4>& transforms, std::vector<uint64_t>& uploadIndices, bool& bUploadSpecificTransforms)
+	{
+		if (updates.Indices.empty())
+			return;
+
+		for (size_t i = 0; i < updates.Indices.size(); ++i)
+			transforms[updates.Indices[i]] = updates.Transforms[i];
+		uploadIndices.insert(uploadIndices.end(), updates.Indices.begin(), updates.Indices.end());
+		bUploadSpecificTransforms = true;
+		updates.Clear();
+	}
+
 	void GeometryManagerTask::SetMeshes(const std::vector<const StaticMeshComponent*>& meshes, bool bDirty)
 	{
 		if (!bDirty)
 			return;
 
 		std::unordered_map<MeshKey, std::vector<MeshData>> tempMeshes;
-		std::unordered_map<uint32_t, uint64_t> meshTransformIndices; // EntityID -> uint64_t (index to m_MeshTransforms)
 		std::vector<glm::mat4> tempMeshTransforms;
 
 		tempMeshes.reserve(meshes.size());
 		tempMeshTransforms.reserve(meshes.size());
-		meshTransformIndices.reserve(meshes.size());
+		std::fill(m_MeshTransformSlots.begin(), m_MeshTransformSlots.end(), s_InvalidTransformSlot);
 
 		uint32_t meshIndex = 0;
 		for (auto& comp : meshes)
@@ -486,52 +483,32 @@ namespace Eagle
 			// meshData.InstanceData.MaterialIndex is set later during the update
 
 			tempMeshTransforms.push_back(Math::ToTransformMatrix(comp->GetWorldTransform()));
-			meshTransformIndices.emplace(meshID, meshIndex);
+			SetTransformSlot(m_MeshTransformSlots, comp->Parent, meshIndex);
 			++meshIndex;
 		}
 
 		RenderManager::Submit([this, meshes = std::move(tempMeshes),
-			transforms = std::move(tempMeshTransforms),
-			transformIndices = std::move(meshTransformIndices)](Ref<CommandBuffer>&) mutable
+			transforms = std::move(tempMeshTransforms)](Ref<CommandBuffer>&) mutable
 			{
 				m_Meshes = std::move(meshes);
 				m_MeshTransforms = std::move(transforms);
-				m_MeshTransformIndices = std::move(transformIndices);
 
 				bUploadMeshes = true;
 				bUploadMeshTransforms = true;
 			});
 	}
 	
-	void GeometryManagerTask::SetTransforms(const std::set<const StaticMeshComponent*>& meshes)
+	void GeometryManagerTask::SetTransforms(const std::vector<const StaticMeshComponent*>& meshes)
 	{
 		if (meshes.empty())
 			return;
 
-		struct Data
-		{
-			glm::mat4 TransformMatrix;
-			uint32_t ID;
-		};
+		EG_CPU_TIMING_SCOPED("Renderer. Set Meshes Transforms");
 
-		std::vector<Data> updateData;
-		updateData.reserve(meshes.size());
-
-		for (auto& mesh : meshes)
-			updateData.push_back({ Math::ToTransformMatrix(mesh->GetWorldTransform()), mesh->Parent.GetID() });
-
-		RenderManager::Submit([this, data = std::move(updateData)](Ref<CommandBuffer>&)
+		GatherTransformUpdates(meshes, m_MeshTransformSlots, m_MeshTransformUpdates);
+		RenderManager::Submit([this](Ref<CommandBuffer>&)
 		{
-			for (auto& mesh : data)
-			{
-				auto it = m_MeshTransformIndices.find(mesh.ID);
-				if (it != m_MeshTransformIndices.end())
-				{
-					m_MeshTransforms[it->second] = mesh.TransformMatrix;
-					m_MeshUploadSpecificTransforms.push_back(it->second);
-					bUploadMeshSpecificTransforms = true;
-				}
-			}
+			ApplyTransformUpdates(m_MeshTransformUpdates, m_MeshTransforms, m_MeshUploadSpecificTransforms, bUploadMeshSpecificTransforms);
 		});
 	}
 	
@@ -627,81 +604,54 @@ namespace Eagle
 	{
 		EG_CPU_TIMING_SCOPED("Sort sprites based on Blend Mode");
 
-		m_OpaqueSpritesData.QuadVertices.clear();
-		m_OpaqueNonShadowSpritesData.QuadVertices.clear();
-		m_MaskedSpritesData.QuadVertices.clear();
-		m_MaskedNonShadowSpritesData.QuadVertices.clear();
-		m_TranslucentSpritesData.QuadVertices.clear();
-		m_TranslucentNonShadowSpritesData.QuadVertices.clear();
+		m_OpaqueSpritesData.Instances.clear();
+		m_OpaqueNonShadowSpritesData.Instances.clear();
+		m_MaskedSpritesData.Instances.clear();
+		m_MaskedNonShadowSpritesData.Instances.clear();
+		m_TranslucentSpritesData.Instances.clear();
+		m_TranslucentNonShadowSpritesData.Instances.clear();
 
 		const size_t spritesCount = m_Sprites.size();
 		for (size_t i = 0; i < spritesCount; ++i)
 		{
 			const auto& sprite = m_Sprites[i];
-			const uint32_t transformIndex = uint32_t(i);
+			SpriteGeometryData* data = nullptr;
 			switch (sprite.Material->GetBlendMode())
 			{
 				case Material::BlendMode::Opaque:
-				{
-					if (sprite.bCastsShadows)
-						AddQuad(m_OpaqueSpritesData.QuadVertices, sprite, m_SpriteTransforms[i], transformIndex);
-					else
-						AddQuad(m_OpaqueNonShadowSpritesData.QuadVertices, sprite, m_SpriteTransforms[i], transformIndex);
+					data = sprite.bCastsShadows ? &m_OpaqueSpritesData : &m_OpaqueNonShadowSpritesData;
 					break;
-				}
 				case Material::BlendMode::Translucent:
-				{
-					if (sprite.bCastsShadows)
-						AddQuad(m_TranslucentSpritesData.QuadVertices, sprite, m_SpriteTransforms[i], transformIndex);
-					else
-						AddQuad(m_TranslucentNonShadowSpritesData.QuadVertices, sprite, m_SpriteTransforms[i], transformIndex);
+					data = sprite.bCastsShadows ? &m_TranslucentSpritesData : &m_TranslucentNonShadowSpritesData;
 					break;
-				}
 				case Material::BlendMode::Masked:
-				{
-					if (sprite.bCastsShadows)
-						AddQuad(m_MaskedSpritesData.QuadVertices, sprite, m_SpriteTransforms[i], transformIndex);
-					else
-						AddQuad(m_MaskedNonShadowSpritesData.QuadVertices, sprite, m_SpriteTransforms[i], transformIndex);
+					data = sprite.bCastsShadows ? &m_MaskedSpritesData : &m_MaskedNonShadowSpritesData;
 					break;
-				}
 				default: EG_CORE_ASSERT("Unknown blend mode!");
 			}
+			if (!data)
+				continue;
+
+			auto& instance = data->Instances.emplace_back();
+			instance.UVBounds = sprite.UVBounds;
+			instance.TransformIndex = uint32_t(i);
+			instance.MaterialIndex = MaterialSystem::GetMaterialIndex(sprite.Material);
+			instance.EntityID = (int)sprite.EntityID;
 		}
 	}
 
 	void GeometryManagerTask::UploadSprites(const Ref<CommandBuffer>& cmd, SpriteGeometryData& spritesData)
 	{
-		if (spritesData.QuadVertices.empty())
+		if (spritesData.Instances.empty())
 			return;
 
-		auto& vb = spritesData.VertexBuffer;
-		auto& ib = spritesData.IndexBuffer;
-
-		// Reserving enough space to hold Vertex & Index data
-		const size_t currentVertexSize = spritesData.QuadVertices.size() * sizeof(QuadVertex);
-		const size_t currentIndexSize = (spritesData.QuadVertices.size() / 4) * (sizeof(Index) * 6);
-
-		if (currentVertexSize > vb->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, vb->GetSize() * 3 / 2);
-			constexpr size_t alignment = 4 * sizeof(QuadVertex);
-			newSize += alignment - (newSize % alignment);
-
-			vb->Resize(newSize);
-		}
-		if (currentIndexSize > ib->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, ib->GetSize() * 3 / 2);
-			constexpr size_t alignment = 6 * sizeof(Index);
-			newSize += alignment - (newSize % alignment);
-
-			ib->Resize(newSize);
-			UploadIndexBuffer(cmd, ib);
-		}
+		auto& ivb = spritesData.InstanceBuffer;
+		const size_t currentInstancesSize = spritesData.Instances.size() * sizeof(SpriteInstance);
+		if (currentInstancesSize > ivb->GetSize())
+			ivb->Resize(glm::max(currentInstancesSize, ivb->GetSize() * 3 / 2));
 
-		cmd->Write(vb, spritesData.QuadVertices.data(), currentVertexSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
-		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		cmd->Write(ivb, spritesData.Instances.data(), currentInstancesSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+		cmd->TransitionLayout(ivb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
 	}
 
 	void GeometryManagerTask::SetSprites(const std::vector<const SpriteComponent*>& sprites, bool bDirty)
@@ -710,12 +660,11 @@ namespace Eagle
 			return;
 
 		std::vector<SpriteData> spritesData;
-		std::unordered_map<uint32_t, uint64_t> tempTransformIndices; // EntityID -> uint64_t (index to m_Transforms)
 		std::vector<glm::mat4> tempTransforms;
 
 		spritesData.reserve(sprites.size());
-		tempTransformIndices.reserve(sprites.size());
 		tempTransforms.reserve(sprites.size());
+		std::fill(m_SpriteTransformSlots.begin(), m_SpriteTransformSlots.end(), s_InvalidTransformSlot);
 
 		uint32_t spriteIndex = 0;
 		for (auto& sprite : sprites)
@@ -723,9 +672,8 @@ namespace Eagle
 			auto& data = spritesData.emplace_back();
 			data.Material = sprite->GetMaterial();
 			data.EntityID = sprite->Parent.GetID();
-			data.bAtlas = sprite->IsAtlas();
 			data.bCastsShadows = sprite->DoesCastShadows();
-			if (data.bAtlas)
+			if (sprite->IsAtlas())
 			{
 				if (const auto& atlas = data.Material->GetAlbedoTexture())
 				{
@@ -739,24 +687,19 @@ namespace Eagle
 					glm::vec2 min = { (coords.x * cellSize.x) / textureWidth, (coords.y * cellSize.y) / textureHeight };
 					glm::vec2 max = { ((coords.x + spriteSize.x) * cellSize.x) / textureWidth, ((coords.y + spriteSize.y) * cellSize.y) / textureHeight };
 
-					data.AtlasSpriteUVs[0] = { min.x, max.y };
-					data.AtlasSpriteUVs[1] = { max.x, max.y };
-					data.AtlasSpriteUVs[2] = { max.x, min.y };
-					data.AtlasSpriteUVs[3] = { min.x, min.y };
+					data.UVBounds = glm::vec4(min, max);
 				}
 			}
 
-			tempTransformIndices.emplace(data.EntityID, spriteIndex);
+			SetTransformSlot(m_SpriteTransformSlots, sprite->Parent, spriteIndex);
 			tempTransforms.emplace_back(Math::ToTransformMatrix(sprite->GetWorldTransform()));
 			spriteIndex++;
 		}
 
 		RenderManager::Submit([this, sprites = std::move(spritesData),
-							   transformIndices = std::move(tempTransformIndices),
 							   transforms = std::move(tempTransforms)](Ref<CommandBuffer>& cmd) mutable
 		{
 			m_Sprites = std::move(sprites);
-			m_SpriteTransformIndices = std::move(transformIndices);
 			m_SpriteTransforms = std::move(transforms);
 
 			bUploadSprites = true;
@@ -764,529 +707,377 @@ namespace Eagle
 		});
 	}
 
-	void GeometryManagerTask::SetTransforms(const std::set<const SpriteComponent*>& sprites)
+	void GeometryManagerTask::SetTransforms(const std::vector<const SpriteComponent*>& sprites)
 	{
 		if (sprites.empty())
 			return;
 
-		struct Data
-		{
-			glm::mat4 TransformMatrix;
-			uint32_t ID;
-		};
-
-		std::vector<Data> updateData;
-		updateData.reserve(sprites.size());
-
-		for (auto& sprite : sprites)
-			updateData.push_back({ Math::ToTransformMatrix(sprite->GetWorldTransform()), sprite->Parent.GetID() });
+		EG_CPU_TIMING_SCOPED("Renderer. Set Sprites Transforms");
 
-		RenderManager::Submit([this, data = std::move(updateData)](Ref<CommandBuffer>&)
+		GatherTransformUpdates(sprites, m_SpriteTransformSlots, m_SpriteTransformUpdates);
+		RenderManager::Submit([this](Ref<CommandBuffer>&)
 		{
-			for (auto& sprite : data)
-			{
-				auto it = m_SpriteTransformIndices.find(sprite.ID);
-				if (it != m_SpriteTransformIndices.end())
-				{
-					m_SpriteTransforms[it->second] = sprite.TransformMatrix;
-					m_SpriteUploadSpecificTransforms.push_back(it->second);
-					bUploadSpritesSpecificTransforms = true;
-				}
-			}
+			ApplyTransformUpdates(m_SpriteTransformUpdates, m_SpriteTransforms, m_SpriteUploadSpecificTransforms, bUploadSpritesSpecificTransforms);
 		});
 	}
 
-	void GeometryManagerTask::AddQuad(std::vector<QuadVertex>& vertices, const SpriteData& sprite, const glm::mat4& transform, uint32_t transformIndex)
+	// --------- Texts ---------
+	static uint32_t GetFontAtlasIndex(const Ref<Texture2D>& atlas, std::unordered_map<Ref<Texture2D>, uint32_t>& fontAtlases)
 	{
-		AddQuad(vertices, transform, sprite.Material, transformIndex, sprite.bAtlas ? sprite.AtlasSpriteUVs : s_TexCoords, (int)sprite.EntityID);
+		auto it = fontAtlases.find(atlas);
+		if (it != fontAtlases.end())
+			return it->second;
+
+		if (fontAtlases.size() == RendererConfig::MaxTextures) // Can't be more than EG_MAX_TEXTURES
+		{
+			EG_CORE_CRITICAL("Not enough samplers to store all font atlases! Max supported fonts: {}", RendererConfig::MaxTextures);
+			return 0;
+		}
+
+		const uint32_t index = (uint32_t)fontAtlases.size();
+		fontAtlases.emplace(atlas, index);
+		return index;
 	}
 
-	void GeometryManagerTask::AddQuad(std::vector<QuadVertex>& vertices, const glm::mat4& transform, const Ref<Material>& material, uint32_t transformIndex, const glm::vec2 UVs[4], int entityID)
+	static void GatherFontAtlases(const std::unordered_map<Ref<Texture2D>, uint32_t>& fontAtlases, std::vector<Ref<Texture2D>>& outAtlases)
 	{
-		const glm::mat3 normalModel = glm::mat3(glm::transpose(glm::inverse(transform)));
-		const glm::vec3 normal = glm::normalize(normalModel * s_QuadVertexNormal);
-		const glm::vec3 worldNormal = glm::normalize(glm::vec3(transform * s_QuadVertexNormal));
-		const glm::vec3 invNormal = -normal;
-		const glm::vec3 invWorldNormal = -worldNormal;
+		outAtlases.resize(fontAtlases.size());
+		for (auto& atlas : fontAtlases)
+			outAtlases[atlas.second] = atlas.first;
+	}
 
-		const uint32_t materialIndex = MaterialSystem::GetMaterialIndex(material);
+	static TextGeometryType GetTextGeometryType(const TextComponent* text)
+	{
+		const bool bCastsShadows = text->DoesCastShadows();
+		if (!text->IsLit())
+			return bCastsShadows ? TextGeometryType::Unlit : TextGeometryType::UnlitNonShadow;
 
-		size_t frontFaceVertexIndex = vertices.size();
-		for (int i = 0; i < 4; ++i)
-		{
-			auto& vertex = vertices.emplace_back();
-			vertex.TexCoords = UVs[i];
-			vertex.EntityID = entityID;
-			vertex.TransformIndex = transformIndex;
-			vertex.MaterialIndex = materialIndex;
-		}
-		// Backface
-		for (int i = 0; i < 4; ++i)
+		switch (text->GetBlendMode())
 		{
-			auto& vertex = vertices.emplace_back();
-			vertex = vertices[frontFaceVertexIndex++];
+			case Material::BlendMode::Opaque: return bCastsShadows ? TextGeometryType::OpaqueLit : TextGeometryType::OpaqueLitNonShadow;
+			case Material::BlendMode::Translucent: return bCastsShadows ? TextGeometryType::TranslucentLit : TextGeometryType::TranslucentLitNonShadow;
+			case Material::BlendMode::Masked: return bCastsShadows ? TextGeometryType::MaskedLit : TextGeometryType::MaskedLitNonShadow;
+			default: EG_ASSERT(false);
 		}
+		return TextGeometryType::OpaqueLit;
 	}
 
-	// --------- Texts ---------
-	struct LitTextComponentData
-	{
-		glm::vec3 Albedo;
-		float Roughness;
-		glm::vec3 Emissive;
-		float Metallness;
-		std::u32string Text;
-		Ref<Font> Font;
-		int EntityID;
-		float LineHeightOffset;
-		float KerningOffset;
-		float MaxWidth;
-		float AO;
-		float Opacity;
-		float OpacityMask;
-		uint32_t TransformIndex;
-	};
-
-	struct UnlitTextComponentData
+	static void FillTextData(TextComponentData& data, const TextComponent* text)
 	{
-		glm::vec3 Color;
-		std::u32string Text;
-		Ref<Font> Font;
-		int EntityID;
-		float LineHeightOffset;
-		float KerningOffset;
-		float MaxWidth;
-		uint32_t TransformIndex;
-	};
-
-	static std::u32string ToUTF32(const std::string& s)
-	{
-		std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-		return conv.from_bytes(s);
+		data.Text = text->GetText();
+		data.Font = text->GetFont();
+		data.Albedo = text->GetAlbedoColor();
+		data.Emissive = text->GetEmissiveColor();
+		data.Roughness = glm::max(EG_MIN_ROUGHNESS, text->GetRoughness());
+		data.Metallness = text->GetMetallness();
+		data.AO = text->GetAO();
+		data.Opacity = text->GetOpacity();
+		data.OpacityMask = text->GetOpacityMask();
+		data.Color = text->GetColor();
+		data.EntityID = text->Parent.GetID();
+		data.LineHeightOffset = text->GetLineSpacing();
+		data.KerningOffset = text->GetKerning();
+		data.MaxWidth = text->GetMaxWidth();
+		data.TransformIndex = 0;
 	}
 
-	static void ProcessLitComponents(const std::vector<LitTextComponentData>& textComponents, std::unordered_map<Ref<Texture2D>, uint32_t>& fontAtlases, LitTextGeometryData& geometryData, uint32_t& atlasCurrentIndex)
+	static void WriteTextVertices(const TextComponentData& component, const std::vector<GlyphQuad>& glyphs, uint32_t atlasIndex, size_t glyphsCapacity, LitTextQuadVertex* vertices)
 	{
-		if (textComponents.empty())
-			return;
-
-		const size_t componentsCount = textComponents.size();
-		for (size_t i = 0; i < componentsCount; ++i)
+		for (auto& glyph : glyphs)
 		{
-			auto& component = textComponents[i];
-			const auto& fontGeometry = component.Font->GetFontGeometry();
-			const auto& metrics = fontGeometry->getMetrics();
-			const auto& text = component.Text;
-			const auto& atlas = component.Font->GetAtlas();
-			uint32_t atlasIndex = atlasCurrentIndex;
-			auto it = fontAtlases.find(atlas);
-			if (it == fontAtlases.end())
-			{
-				if (fontAtlases.size() == RendererConfig::MaxTextures)
-				{
-					EG_CORE_CRITICAL("Not enough samplers to store all font atlases! Max supported fonts: {}", RendererConfig::MaxTextures);
-					atlasIndex = 0;
-				}
-				else
-					fontAtlases.emplace(atlas, atlasCurrentIndex++);
-			}
-			else
-				atlasIndex = it->second;
-
-			const double spaceAdvance = fontGeometry->getGlyph(' ')->getAdvance();
-			std::vector<int> nextLines = Font::GetNextLines(metrics, fontGeometry, text, spaceAdvance,
-				component.LineHeightOffset, component.KerningOffset, component.MaxWidth);
-
-			{
-				double x = 0.0;
-				double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-				double y = 0.0;
-				const uint32_t transformIndex = component.TransformIndex;
-
-				const size_t textSize = text.size();
-				for (int i = 0; i < textSize; i++)
-				{
-					char32_t character = text[i];
-					if (character == '\n' || Font::NextLine(i, nextLines))
-					{
-						x = 0;
-						y -= fsScale * metrics.lineHeight + component.LineHeightOffset;
-						continue;
-					}
+			const float pl = glyph.PlaneBounds.x, pb = glyph.PlaneBounds.y, pr = glyph.PlaneBounds.z, pt = glyph.PlaneBounds.w;
+			const float l = glyph.AtlasBounds.x, b = glyph.AtlasBounds.y, r = glyph.AtlasBounds.z, t = glyph.AtlasBounds.w;
+
+			auto& q1 = vertices[0];
+			q1.Position = glm::vec2(pl, pb);
+			q1.AlbedoRoughness = glm::vec4(component.Albedo, component.Roughness);
+			q1.EmissiveMetallness = glm::vec4(component.Emissive, component.Metallness);
+			q1.AO = component.AO;
+			q1.Opacity = component.Opacity;
+			q1.OpacityMask = component.OpacityMask;
+			q1.TexCoord = { l, b };
+			q1.EntityID = component.EntityID;
+			q1.AtlasIndex = atlasIndex;
+			q1.TransformIndex = component.TransformIndex;
+
+			auto& q2 = vertices[1];
+			q2 = q1;
+			q2.Position = glm::vec2(pl, pt);
+			q2.TexCoord = { l, t };
+
+			auto& q3 = vertices[2];
+			q3 = q1;
+			q3.Position = glm::vec2(pr, pt);
+			q3.TexCoord = { r, t };
+
+			auto& q4 = vertices[3];
+			q4 = q1;
+			q4.Position = glm::vec2(pr, pb);
+			q4.TexCoord = { r, b };
+
+			// back face, they have NON inverted normals
+			std::copy(vertices, vertices + 4, vertices + 4);
+			vertices += LitTextGeometryData::VerticesPerGlyph;
+		}
 
-					const bool bIsTab = character == '\t';
-					if (character == ' ' || bIsTab)
-					{
-						character = ' '; // treat tabs as spaces
-						double advance = spaceAdvance;
-						if (i < textSize - 1)
-						{
-							char32_t nextCharacter = text[i + 1];
-							if (nextCharacter == '\t')
-								nextCharacter = ' ';
-							fontGeometry->getAdvance(advance, character, nextCharacter);
-						}
+		// Spare glyphs are collapsed into a point, so nothing is rasterized for them
+		std::fill_n(vertices, (glyphsCapacity - glyphs.size()) * LitTextGeometryData::VerticesPerGlyph, LitTextQuadVertex());
+	}
 
-						// Tab is 4 spaces
-						x += (fsScale * advance + component.KerningOffset) * (bIsTab ? 4.0 : 1.0);
-						continue;
-					}
+	static void WriteTextVertices(const TextComponentData& component, const std::vector<GlyphQuad>& glyphs, uint32_t atlasIndex, size_t glyphsCapacity, UnlitTextQuadVertex* vertices)
+	{
+		for (auto& glyph : glyphs)
+		{
+			const float pl = glyph.PlaneBounds.x, pb = glyph.PlaneBounds.y, pr = glyph.PlaneBounds.z, pt = glyph.PlaneBounds.w;
+			const float l = glyph.AtlasBounds.x, b = glyph.AtlasBounds.y, r = glyph.AtlasBounds.z, t = glyph.AtlasBounds.w;
+
+			auto& q1 = vertices[0];
+			q1.Position = glm::vec2(pl, pb);
+			q1.Color = component.Color;
+			q1.TexCoord = { l, b };
+			q1.EntityID = component.EntityID;
+			q1.AtlasIndex = atlasIndex;
+			q1.TransformIndex = component.TransformIndex;
+
+			auto& q2 = vertices[1];
+			q2 = q1;
+			q2.Position = glm::vec2(pl, pt);
+			q2.TexCoord = { l, t };
+
+			auto& q3 = vertices[2];
+			q3 = q1;
+			q3.Position = glm::vec2(pr, pt);
+			q3.TexCoord = { r, t };
+
+			auto& q4 = vertices[3];
+			q4 = q1;
+			q4.Position = glm::vec2(pr, pb);
+			q4.TexCoord = { r, b };
+
+			vertices += UnlitTextGeometryData::VerticesPerGlyph;
+		}
 
-					auto glyph = fontGeometry->getGlyph(character);
-					if (!glyph)
-						glyph = fontGeometry->getGlyph('?');
-					if (!glyph)
-						continue;
+		// Spare glyphs are collapsed into a point, so nothing is rasterized for them
+		std::fill_n(vertices, (glyphsCapacity - glyphs.size()) * UnlitTextGeometryData::VerticesPerGlyph, UnlitTextQuadVertex());
+	}
 
-					double l, b, r, t;
-					glyph->getQuadAtlasBounds(l, b, r, t);
+	template<typename GeometryData>
+	static void LayoutTexts(GeometryData& data, TextLayoutCache& layoutCache, std::unordered_map<Ref<Texture2D>, uint32_t>& fontAtlases)
+	{
+		data.QuadVertices.clear();
+		data.Ranges.clear();
+		data.Ranges.reserve(data.Components.size());
 
-					double pl, pb, pr, pt;
-					glyph->getQuadPlaneBounds(pl, pb, pr, pt);
+		for (auto& component : data.Components)
+		{
+			const uint32_t atlasIndex = GetFontAtlasIndex(component.Font->GetAtlas(), fontAtlases);
+			const auto& glyphs = layoutCache.GetLayout((uint32_t)component.EntityID, component.Font, component.Text,
+				component.LineHeightOffset, component.KerningOffset, component.MaxWidth);
 
-					pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
-					pl += x, pb += y, pr += x, pt += y;
+			auto& range = data.Ranges.emplace_back();
+			range.FirstVertex = data.QuadVertices.size();
+			range.GlyphsCapacity = TextLayoutCache::GetGlyphsCapacity(glyphs.size());
+			data.QuadVertices.resize(range.FirstVertex + range.GlyphsCapacity * GeometryData::VerticesPerGlyph);
+			WriteTextVertices(component, glyphs, atlasIndex, range.GlyphsCapacity, data.QuadVertices.data() + range.FirstVertex);
+		}
 
-					double texelWidth = 1. / atlas->GetWidth();
-					double texelHeight = 1. / atlas->GetHeight();
-					l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
+		data.UploadBegin = 0;
+		data.UploadEnd = data.QuadVertices.size();
+	}
 
-					const size_t q1Index = geometryData.QuadVertices.size();
-					{
-						auto& q1 = geometryData.QuadVertices.emplace_back();
-						q1.Position = glm::vec2(pl, pb);
-						q1.AlbedoRoughness = glm::vec4(component.Albedo, component.Roughness);
-						q1.EmissiveMetallness = glm::vec4(component.Emissive, component.Metallness);
-						q1.AO = component.AO;
-						q1.Opacity = component.Opacity;
-						q1.OpacityMask = component.OpacityMask;
-						q1.TexCoord = { l, b };
-						q1.EntityID = component.EntityID;
-						q1.AtlasIndex = atlasIndex;
-						q1.TransformIndex = transformIndex;
-					}
+	// Writes the text into its range. Returns false if it doesn't fit there anymore
+	template<typename GeometryData>
+	static bool RelayoutText(GeometryData& data, size_t index, TextLayoutCache& layoutCache, std::unordered_map<Ref<Texture2D>, uint32_t>& fontAtlases)
+	{
+		const auto& component = data.Components[index];
+		const auto& range = data.Ranges[index];
+		const auto& glyphs = layoutCache.GetLayout((uint32_t)component.EntityID, component.Font, component.Text,
+			component.LineHeightOffset, component.KerningOffset, component.MaxWidth);
+		if (glyphs.size() > range.GlyphsCapacity)
+			return false;
+
+		const uint32_t atlasIndex = GetFontAtlasIndex(component.Font->GetAtlas(), fontAtlases);
+		WriteTextVertices(component, glyphs, atlasIndex, range.GlyphsCapacity, data.QuadVertices.data() + range.FirstVertex);
+
+		data.UploadBegin = glm::min(data.UploadBegin, range.FirstVertex);
+		data.UploadEnd = glm::max(data.UploadEnd, range.FirstVertex + range.GlyphsCapacity * GeometryData::VerticesPerGlyph);
+		return true;
+	}
 
-					const size_t q2Index = geometryData.QuadVertices.size();
-					{
-						auto& q2 = geometryData.QuadVertices.emplace_back();
-						q2 = geometryData.QuadVertices[q1Index];
-						q2.Position = glm::vec2(pl, pt);
-						q2.TexCoord = { l, t };
-					}
+	void GeometryManagerTask::SetTexts(const std::vector<const TextComponent*>& texts, bool bDirty)
+	{
+		if (!bDirty)
+			return;
 
-					const size_t q3Index = geometryData.QuadVertices.size();
-					{
-						auto& q3 = geometryData.QuadVertices.emplace_back();
-						q3 = geometryData.QuadVertices[q1Index];
-						q3.Position = glm::vec2(pr, pt);
-						q3.TexCoord = { r, t };
-					}
+		std::vector<std::pair<TextGeometryType, TextComponentData>> datas;
+		std::vector<glm::mat4> tempTransforms;
+		datas.reserve(texts.size());
+		tempTransforms.reserve(texts.size());
+		std::fill(m_TextTransformSlots.begin(), m_TextTransformSlots.end(), s_InvalidTransformSlot);
 
+		for (auto& text : texts)
+		{
+			if (!text->GetFont())
+				continue;
 
-					const size_t q4Index = geometryData.QuadVertices.size();
-					{
-						auto& q4 = geometryData.QuadVertices.emplace_back();
-						q4 = geometryData.QuadVertices[q1Index];
-						q4.Position = glm::vec2(pr, pb);
-						q4.TexCoord = { r, b };
-					}
+			auto& data = datas.emplace_back();
+			data.first = GetTextGeometryType(text);
+			FillTextData(data.second, text);
+			data.second.TransformIndex = (uint32_t)tempTransforms.size();
+			SetTransformSlot(m_TextTransformSlots, text->Parent, data.second.TransformIndex);
+			tempTransforms.emplace_back(Math::ToTransformMatrix(text->GetWorldTransform()));
+		}
+		m_TextTransformsCount = (uint32_t)tempTransforms.size();
 
-					// back face, they have NON inverted normals
-					geometryData.QuadVertices.emplace_back() = geometryData.QuadVertices[q1Index];
-					geometryData.QuadVertices.emplace_back() = geometryData.QuadVertices[q2Index];
-					geometryData.QuadVertices.emplace_back() = geometryData.QuadVertices[q3Index];
-					geometryData.QuadVertices.emplace_back() = geometryData.QuadVertices[q4Index];
+		RenderManager::Submit([this, texts = std::move(datas), transforms = std::move(tempTransforms)](Ref<CommandBuffer>&) mutable
+		{
+			ForEachTextGeometry([](TextGeometryType, auto& data) { data.Components.clear(); });
 
-					if (i + 1 < textSize)
-					{
-						double advance = glyph->getAdvance();
-						fontGeometry->getAdvance(advance, character, text[i + 1]);
-						x += fsScale * advance + component.KerningOffset;
-					}
-				}
+			m_TextTransforms = std::move(transforms);
+			for (auto& text : texts)
+			{
+				TextComponentData& component = text.second;
+				VisitTextGeometry(text.first, [&component](auto& data) { data.Components.push_back(std::move(component)); });
 			}
-		}
+
+			bUploadTextTransforms = true;
+			bTextTransformsReassigned = true;
+			RebuildTexts();
+		});
 	}
 
-	static void ProcessUnlitComponents(const std::vector<UnlitTextComponentData>& textComponents, std::unordered_map<Ref<Texture2D>, uint32_t>& fontAtlases, UnlitTextGeometryData& geometryData, uint32_t& atlasCurrentIndex)
+	void GeometryManagerTask::UpdateTexts(const std::vector<const TextComponent*>& texts)
 	{
-		if (textComponents.empty())
+		if (texts.empty())
 			return;
 
-		for (auto& component : textComponents)
+		EG_CPU_TIMING_SCOPED("Renderer. Update Texts");
+
+		struct Data
+		{
+			TextComponentData Text;
+			glm::mat4 TransformMatrix; // Used if the text wasn't rendered before because it didn't have a font
+			TextGeometryType Type;
+		};
+
+		std::vector<Data> updateData;
+		updateData.reserve(texts.size());
+		for (auto& text : texts)
 		{
-			const auto& fontGeometry = component.Font->GetFontGeometry();
-			const auto& metrics = fontGeometry->getMetrics();
-			const auto& text = component.Text;
-			const auto& atlas = component.Font->GetAtlas();
-			uint32_t atlasIndex = atlasCurrentIndex;
-			auto it = fontAtlases.find(atlas);
-			if (it == fontAtlases.end())
+			auto& data = updateData.emplace_back();
+			FillTextData(data.Text, text);
+			data.TransformMatrix = Math::ToTransformMatrix(text->GetWorldTransform());
+			data.Type = GetTextGeometryType(text);
+
+			// Texts that get a font for the first time are given a new transform index
+			uint32_t slot = GetTransformSlot(m_TextTransformSlots, text->Parent);
+			if (slot == s_InvalidTransformSlot && data.Text.Font)
 			{
-				if (fontAtlases.size() == RendererConfig::MaxTextures) // Can't be more than EG_MAX_TEXTURES
-				{
-					EG_CORE_CRITICAL("Not enough samplers to store all font atlases! Max supported fonts: {}", RendererConfig::MaxTextures);
-					atlasIndex = 0;
-				}
-				else
-					fontAtlases.emplace(atlas, atlasCurrentIndex++);
+				slot = m_TextTransformsCount++;
+				SetTransformSlot(m_TextTransformSlots, text->Parent, slot);
 			}
-			else
-				atlasIndex = it->second;
-
-			const double spaceAdvance = fontGeometry->getGlyph(' ')->getAdvance();
-			std::vector<int> nextLines = Font::GetNextLines(metrics, fontGeometry, text, spaceAdvance,
-				component.LineHeightOffset, component.KerningOffset, component.MaxWidth);
+			data.Text.TransformIndex = slot;
+		}
 
+		RenderManager::Submit([this, data = std::move(updateData)](Ref<CommandBuffer>&) mutable
+		{
+			bool bRebuild = false;
+			for (auto& update : data)
 			{
-				double x = 0.0;
-				double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-				double y = 0.0;
-				const size_t textSize = text.size();
-				for (int i = 0; i < textSize; i++)
-				{
-					char32_t character = text[i];
-					if (character == '\n' || Font::NextLine(i, nextLines))
-					{
-						x = 0;
-						y -= fsScale * metrics.lineHeight + component.LineHeightOffset;
-						continue;
-					}
+				TextComponentData& text = update.Text;
+				const uint32_t entityID = (uint32_t)text.EntityID;
 
-					const bool bIsTab = character == '\t';
-					if (character == ' ' || bIsTab)
+				auto it = m_TextLocations.find(entityID);
+				if (it != m_TextLocations.end())
+				{
+					const TextLocation location = it->second;
+					const bool bMoved = !text.Font || location.Type != update.Type;
+					VisitTextGeometry(location.Type, [&](auto& geometry)
 					{
-						character = ' '; // treat tabs as spaces
-						double advance = spaceAdvance;
-						if (i < textSize - 1)
+						auto& component = geometry.Components[location.Index];
+						text.TransformIndex = component.TransformIndex;
+						if (bMoved)
 						{
-							char32_t nextCharacter = text[i + 1];
-							if (nextCharacter == '\t')
-								nextCharacter = ' ';
-							fontGeometry->getAdvance(advance, character, nextCharacter);
+							component.Font.reset(); // Removed from this geometry by the rebuild
+							return;
 						}
 
-						// Tab is 4 spaces
-						x += (fsScale * advance + component.KerningOffset) * (bIsTab ? 4.0 : 1.0);
-						continue;
-					}
+						component = std::move(text);
+						if (!bRebuild && !RelayoutText(geometry, location.Index, m_TextLayoutCache, m_FontAtlases))
+							bRebuild = true;
+					});
 
-					auto glyph = fontGeometry->getGlyph(character);
-					if (!glyph)
-						glyph = fontGeometry->getGlyph('?');
-					if (!glyph)
+					if (!bMoved)
 						continue;
-
-					double l, b, r, t;
-					glyph->getQuadAtlasBounds(l, b, r, t);
-
-					double pl, pb, pr, pt;
-					glyph->getQuadPlaneBounds(pl, pb, pr, pt);
-
-					pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
-					pl += x, pb += y, pr += x, pt += y;
-
-					double texelWidth = 1. / atlas->GetWidth();
-					double texelHeight = 1. / atlas->GetHeight();
-					l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
-
-					const size_t q1Index = geometryData.QuadVertices.size();
-					{
-						auto& q1 = geometryData.QuadVertices.emplace_back();
-						q1.Position = glm::vec2(pl, pb);
-						q1.Color = component.Color;
-						q1.TexCoord = { l, b };
-						q1.EntityID = component.EntityID;
-						q1.AtlasIndex = atlasIndex;
-						q1.TransformIndex = component.TransformIndex;
-					}
-
-					const size_t q2Index = geometryData.QuadVertices.size();
-					{
-						auto& q2 = geometryData.QuadVertices.emplace_back();
-						q2 = geometryData.QuadVertices[q1Index];
-						q2.Position = glm::vec2(pl, pt);
-						q2.TexCoord = { l, t };
-					}
-
-					const size_t q3Index = geometryData.QuadVertices.size();
-					{
-						auto& q3 = geometryData.QuadVertices.emplace_back();
-						q3 = geometryData.QuadVertices[q1Index];
-						q3.Position = glm::vec2(pr, pt);
-						q3.TexCoord = { r, t };
-					}
-
-					const size_t q4Index = geometryData.QuadVertices.size();
-					{
-						auto& q4 = geometryData.QuadVertices.emplace_back();
-						q4 = geometryData.QuadVertices[q1Index];
-						q4.Position = glm::vec2(pr, pb);
-						q4.TexCoord = { r, b };
-					}
-
-					if (i + 1 < textSize)
-					{
-						double advance = glyph->getAdvance();
-						fontGeometry->getAdvance(advance, character, text[i + 1]);
-						x += fsScale * advance + component.KerningOffset;
-					}
+					m_TextLocations.erase(it);
 				}
-			}
-		}
-	}
-
-	void GeometryManagerTask::SetTexts(const std::vector<const TextComponent*>& texts, bool bDirty)
-	{
-		if (!bDirty)
-			return;
-
-		std::vector<LitTextComponentData> opaqueLitDatas;
-		std::vector<LitTextComponentData> opaqueLitNotCastingShadowDatas;
-		std::vector<LitTextComponentData> maskedLitDatas;
-		std::vector<LitTextComponentData> maskedLitNotCastingShadowDatas;
-		std::vector<LitTextComponentData> translucentLitDatas;
-		std::vector<LitTextComponentData> translucentLitNotCastingShadowDatas;
-		std::vector<UnlitTextComponentData> unlitDatas;
-		std::vector<UnlitTextComponentData> unlitNotCastingShadowDatas;
-		std::unordered_map<uint32_t, uint64_t> tempTransformsIndices; // EntityID -> uint64_t (index to m_TextTransformIndices)
-		std::vector<glm::mat4> tempTransforms;
-
-		opaqueLitDatas.reserve(texts.size());
-		opaqueLitNotCastingShadowDatas.reserve(texts.size());
-		maskedLitDatas.reserve(texts.size());
-		maskedLitNotCastingShadowDatas.reserve(texts.size());
-		translucentLitDatas.reserve(texts.size());
-		translucentLitNotCastingShadowDatas.reserve(texts.size());
-		unlitDatas.reserve(texts.size());
-		unlitNotCastingShadowDatas.reserve(texts.size());
-		tempTransforms.reserve(texts.size());
-		tempTransformsIndices.reserve(texts.size());
-
-		for (auto& text : texts)
-		{
-			if (!text->GetFont())
-				continue;
-
-			const uint32_t transformIndex = (uint32_t)tempTransforms.size();
-			if (text->IsLit())
-			{
-				LitTextComponentData* data = nullptr;
-				// Emplace into correct container
-				switch (text->GetBlendMode())
+				else
 				{
-					case Material::BlendMode::Opaque:
-						data = &(text->DoesCastShadows() ? opaqueLitDatas.emplace_back() : opaqueLitNotCastingShadowDatas.emplace_back());
-						break;
-					case Material::BlendMode::Translucent:
-						data = &(text->DoesCastShadows() ? translucentLitDatas.emplace_back() : translucentLitNotCastingShadowDatas.emplace_back());
-						break;
-					case Material::BlendMode::Masked:
-						data = &(text->DoesCastShadows() ? maskedLitDatas.emplace_back() : maskedLitNotCastingShadowDatas.emplace_back());
-						break;
+					// The text wasn't rendered before since it didn't have a font
+					if (!text.Font)
+						continue;
 
-					default: EG_ASSERT(false);
+					if (text.TransformIndex >= m_TextTransforms.size())
+						m_TextTransforms.resize(size_t(text.TransformIndex) + 1);
+					m_TextTransforms[text.TransformIndex] = update.TransformMatrix;
+					bUploadTextTransforms = true;
 				}
 
-				data->Text = ToUTF32(text->GetText());
-				data->Font = text->GetFont();
-				data->Albedo = text->GetAlbedoColor();
-				data->Emissive = text->GetEmissiveColor();
-				data->Roughness = glm::max(EG_MIN_ROUGHNESS, text->GetRoughness());
-				data->Metallness = text->GetMetallness();
-				data->AO = text->GetAO();
-				data->EntityID = text->Parent.GetID();
-				data->LineHeightOffset = text->GetLineSpacing();
-				data->KerningOffset = text->GetKerning();
-				data->MaxWidth = text->GetMaxWidth();
-				data->TransformIndex = transformIndex;
-				data->Opacity = text->GetOpacity();
-				data->OpacityMask = text->GetOpacityMask();
+				bRebuild = true;
+				if (text.Font)
+				{
+					VisitTextGeometry(update.Type, [this, &text, entityID, type = update.Type](auto& geometry)
+					{
+						m_TextLocations[entityID] = { type, geometry.Components.size() };
+						geometry.Components.push_back(std::move(text));
+					});
+				}
 			}
+
+			if (bRebuild)
+				RebuildTexts();
 			else
 			{
-				auto& data = text->DoesCastShadows() ? unlitDatas.emplace_back() : unlitNotCastingShadowDatas.emplace_back();
-				data.TransformIndex = transformIndex;
-				data.Text = ToUTF32(text->GetText());
-				data.Font = text->GetFont();
-				data.Color = text->GetColor();
-				data.EntityID = text->Parent.GetID();
-				data.LineHeightOffset = text->GetLineSpacing();
-				data.KerningOffset = text->GetKerning();
-				data.MaxWidth = text->GetMaxWidth();
+				// New fonts are appended, so indices of the existing atlases stay the same
+				GatherFontAtlases(m_FontAtlases, m_Atlases);
+				bUploadTextQuads = true;
 			}
-			tempTransformsIndices.emplace(text->Parent.GetID(), transformIndex);
-			tempTransforms.emplace_back(Math::ToTransformMatrix(text->GetWorldTransform()));
-		}
+		});
+	}
+
+	void GeometryManagerTask::RebuildTexts()
+	{
+		EG_CPU_TIMING_SCOPED("Renderer. Rebuild Texts");
 
-		RenderManager::Submit([this, opaqueTextComponents = std::move(opaqueLitDatas), opaqueNotCastingShadowsTextComponents = std::move(opaqueLitNotCastingShadowDatas),
-			maskedTextComponents = std::move(maskedLitDatas), maskedNotCastingShadowsTextComponents = std::move(maskedLitNotCastingShadowDatas),
-			translucentTextComponents = std::move(translucentLitDatas), translucentNotCastingShadowsTextComponents = std::move(translucentLitNotCastingShadowDatas),
-			unlitNotCastingShadowsTextComponents = std::move(unlitNotCastingShadowDatas),
-			unlitTextComponents = std::move(unlitDatas), transforms = std::move(tempTransforms), transformsIndices = std::move(tempTransformsIndices)](Ref<CommandBuffer>&) mutable
+		m_FontAtlases.clear();
+		m_TextLocations.clear();
+		ForEachTextGeometry([this](TextGeometryType type, auto& data)
 		{
-			bUploadTextQuads = true;
-			bUploadTextTransforms = true;
+			// Texts that were removed or moved to another geometry by `UpdateTexts` don't have a font
+			auto& components = data.Components;
+			components.erase(std::remove_if(components.begin(), components.end(), [](const TextComponentData& text) { return !text.Font; }), components.end());
 
-			m_OpaqueLitTextData.QuadVertices.clear();
-			m_OpaqueLitNonShadowTextData.QuadVertices.clear();
-			m_MaskedLitTextData.QuadVertices.clear();
-			m_MaskedLitNonShadowTextData.QuadVertices.clear();
-			m_TranslucentLitTextData.QuadVertices.clear();
-			m_TranslucentNonShadowLitTextData.QuadVertices.clear();
-			m_UnlitTextData.QuadVertices.clear();
-			m_UnlitNonShadowTextData.QuadVertices.clear();
-
-			m_FontAtlases.clear();
-			m_Atlases.clear();
-			m_TextTransforms = std::move(transforms);
-			m_TextTransformIndices = std::move(transformsIndices);
-
-			uint32_t atlasCurrentIndex = 0;
-			ProcessLitComponents(opaqueTextComponents, m_FontAtlases, m_OpaqueLitTextData, atlasCurrentIndex);
-			ProcessLitComponents(opaqueNotCastingShadowsTextComponents, m_FontAtlases, m_OpaqueLitNonShadowTextData, atlasCurrentIndex);
-			ProcessLitComponents(maskedTextComponents, m_FontAtlases, m_MaskedLitTextData, atlasCurrentIndex);
-			ProcessLitComponents(maskedNotCastingShadowsTextComponents, m_FontAtlases, m_MaskedLitNonShadowTextData, atlasCurrentIndex);
-			ProcessLitComponents(translucentTextComponents, m_FontAtlases, m_TranslucentLitTextData, atlasCurrentIndex);
-			ProcessLitComponents(translucentNotCastingShadowsTextComponents, m_FontAtlases, m_TranslucentNonShadowLitTextData, atlasCurrentIndex);
-			ProcessUnlitComponents(unlitTextComponents, m_FontAtlases, m_UnlitTextData, atlasCurrentIndex);
-			ProcessUnlitComponents(unlitNotCastingShadowsTextComponents, m_FontAtlases, m_UnlitNonShadowTextData, atlasCurrentIndex);
-
-			m_Atlases.resize(atlasCurrentIndex);
-			for (auto& atlas : m_FontAtlases)
-				m_Atlases[atlas.second] = atlas.first;
+			for (size_t i = 0; i < components.size(); ++i)
+				m_TextLocations[(uint32_t)components[i].EntityID] = { type, i };
+
+			LayoutTexts(data, m_TextLayoutCache, m_FontAtlases);
 		});
+		m_TextLayoutCache.RemoveUnused();
+		GatherFontAtlases(m_FontAtlases, m_Atlases);
+		bUploadTextQuads = true;
 	}
 	
-	void GeometryManagerTask::SetTransforms(const std::set<const TextComponent*>& texts)
+	void GeometryManagerTask::SetTransforms(const std::vector<const TextComponent*>& texts)
 	{
 		if (texts.empty())
 			return;
 
-		struct Data
-		{
-			glm::mat4 TransformMatrix;
-			uint32_t ID;
-		};
-
-		std::vector<Data> updateData;
-		updateData.reserve(texts.size());
-
-		for (auto& text : texts)
-			updateData.push_back({ Math::ToTransformMatrix(text->GetWorldTransform()), text->Parent.GetID() });
+		EG_CPU_TIMING_SCOPED("Renderer. Set Texts Transforms");
 
-		RenderManager::Submit([this, data = std::move(updateData)](Ref<CommandBuffer>&)
+		GatherTransformUpdates(texts, m_TextTransformSlots, m_TextTransformUpdates);
+		RenderManager::Submit([this](Ref<CommandBuffer>&)
 		{
-			for (auto& text : data)
-			{
-				auto it = m_TextTransformIndices.find(text.ID);
-				if (it != m_TextTransformIndices.end())
-				{
-					m_TextTransforms[it->second] = text.TransformMatrix;
-					m_TextUploadSpecificTransforms.push_back(it->second);
-					bUploadTextSpecificTransforms = true;
-				}
-			}
+			ApplyTransformUpdates(m_TextTransformUpdates, m_TextTransforms, m_TextUploadSpecificTransforms, bUploadTextSpecificTransforms);
 		});
 	}
 
@@ -1304,6 +1095,11 @@ namespace Eagle
 		const size_t currentVertexSize = quads.size() * sizeof(TextVertexType);
 		const size_t currentIndexSize = (quads.size() / 4) * (sizeof(Index) * 6);
 
+		size_t uploadBegin = textsData.UploadBegin;
+		size_t uploadEnd = glm::min(textsData.UploadEnd, quads.size());
+		textsData.UploadBegin = SIZE_MAX;
+		textsData.UploadEnd = 0;
+
 		if (currentVertexSize > vb->GetSize())
 		{
 			size_t newSize = glm::max(currentVertexSize, vb->GetSize() * 3 / 2);
@@ -1311,6 +1107,10 @@ namespace Eagle
 			newSize += alignment - (newSize % alignment);
 
 			vb->Resize(newSize);
+
+			// Contents are lost, everything needs to be uploaded
+			uploadBegin = 0;
+			uploadEnd = quads.size();
 		}
 		if (currentIndexSize > ib->GetSize())
 		{
@@ -1322,8 +1122,13 @@ namespace Eagle
 			UploadIndexBuffer(cmd, ib);
 		}
 
-		cmd->Write(vb, quads.data(), currentVertexSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
-		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		if (uploadBegin < uploadEnd)
+		{
+			const size_t offset = uploadBegin * sizeof(TextVertexType);
+			const size_t size = (uploadEnd - uploadBegin) * sizeof(TextVertexType);
+			cmd->Write(vb, quads.data() + uploadBegin, size, offset, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		}
 	}
 
 	void GeometryManagerTask::UploadTexts(const Ref<CommandBuffer>& cmd, UnlitTextGeometryData& textsData)
@@ -1340,6 +1145,11 @@ namespace Eagle
 		const size_t currentVertexSize = quads.size() * sizeof(TextVertexType);
 		const size_t currentIndexSize = (quads.size() / 4) * (sizeof(Index) * 6);
 
+		size_t uploadBegin = textsData.UploadBegin;
+		size_t uploadEnd = glm::min(textsData.UploadEnd, quads.size());
+		textsData.UploadBegin = SIZE_MAX;
+		textsData.UploadEnd = 0;
+
 		if (currentVertexSize > vb->GetSize())
 		{
 			size_t newSize = glm::max(currentVertexSize, vb->GetSize() * 3 / 2);
@@ -1347,6 +1157,10 @@ namespace Eagle
 			newSize += alignment - (newSize % alignment);
 
 			vb->Resize(newSize);
+
+			// Contents are lost, everything needs to be uploaded
+			uploadBegin = 0;
+			uploadEnd = quads.size();
 		}
 		if (currentIndexSize > ib->GetSize())
 		{
@@ -1358,7 +1172,12 @@ namespace Eagle
 			UploadIndexBufferOneSided(cmd, ib);
 		}
 
-		cmd->Write(vb, quads.data(), currentVertexSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
-		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		if (uploadBegin < uploadEnd)
+		{
+			const size_t offset = uploadBegin * sizeof(TextVertexType);
+			const size_t size = (uploadEnd - uploadBegin) * sizeof(TextVertexType);
+			cmd->Write(vb, quads.data() + uploadBegin, size, offset, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		}
 	}
 }
@@ -4,6 +4,7 @@
 #include "Eagle/Classes/StaticMesh.h"
 #include "Eagle/Core/GUID.h"
 #include "Eagle/Core/Transform.h"
+#include "Eagle/UI/TextLayoutCache.h"
 
 struct CPUMaterial;
 
@@ -49,12 +50,14 @@ namespace Eagle
 	class Buffer;
 	class Texture2D;
 	class SubTexture2D;
+	class Font;
 
-	struct QuadVertex
+	// Per-instance data of a sprite. Quad corners are generated in the vertex shader from the unit quad
+	struct SpriteInstance
 	{
-		glm::vec2 TexCoords;
-		uint32_t TransformIndex;
-		uint32_t MaterialIndex;
+		glm::vec4 UVBounds = glm::vec4(0.f, 0.f, 1.f, 1.f); // Min UV, max UV
+		uint32_t TransformIndex = 0;
+		uint32_t MaterialIndex = 0;
 		int EntityID = -1;
 	};
 
@@ -109,24 +112,94 @@ namespace Eagle
 
 	struct SpriteGeometryData
 	{
-		Ref<Buffer> VertexBuffer;
-		Ref<Buffer> IndexBuffer;
+		Ref<Buffer> InstanceBuffer;
 
-		std::vector<QuadVertex> QuadVertices;
+		std::vector<SpriteInstance> Instances;
+	};
+
+	// Render thread copy of a text component. Lit texts use the material values, unlit ones use `Color`
+	struct TextComponentData
+	{
+		glm::vec3 Albedo;
+		float Roughness;
+		glm::vec3 Emissive;
+		float Metallness;
+		glm::vec3 Color;
+		std::string Text;
+		Ref<Font> Font;
+		int EntityID;
+		float LineHeightOffset;
+		float KerningOffset;
+		float MaxWidth;
+		float AO;
+		float Opacity;
+		float OpacityMask;
+		uint32_t TransformIndex;
+	};
+
+	// Vertices of a single text component. Glyphs past the laid out ones are degenerate,
+	// so that the text can grow a bit without moving the vertices of other texts
+	struct TextVerticesRange
+	{
+		size_t FirstVertex = 0;
+		size_t GlyphsCapacity = 0;
+	};
+
+	// Transforms that were changed during a frame, with their indices already resolved by the main thread.
+	// It's filled by the main thread and applied by the render thread during the same frame (`RenderManager::BeginFrame` waits for the render thread),
+	// so the same memory is reused every frame
+	struct TransformUpdates
+	{
+		std::vector<glm::mat4> Transforms;
+		std::vector<uint64_t> Indices; // Parallel to `Transforms`. Index to the transforms array of the render thread
+
+		void Clear()
+		{
+			Transforms.clear();
+			Indices.clear();
+		}
 	};
 
 	struct LitTextGeometryData
 	{
+		static constexpr size_t VerticesPerGlyph = 8; // Front and back faces
+
 		Ref<Buffer> VertexBuffer;
 		Ref<Buffer> IndexBuffer;
 		std::vector<LitTextQuadVertex> QuadVertices;
+		std::vector<TextComponentData> Components;
+		std::vector<TextVerticesRange> Ranges; // Parallel to `Components`
+
+		// Range of quad vertices that needs to be uploaded
+		size_t UploadBegin = SIZE_MAX;
+		size_t UploadEnd = 0;
 	};
 
 	struct UnlitTextGeometryData
 	{
+		static constexpr size_t VerticesPerGlyph = 4;
+
 		Ref<Buffer> VertexBuffer;
 		Ref<Buffer> IndexBuffer;
 		std::vector<UnlitTextQuadVertex> QuadVertices;
+		std::vector<TextComponentData> Components;
+		std::vector<TextVerticesRange> Ranges; // Parallel to `Components`
+
+		// Range of quad vertices that needs to be uploaded
+		size_t UploadBegin = SIZE_MAX;
+		size_t UploadEnd = 0;
+	};
+
+	enum class TextGeometryType : uint8_t
+	{
+		OpaqueLit,
+		OpaqueLitNonShadow,
+		MaskedLit,
+		MaskedLitNonShadow,
+		TranslucentLit,
+		TranslucentLitNonShadow,
+		Unlit,
+		UnlitNonShadow
 	};
 
 	struct MeshData
@@ -138,9 +211,8 @@ namespace Eagle
 	struct SpriteData
 	{
 		Ref<Material> Material;
-		glm::vec2 AtlasSpriteUVs[4];
+		glm::vec4 UVBounds = glm::vec4(0.f, 0.f, 1.f, 1.f); // Min UV, max UV
 		uint32_t EntityID = 0u;
-		bool bAtlas = false;
 		bool bCastsShadows = true;
 	};
 
@@ -154,19 +226,21 @@ namespace Eagle
 
 		// ------- Meshes -------
 		void SetMeshes(const std::vector<const StaticMeshComponent*>& meshes, bool bDirty);
-		void SetTransforms(const std::set<const StaticMeshComponent*>& meshes);
+		void SetTransforms(const std::vector<const StaticMeshComponent*>& meshes);
 		void SortMeshes();
 		void UploadMeshes(const Ref<CommandBuffer>& cmd, MeshGeometryData& data, const std::unordered_map<MeshKey, std::vector<MeshData>>& meshes);
 
 		// ------- Sprites -------
 		void SetSprites(const std::vector<const SpriteComponent*>& sprites, bool bDirty);
-		void SetTransforms(const std::set<const SpriteComponent*>& sprites);
+		void SetTransforms(const std::vector<const SpriteComponent*>& sprites);
 		void SortSprites();
 		void UploadSprites(const Ref<CommandBuffer>& cmd, SpriteGeometryData& spritesData);
 
 		// ------- Texts -------
 		void SetTexts(const std::vector<const TextComponent*>& texts, bool bDirty);
-		void SetTransforms(const std::set<const TextComponent*>& texts);
+		// Relayouts only the passed texts into their vertex ranges. Texts that were added or removed need to go through `SetTexts`
+		void UpdateTexts(const std::vector<const TextComponent*>& texts);
+		void SetTransforms(const std::vector<const TextComponent*>& texts);
 		void UploadTexts(const Ref<CommandBuffer>& cmd, LitTextGeometryData& textsData);
 		void UploadTexts(const Ref<CommandBuffer>& cmd, UnlitTextGeometryData& textsData);
 
@@ -206,11 +280,32 @@ namespace Eagle
 		const std::vector<Ref<Texture2D>>& GetAtlases() const { return m_Atlases; }
 
 	private:
-		// ------- Sprites -------
-		static void AddQuad(std::vector<QuadVertex>& vertices, const SpriteData& sprite, const glm::mat4& transform, uint32_t transformIndex);
+		// ------- Texts -------
+		// Lays out all texts from their components data. Used when texts were added or removed, or a text didn't fit into its range
+		void RebuildTexts();
+
+		template<typename Func>
+		void ForEachTextGeometry(Func&& func)
+		{
+			func(TextGeometryType::OpaqueLit, m_OpaqueLitTextData);
+			func(TextGeometryType::OpaqueLitNonShadow, m_OpaqueLitNonShadowTextData);
+			func(TextGeometryType::MaskedLit, m_MaskedLitTextData);
+			func(TextGeometryType::MaskedLitNonShadow, m_MaskedLitNonShadowTextData);
+			func(TextGeometryType::TranslucentLit, m_TranslucentLitTextData);
+			func(TextGeometryType::TranslucentLitNonShadow, m_TranslucentNonShadowLitTextData);
+			func(TextGeometryType::Unlit, m_UnlitTextData);
+			func(TextGeometryType::UnlitNonShadow, m_UnlitNonShadowTextData);
+		}
 
-		// General function that is being called
-		static void AddQuad(std::vector<QuadVertex>& vertices, const glm::mat4& transform, const Ref<Material>& material, uint32_t transformIndex, const glm::vec2 UVs[4], int entityID = -1);
+		template<typename Func>
+		void VisitTextGeometry(TextGeometryType type, Func&& func)
+		{
+			ForEachTextGeometry([type, &func](TextGeometryType geometryType, auto& data)
+			{
+				if (geometryType == type)
+					func(data);
+			});
+		}
 
 	private:
 		// ------- Meshes -------
@@ -228,7 +323,9 @@ namespace Eagle
 		std::vector<glm::mat4> m_MeshTransforms;
 		std::vector<uint64_t> m_MeshUploadSpecificTransforms; // Instead of uploading all transforms, upload just required transforms. uint - index to "std::vector<glm::mat4> transforms"
 
-		std::unordered_map<uint32_t, uint64_t> m_MeshTransformIndices; // EntityID -> uint64_t (index to m_MeshTransforms)
+		// Main thread data. Entity index -> index to m_MeshTransforms
+		std::vector<uint32_t> m_MeshTransformSlots;
+		TransformUpdates m_MeshTransformUpdates;
 
 		bool bUploadMeshTransforms = true;
 		bool bUploadMeshSpecificTransforms = false;
@@ -253,16 +350,16 @@ namespace Eagle
 
 		std::vector<SpriteData> m_Sprites;
 
-		std::unordered_map<uint32_t, uint64_t> m_SpriteTransformIndices; // EntityID -> uint64_t (index to m_SpriteTransforms)
+		// Main thread data. Entity index -> index to m_SpriteTransforms
+		std::vector<uint32_t> m_SpriteTransformSlots;
+		TransformUpdates m_SpriteTransformUpdates;
 
 		bool bUploadSpritesTransforms = true;
 		bool bUploadSpritesSpecificTransforms = false;
 		bool bUploadSprites = true;
 
 		static constexpr size_t s_SpritesDefaultQuadCount = 16; // How much quads we can render without reallocating
-		static constexpr size_t s_SpritesDefaultVerticesCount = s_SpritesDefaultQuadCount * 4;
-		static constexpr size_t s_SpritesBaseVertexBufferSize = s_SpritesDefaultVerticesCount * sizeof(QuadVertex);
-		static constexpr size_t s_SpritesBaseIndexBufferSize = s_SpritesDefaultQuadCount * (sizeof(Index) * 6);
+		static constexpr size_t s_SpritesBaseInstanceBufferSize = s_SpritesDefaultQuadCount * sizeof(SpriteInstance);
 
 		// ------- !Sprites -------
 		
@@ -271,6 +368,7 @@ namespace Eagle
 		Ref<Buffer> m_TextPrevTransformsBuffer;
 		std::unordered_map<Ref<Texture2D>, uint32_t> m_FontAtlases;
 		std::vector<Ref<Texture2D>> m_Atlases;
+		TextLayoutCache m_TextLayoutCache;
 
 		// ------- Lit Text 3D -------
 		LitTextGeometryData m_OpaqueLitTextData;
@@ -284,10 +382,22 @@ namespace Eagle
 
 		std::vector<glm::mat4> m_TextTransforms;
 		std::vector<uint64_t> m_TextUploadSpecificTransforms; // Instead of uploading all transforms, upload just required transforms. uint - index to "std::vector<glm::mat4> transforms"
-		std::unordered_map<uint32_t, uint64_t> m_TextTransformIndices; // EntityID -> uint64_t (index to m_TextTransformIndices)
+
+		// Main thread data. Entity index -> index to m_TextTransforms. Texts that get a font are given new indices by `UpdateTexts`
+		std::vector<uint32_t> m_TextTransformSlots;
+		uint32_t m_TextTransformsCount = 0;
+		TransformUpdates m_TextTransformUpdates;
+
+		struct TextLocation
+		{
+			TextGeometryType Type;
+			size_t Index; // Index to `Components` of the geometry data
+		};
+		std::unordered_map<uint32_t, TextLocation> m_TextLocations; // EntityID -> TextLocation
 
 		bool bUploadTextQuads = true;
 		bool bUploadTextTransforms = true;
+		bool bTextTransformsReassigned = true; // Previous transforms don't match the current indices
 		bool bUploadTextSpecificTransforms = false;
 
 		static constexpr size_t s_TextDefaultQuadCount = 16; // How much quads we can render without reallocating
@@ -16,6 +16,7 @@ namespace Eagle
 		, m_Output(output)
 	{
 		bJitter = m_Renderer.GetOptions().InternalState.bJitter;
+		bScaledRendering = m_Renderer.GetOptions().InternalState.bScaledRendering;
 		InitPipeline();
 	}
 
@@ -51,7 +52,7 @@ namespace Eagle
 	void GridTask::InitPipeline()
 	{
 		ColorAttachment attachment;
-		attachment.Image = m_Output;
+		attachment.Image = bScaledRendering ? m_Renderer.GetHDROutput() : m_Output;
 		attachment.ClearOperation = ClearOperation::Load;
 		attachment.InitialLayout = ImageReadAccess::PixelShaderRead;
 		attachment.FinalLayout = ImageReadAccess::PixelShaderRead;
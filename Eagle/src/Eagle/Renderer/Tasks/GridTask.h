@@ -14,10 +14,12 @@ namespace Eagle
 		void RecordCommandBuffer(const Ref<CommandBuffer>& cmd) override;
 		void InitWithOptions(const SceneRendererSettings& settings) override
 		{
-			if (settings.InternalState.bJitter == bJitter)
+			if (settings.InternalState.bJitter == bJitter &&
+				settings.InternalState.bScaledRendering == bScaledRendering)
 				return;
 
 			bJitter = settings.InternalState.bJitter;
+			bScaledRendering = settings.InternalState.bScaledRendering;
 			InitPipeline();
 		}
 
@@ -30,5 +32,6 @@ namespace Eagle
 		Ref<PipelineGraphics> m_Pipeline;
 		Ref<Image> m_Output;
 		bool bJitter = false;
+		bool bScaledRendering = false; // If set, grid is rendered into HDR target before TAA so that it can be upscaled along with the scene
 	};
 }
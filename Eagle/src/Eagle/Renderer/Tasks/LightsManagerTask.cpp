@@ -20,6 +20,29 @@ namespace Eagle
 
 	static const glm::mat4 s_PointLightPerspectiveProjection = glm::perspective(glm::radians(90.f), 1.f, EG_POINT_LIGHT_NEAR, EG_POINT_LIGHT_FAR);
 
+	// Adjacent indices are merged, so that changed lights are written with as few writes as possible
+	template<typename LightType>
+	static void UploadChangedLights(const Ref<CommandBuffer>& cmd, const Ref<Buffer>& buffer, const std::vector<LightType>& lights, std::vector<uint32_t>& indices)
+	{
+		std::sort(indices.begin(), indices.end());
+		indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+		const size_t count = indices.size();
+		for (size_t i = 0; i < count;)
+		{
+			const uint32_t first = indices[i];
+			uint32_t last = first;
+			while (++i < count && indices[i] == last + 1)
+				last = indices[i];
+
+			const size_t offset = first * sizeof(LightType);
+			const size_t size = (size_t(last - first) + 1) * sizeof(LightType);
+			cmd->Write(buffer, &lights[first], size, offset, BufferLayoutType::StorageBuffer, BufferLayoutType::StorageBuffer);
+		}
+		cmd->StorageBufferBarrier(buffer);
+		indices.clear();
+	}
+
 	LightsManagerTask::LightsManagerTask(SceneRenderer& renderer)
 		: RendererTask(renderer)
 	{
@@ -49,36 +72,67 @@ namespace Eagle
 			return;
 
 		std::vector<PointLight> tempData;
+		std::vector<uint32_t> entityIDs;
 		tempData.reserve(pointLights.size());
+		entityIDs.reserve(pointLights.size());
 		for (auto& pointLight : pointLights)
 		{
-			const bool bCastsShadows = pointLight->DoesCastShadows();
-			const bool bVolumetric = pointLight->IsVolumetricLight();
-
-			auto& light = tempData.emplace_back();
-			light.Position = pointLight->GetWorldTransform().Location;
-			const float radius = pointLight->GetRadius();
-			light.Radius2 = radius * radius;
-			light.LightColor = pointLight->GetLightColor() * pointLight->GetIntensity();
-			light.VolumetricFogIntensity = glm::max(pointLight->GetVolumetricFogIntensity(), 0.0f);
-
-			uint32_t* intensity = (uint32_t*)&light.VolumetricFogIntensity;
-			*intensity = (*intensity) | (bVolumetric ? 0x80000000 : 0u);
-
-			uint32_t* radius2 = (uint32_t*)&light.Radius2;
-			*radius2 = (*radius2) | (bCastsShadows ? 0x80000000 : 0u);
+			FillPointLight(tempData.emplace_back(), pointLight);
+			entityIDs.push_back(pointLight->Parent.GetID());
 		}
 
-		RenderManager::Submit([this, pointLights = std::move(tempData)](Ref<CommandBuffer>& cmd) mutable
+		RenderManager::Submit([this, pointLights = std::move(tempData), entityIDs = std::move(entityIDs)](Ref<CommandBuffer>& cmd) mutable
 		{
 			m_PointLights = std::move(pointLights);
 
 			for (auto& light : m_PointLights)
+				UpdateViewProj(light);
+
+			m_PointLightIndices.clear();
+			m_PointLightIndices.reserve(entityIDs.size());
+			for (uint32_t i = 0; i < uint32_t(entityIDs.size()); ++i)
+				m_PointLightIndices.emplace(entityIDs[i], i);
+
+			m_PointLightsToUpload.clear();
+			bPointLightsDirty = true;
+		});
+	}
+
+	void LightsManagerTask::UpdatePointLights(const std::vector<const PointLightComponent*>& pointLights)
+	{
+		if (pointLights.empty())
+			return;
+
+		EG_CPU_TIMING_SCOPED("Renderer. Update Point Lights");
+
+		struct Data
+		{
+			PointLight Light;
+			uint32_t ID;
+		};
+
+		std::vector<Data> updateData;
+		updateData.reserve(pointLights.size());
+		for (auto& pointLight : pointLights)
+		{
+			auto& data = updateData.emplace_back();
+			FillPointLight(data.Light, pointLight);
+			data.ID = pointLight->Parent.GetID();
+		}
+
+		RenderManager::Submit([this, data = std::move(updateData)](Ref<CommandBuffer>&) mutable
+		{
+			for (auto& pointLight : data)
 			{
-				for (int i = 0; i < 6; ++i)
-					light.ViewProj[i] = s_PointLightPerspectiveProjection * glm::lookAt(light.Position, light.Position + s_Directions[i], s_UpVectors[i]);
+				auto it = m_PointLightIndices.find(pointLight.ID);
+				if (it == m_PointLightIndices.end())
+					continue;
+
+				auto& light = m_PointLights[it->second];
+				light = pointLight.Light;
+				UpdateViewProj(light);
+				m_PointLightsToUpload.push_back(it->second);
 			}
-			bPointLightsDirty = true;
 		});
 	}
 
@@ -88,43 +142,121 @@ namespace Eagle
 			return;
 
 		std::vector<SpotLight> tempData;
+		std::vector<uint32_t> entityIDs;
 		tempData.reserve(spotLights.size());
+		entityIDs.reserve(spotLights.size());
 		for (auto& spotLight : spotLights)
 		{
-			auto& light = tempData.emplace_back();
-
-			const float innerAngle = glm::clamp(spotLight->GetInnerCutOffAngle(), 1.f, 80.f);
-			const float outerAngle = glm::clamp(spotLight->GetOuterCutOffAngle(), 1.f, 80.f);
-
-			light.Position = spotLight->GetWorldTransform().Location;
-			light.LightColor = spotLight->GetLightColor() * spotLight->GetIntensity();
-			light.Direction = spotLight->GetForwardVector();
-			light.InnerCutOffRadians = glm::radians(innerAngle);
-			light.OuterCutOffRadians = glm::radians(outerAngle);
-			light.VolumetricFogIntensity = glm::max(spotLight->GetVolumetricFogIntensity(), 0.0f);
-			const float distance = spotLight->GetDistance();
-			light.Distance2  = distance * distance;
-			light.ViewProj[0] = glm::vec4(spotLight->GetUpVector(), 0.f); // Temporary storing up vector
-			light.bCastsShadows = uint32_t(spotLight->DoesCastShadows());
-			light.bVolumetricLight = uint32_t(spotLight->IsVolumetricLight());
+			FillSpotLight(tempData.emplace_back(), spotLight);
+			entityIDs.push_back(spotLight->Parent.GetID());
 		}
 
-		RenderManager::Submit([this, spotLights = std::move(tempData)](Ref<CommandBuffer>& cmd) mutable
+		RenderManager::Submit([this, spotLights = std::move(tempData), entityIDs = std::move(entityIDs)](Ref<CommandBuffer>& cmd) mutable
 		{
 			m_SpotLights = std::move(spotLights);
 
 			for (auto& light : m_SpotLights)
+				UpdateViewProj(light);
+
+			m_SpotLightIndices.clear();
+			m_SpotLightIndices.reserve(entityIDs.size());
+			for (uint32_t i = 0; i < uint32_t(entityIDs.size()); ++i)
+				m_SpotLightIndices.emplace(entityIDs[i], i);
+
+			m_SpotLightsToUpload.clear();
+			bSpotLightsDirty = true;
+		});
+	}
+
+	void LightsManagerTask::UpdateSpotLights(const std::vector<const SpotLightComponent*>& spotLights)
+	{
+		if (spotLights.empty())
+			return;
+
+		EG_CPU_TIMING_SCOPED("Renderer. Update Spot Lights");
+
+		struct Data
+		{
+			SpotLight Light;
+			uint32_t ID;
+		};
+
+		std::vector<Data> updateData;
+		updateData.reserve(spotLights.size());
+		for (auto& spotLight : spotLights)
+		{
+			auto& data = updateData.emplace_back();
+			FillSpotLight(data.Light, spotLight);
+			data.ID = spotLight->Parent.GetID();
+		}
+
+		RenderManager::Submit([this, data = std::move(updateData)](Ref<CommandBuffer>&) mutable
+		{
+			for (auto& spotLight : data)
 			{
-				const float cutoff = light.OuterCutOffRadians * 2.f;
-				glm::mat4 spotLightPerspectiveProjection = glm::perspective(cutoff, 1.f, 0.01f, 50.f);
-				spotLightPerspectiveProjection[1][1] *= -1.f;
-				const glm::vec3 upVector = light.ViewProj[0];
-				light.ViewProj = spotLightPerspectiveProjection * glm::lookAt(light.Position, light.Position + light.Direction, upVector);
+				auto it = m_SpotLightIndices.find(spotLight.ID);
+				if (it == m_SpotLightIndices.end())
+					continue;
+
+				auto& light = m_SpotLights[it->second];
+				light = spotLight.Light;
+				UpdateViewProj(light);
+				m_SpotLightsToUpload.push_back(it->second);
 			}
-			bSpotLightsDirty = true;
 		});
 	}
 
+	void LightsManagerTask::FillPointLight(PointLight& light, const PointLightComponent* pointLight)
+	{
+		const bool bCastsShadows = pointLight->DoesCastShadows();
+		const bool bVolumetric = pointLight->IsVolumetricLight();
+
+		light.Position = pointLight->GetWorldTransform().Location;
+		const float radius = pointLight->GetRadius();
+		light.Radius2 = radius * radius;
+		light.LightColor = pointLight->GetLightColor() * pointLight->GetIntensity();
+		light.VolumetricFogIntensity = glm::max(pointLight->GetVolumetricFogIntensity(), 0.0f);
+
+		uint32_t* intensity = (uint32_t*)&light.VolumetricFogIntensity;
+		*intensity = (*intensity) | (bVolumetric ? 0x80000000 : 0u);
+
+		uint32_t* radius2 = (uint32_t*)&light.Radius2;
+		*radius2 = (*radius2) | (bCastsShadows ? 0x80000000 : 0u);
+	}
+
+	void LightsManagerTask::FillSpotLight(SpotLight& light, const SpotLightComponent* spotLight)
+	{
+		const float innerAngle = glm::clamp(spotLight->GetInnerCutOffAngle(), 1.f, 80.f);
+		const float outerAngle = glm::clamp(spotLight->GetOuterCutOffAngle(), 1.f, 80.f);
+
+		light.Position = spotLight->GetWorldTransform().Location;
+		light.LightColor = spotLight->GetLightColor() * spotLight->GetIntensity();
+		light.Direction = spotLight->GetForwardVector();
+		light.InnerCutOffRadians = glm::radians(innerAngle);
+		light.OuterCutOffRadians = glm::radians(outerAngle);
+		light.VolumetricFogIntensity = glm::max(spotLight->GetVolumetricFogIntensity(), 0.0f);
+		const float distance = spotLight->GetDistance();
+		light.Distance2  = distance * distance;
+		light.ViewProj[0] = glm::vec4(spotLight->GetUpVector(), 0.f); // Temporary storing up vector
+		light.bCastsShadows = uint32_t(spotLight->DoesCastShadows());
+		light.bVolumetricLight = uint32_t(spotLight->IsVolumetricLight());
+	}
+
+	void LightsManagerTask::UpdateViewProj(PointLight& light)
+	{
+		for (int i = 0; i < 6; ++i)
+			light.ViewProj[i] = s_PointLightPerspectiveProjection * glm::lookAt(light.Position, light.Position + s_Directions[i], s_UpVectors[i]);
+	}
+
+	void LightsManagerTask::UpdateViewProj(SpotLight& light)
+	{
+		const float cutoff = light.OuterCutOffRadians * 2.f;
+		glm::mat4 spotLightPerspectiveProjection = glm::perspective(cutoff, 1.f, 0.01f, 50.f);
+		spotLightPerspectiveProjection[1][1] *= -1.f;
+		const glm::vec3 upVector = light.ViewProj[0];
+		light.ViewProj = spotLightPerspectiveProjection * glm::lookAt(light.Position, light.Position + light.Direction, upVector);
+	}
+
 	void LightsManagerTask::SetDirectionalLight(const DirectionalLightComponent* directionalLightComponent)
 	{
 		if (directionalLightComponent != nullptr)
@@ -225,6 +357,8 @@ namespace Eagle
 			}
 			bPointLightsDirty = false;
 		}
+		else if (!m_PointLightsToUpload.empty())
+			UploadChangedLights(cmd, m_PointLightsBuffer, m_PointLights, m_PointLightsToUpload);
 
 		if (bSpotLightsDirty)
 		{
@@ -239,6 +373,8 @@ namespace Eagle
 			}
 			bSpotLightsDirty = false;
 		}
+		else if (!m_SpotLightsToUpload.empty())
+			UploadChangedLights(cmd, m_SpotLightsBuffer, m_SpotLights, m_SpotLightsToUpload);
 
 		cmd->Write(m_DirectionalLightBuffer, &m_DirectionalLight, sizeof(DirectionalLight), 0, BufferLayoutType::Unknown, BufferLayoutType::StorageBuffer);
 		cmd->StorageBufferBarrier(m_DirectionalLightBuffer);
@@ -68,6 +68,10 @@ namespace Eagle
 
 		void SetPointLights(const std::vector<const PointLightComponent*>& pointLights, bool bDirty);
 		void SetSpotLights(const std::vector<const SpotLightComponent*>& spotLights, bool bDirty);
+
+		// Only `lights` are updated and uploaded. They must have been a part of the last `SetPointLights`/`SetSpotLights` call
+		void UpdatePointLights(const std::vector<const PointLightComponent*>& pointLights);
+		void UpdateSpotLights(const std::vector<const SpotLightComponent*>& spotLights);
 		void SetDirectionalLight(const DirectionalLightComponent* directionalLightComponent);
 
 		void RecordCommandBuffer(const Ref<CommandBuffer>& cmd) override;
@@ -85,11 +89,22 @@ namespace Eagle
 	private:
 		void UploadLightBuffers(const Ref<CommandBuffer>& cmd);
 
+		// Fill the data that's known on the main thread. View projections are calculated by the render thread
+		static void FillPointLight(PointLight& light, const PointLightComponent* pointLight);
+		static void FillSpotLight(SpotLight& light, const SpotLightComponent* spotLight);
+		static void UpdateViewProj(PointLight& light);
+		static void UpdateViewProj(SpotLight& light);
+
 	private:
 		std::vector<PointLight> m_PointLights;
 		std::vector<SpotLight> m_SpotLights;
 		DirectionalLight m_DirectionalLight{};
 
+		std::unordered_map<uint32_t, uint32_t> m_PointLightIndices; // EntityID -> index in m_PointLights
+		std::unordered_map<uint32_t, uint32_t> m_SpotLightIndices; // EntityID -> index in m_SpotLights
+		std::vector<uint32_t> m_PointLightsToUpload; // Indices of lights that have changed since the last upload
+		std::vector<uint32_t> m_SpotLightsToUpload;
+
 		Ref<Buffer> m_PointLightsBuffer;
 		Ref<Buffer> m_SpotLightsBuffer;
 		Ref<Buffer> m_DirectionalLightBuffer;
@@ -128,7 +128,8 @@ namespace Eagle
 
 		constexpr uint32_t tileSize = 8;
 		const glm::uvec2 size = m_ResultImage->GetSize();
-		glm::uvec2 numGroups = { glm::ceil(size.x / float(tileSize)), glm::ceil(size.y / float(tileSize)) };
+		const glm::uvec2 renderSize = m_Renderer.GetRenderSize(); // Only this part is used if dynamic resolution is enabled
+		glm::uvec2 numGroups = { glm::ceil(renderSize.x / float(tileSize)), glm::ceil(renderSize.y / float(tileSize)) };
 		pushData.Size = size;
 
 		cmd->TransitionLayout(m_ResultImage, m_ResultImage->GetLayout(), ImageLayoutType::StorageImage);
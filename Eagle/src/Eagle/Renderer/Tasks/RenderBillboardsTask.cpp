@@ -15,46 +15,39 @@
 
 namespace Eagle
 {
-	static constexpr glm::vec4 s_QuadVertexPosition[4] = { { -0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, 0.5f, 0.0f, 1.0f }, { -0.5f, 0.5f, 0.0f, 1.0f } };
-
 	RenderBillboardsTask::RenderBillboardsTask(SceneRenderer& renderer, const Ref<Image>& renderTo)
 		: RendererTask(renderer)
 		, m_ResultImage(renderTo)
 	{
-		BufferSpecifications vertexSpecs;
-		vertexSpecs.Size = s_BaseBillboardVertexBufferSize;
-		vertexSpecs.Layout = BufferReadAccess::Vertex;
-		vertexSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
+		BufferSpecifications instanceSpecs;
+		instanceSpecs.Size = s_BaseBillboardInstanceBufferSize;
+		instanceSpecs.Layout = BufferReadAccess::Vertex;
+		instanceSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
 
-		BufferSpecifications indexSpecs;
-		indexSpecs.Size = s_BaseBillboardIndexBufferSize;
-		indexSpecs.Layout = BufferReadAccess::Index;
-		indexSpecs.Usage = BufferUsage::IndexBuffer | BufferUsage::TransferDst;
+		BufferSpecifications cameraSpecs;
+		cameraSpecs.Size = sizeof(CameraData);
+		cameraSpecs.Layout = BufferReadAccess::Uniform;
+		cameraSpecs.Usage = BufferUsage::UniformBuffer | BufferUsage::TransferDst;
 
-		m_VertexBuffer = Buffer::Create(vertexSpecs, "Billboard_VertexBuffer");
-		m_IndexBuffer = Buffer::Create(indexSpecs, "Billboard_IndexBuffer");
-		m_Vertices.reserve(s_DefaultBillboardVerticesCount);
+		m_InstanceBuffer = Buffer::Create(instanceSpecs, "Billboard_InstanceBuffer");
+		m_CameraBuffer = Buffer::Create(cameraSpecs, "Billboard_CameraBuffer");
+		m_Instances.reserve(s_DefaultBillboardQuadCount);
 
 		InitPipeline();
 		InitWithOptions(m_Renderer.GetOptions());
-
-		RenderManager::Submit([this](Ref<CommandBuffer>& cmd)
-		{
-			UpdateIndexBuffer(cmd);
-		});
 	}
 
 	void RenderBillboardsTask::RecordCommandBuffer(const Ref<CommandBuffer>& cmd)
 	{
-		if (m_BillboardsData.empty())
+		if (m_Instances.empty())
 			return;
 
 		EG_GPU_TIMING_SCOPED(cmd, "Billboards");
 		EG_CPU_TIMING_SCOPED("Billboards");
 
-		ProcessBillboardsData();
 		UpdateBuffers(cmd);
 		RenderBillboards(cmd);
+		ResetMovedInstances();
 	}
 
 	void RenderBillboardsTask::UpdateBuffers(const Ref<CommandBuffer>& cmd)
@@ -62,54 +55,36 @@ namespace Eagle
 		EG_GPU_TIMING_SCOPED(cmd, "Upload billboards buffers");
 		EG_CPU_TIMING_SCOPED("Upload billboards buffers");
 
-		// Reserving enough space to hold Vertex & Index data
-		const size_t currentVertexSize = m_Vertices.size() * sizeof(BillboardVertex);
-		const size_t currentIndexSize = (m_Vertices.size() / 4) * (sizeof(Index) * 6);
-
-		auto& vb = m_VertexBuffer;
-		auto& ib = m_IndexBuffer;
-
-		if (currentVertexSize > vb->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, vb->GetSize() * 3 / 2);
-			const size_t alignment = 4 * sizeof(BillboardVertex);
-			newSize += alignment - (newSize % alignment);
-			vb->Resize(newSize);
-		}
-		if (currentIndexSize > ib->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, ib->GetSize() * 3 / 2);
-			const size_t alignment = 6 * sizeof(Index);
-			newSize += alignment - (newSize % alignment);
-
-			ib->Resize(newSize);
-			UpdateIndexBuffer(cmd);
-		}
-
-		cmd->Write(vb, m_Vertices.data(), currentVertexSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
-		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
-	}
-
-	void RenderBillboardsTask::UpdateIndexBuffer(const Ref<CommandBuffer>& cmd)
-	{
-		const size_t& ibSize = m_IndexBuffer->GetSize();
-		uint32_t offset = 0;
-		std::vector<Index> indices(ibSize / sizeof(Index));
-		for (size_t i = 0; i < indices.size(); i += 6)
+		// Instances are in world space, so camera movement only requires updating the camera data
+		CameraData cameraData;
+		cameraData.View = m_Renderer.GetViewMatrix();
+		cameraData.Proj = m_Renderer.GetProjectionMatrix();
+		cameraData.PrevView = m_Renderer.GetPrevViewMatrix();
+		cameraData.PrevProj = m_Renderer.GetPrevProjectionMatrix();
+		cmd->Write(m_CameraBuffer, &cameraData, sizeof(CameraData), 0, BufferLayoutType::Unknown, BufferReadAccess::Uniform);
+		cmd->TransitionLayout(m_CameraBuffer, BufferReadAccess::Uniform, BufferReadAccess::Uniform);
+
+		const size_t instancesCount = m_Instances.size();
+		m_UploadEnd = glm::min(m_UploadEnd, instancesCount);
+		if (m_UploadBegin < m_UploadEnd)
 		{
-			indices[i + 0] = offset + 0;
-			indices[i + 1] = offset + 1;
-			indices[i + 2] = offset + 2;
-
-			indices[i + 3] = offset + 2;
-			indices[i + 4] = offset + 3;
-			indices[i + 5] = offset + 0;
+			auto& buffer = m_InstanceBuffer;
+			const size_t currentSize = instancesCount * sizeof(BillboardInstance);
+			if (currentSize > buffer->GetSize())
+			{
+				// Resizing discards the content, so everything needs to be uploaded
+				buffer->Resize(glm::max(currentSize, buffer->GetSize() * 3 / 2));
+				m_UploadBegin = 0;
+				m_UploadEnd = instancesCount;
+			}
 
-			offset += 4;
+			const size_t offset = m_UploadBegin * sizeof(BillboardInstance);
+			const size_t size = (m_UploadEnd - m_UploadBegin) * sizeof(BillboardInstance);
+			cmd->Write(buffer, &m_Instances[m_UploadBegin], size, offset, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(buffer, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
 		}
-
-		cmd->Write(m_IndexBuffer, indices.data(), ibSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Index);
-		cmd->TransitionLayout(m_IndexBuffer, BufferReadAccess::Index, BufferReadAccess::Index);
+		m_UploadBegin = SIZE_MAX;
+		m_UploadEnd = 0;
 	}
 
 	void RenderBillboardsTask::RenderBillboards(const Ref<CommandBuffer>& cmd)
@@ -126,26 +101,17 @@ namespace Eagle
 		}
 		if (bJitter)
 			m_Pipeline->SetBuffer(m_Renderer.GetJitter(), 1, 0);
+		m_Pipeline->SetBuffer(m_CameraBuffer, 1, 1);
 
-		const uint32_t quadsCount = (uint32_t)(m_Vertices.size() / 4);
+		const uint32_t quadsCount = (uint32_t)m_Instances.size();
 
 		auto& stats = m_Renderer.GetStats2D();
 		stats.QuadCount += quadsCount;
 		++stats.DrawCalls;
 
-		struct PushData
-		{
-			glm::mat4 Proj;
-			glm::mat4 PrevProj;
-		} pushData;
-		pushData.Proj = m_Renderer.GetProjectionMatrix();
-		if (bMotionRequired)
-			pushData.PrevProj = m_Renderer.GetPrevProjectionMatrix();
-
-		const float& gamma = m_Renderer.GetOptions_RT().Gamma;
 		cmd->BeginGraphics(m_Pipeline);
-		cmd->SetGraphicsRootConstants(&pushData, nullptr);
-		cmd->DrawIndexed(m_VertexBuffer, m_IndexBuffer, quadsCount * 6, 0, 0);
+		cmd->DrawIndexedInstanced(RenderManager::GetUnitQuadVertexBuffer(), RenderManager::GetUnitQuadIndexBuffer(), RenderManager::UnitQuadIndexCount, 0, 0,
+			quadsCount, 0, m_InstanceBuffer);
 		cmd->EndGraphics();
 	}
 
@@ -160,79 +126,149 @@ namespace Eagle
 		InitPipeline();
 	}
 
-	void RenderBillboardsTask::ProcessBillboardsData()
+	void RenderBillboardsTask::ReplaceInstances(size_t begin, size_t end, std::vector<BillboardInstance>&& instances)
 	{
-		std::vector<BillboardVertex> oldVertices = std::move(m_Vertices);
-		m_Vertices.clear();
-		m_Vertices.reserve(m_BillboardsData.size() * 4);
+		std::unordered_map<int, size_t> oldIndices;
+		oldIndices.reserve(end - begin);
+		for (size_t i = begin; i < end; ++i)
+			oldIndices.emplace(m_Instances[i].EntityID, i);
 
-		size_t oldVertexIndex = 0;
-		for (auto& billboard : m_BillboardsData)
+		for (auto& instance : instances)
 		{
-			const Transform& worldTransform = billboard.WorldTransform;
-			const glm::mat4 transform = Math::ToTransformMatrix(worldTransform);
-			
-			const auto& viewMatrix = m_Renderer.GetViewMatrix();
-			glm::mat4 modelView = viewMatrix * transform;
-			// Remove rotation, apply scaling
-			modelView[0] = glm::vec4(worldTransform.Scale3D.x, 0, 0, 0);
-			modelView[1] = glm::vec4(0, worldTransform.Scale3D.y, 0, 0);
-			modelView[2] = glm::vec4(0, 0, worldTransform.Scale3D.z, 0);
-			
-			for (int i = 0; i < 4; ++i)
+			auto it = oldIndices.find(instance.EntityID);
+			if (it != oldIndices.end())
+			{
+				const auto& oldInstance = m_Instances[it->second];
+				instance.PrevPosition = oldInstance.Position;
+				instance.PrevScale = oldInstance.Scale;
+			}
+			else
 			{
-				auto& vertex = m_Vertices.emplace_back();
-			
-				vertex.Position = modelView * s_QuadVertexPosition[i];
-				vertex.TextureIndex = billboard.TextureIndex;
-				vertex.EntityID = billboard.EntityID;
-
-				if (oldVertexIndex < oldVertices.size())
-					vertex.PrevPosition = oldVertices[oldVertexIndex].Position;
-				else
-					vertex.PrevPosition = vertex.Position;
-
-				++oldVertexIndex;
+				instance.PrevPosition = instance.Position;
+				instance.PrevScale = instance.Scale;
 			}
 		}
-		m_BillboardsData.clear();
+
+		m_Instances.erase(m_Instances.begin() + begin, m_Instances.begin() + end);
+		m_Instances.insert(m_Instances.begin() + begin, std::make_move_iterator(instances.begin()), std::make_move_iterator(instances.end()));
+
+		// Indices might have shifted, so moved instances are collected again
+		m_MovedInstances.clear();
+		const size_t instancesCount = m_Instances.size();
+		for (size_t i = 0; i < instancesCount; ++i)
+		{
+			const auto& instance = m_Instances[i];
+			if (instance.PrevPosition != instance.Position || instance.PrevScale != instance.Scale)
+				m_MovedInstances.push_back((uint32_t)i);
+		}
+
+		MarkDirty(begin, instancesCount);
 	}
 
-	void RenderBillboardsTask::SetBillboards(const std::vector<const BillboardComponent*>& billboards)
+	void RenderBillboardsTask::ResetMovedInstances()
 	{
+		for (uint32_t index : m_MovedInstances)
+		{
+			auto& instance = m_Instances[index];
+			instance.PrevPosition = instance.Position;
+			instance.PrevScale = instance.Scale;
+			MarkDirty(index, index + 1);
+		}
+		m_MovedInstances.clear();
+	}
+
+	void RenderBillboardsTask::SetBillboards(const std::vector<const BillboardComponent*>& billboards, bool bDirty)
+	{
+		if (!bDirty)
+			return;
+
 		EG_CPU_TIMING_SCOPED("Renderer. Set Billboards");
 
-		std::vector<BillboardData> tempData;
-		tempData.reserve(billboards.size());
+		std::vector<BillboardInstance> instances;
+		instances.reserve(billboards.size());
 		for (auto& billboard : billboards)
 		{
-			if (!billboard->Texture)
+			const auto& texture = billboard->GetTexture();
+			if (!texture)
 				continue;
 
-			auto& data = tempData.emplace_back();
-			data.WorldTransform = billboard->GetWorldTransform();
-			data.TextureIndex = TextureSystem::AddTexture(billboard->Texture);
-			data.EntityID = billboard->Parent.GetID();
+			const Transform& worldTransform = billboard->GetWorldTransform();
+			auto& instance = instances.emplace_back();
+			instance.Position = worldTransform.Location;
+			instance.Scale = glm::vec2(worldTransform.Scale3D);
+			instance.TextureIndex = TextureSystem::AddTexture(texture);
+			instance.EntityID = (int)billboard->Parent.GetID();
 		}
 
-		RenderManager::Submit([this, billboards = std::move(tempData)](Ref<CommandBuffer>& cmd) mutable
+		RenderManager::Submit([this, instances = std::move(instances)](Ref<CommandBuffer>& cmd) mutable
+		{
+			const size_t componentsCount = instances.size();
+			ReplaceInstances(0, m_ComponentsCount, std::move(instances));
+			m_ComponentsCount = componentsCount;
+
+			m_ComponentInstances.clear();
+			m_ComponentInstances.reserve(componentsCount);
+			for (size_t i = 0; i < componentsCount; ++i)
+				m_ComponentInstances.emplace((uint32_t)m_Instances[i].EntityID, (uint32_t)i);
+		});
+	}
+
+	void RenderBillboardsTask::SetTransforms(const std::vector<const BillboardComponent*>& billboards)
+	{
+		EG_CPU_TIMING_SCOPED("Renderer. Set Billboards Transforms");
+
+		struct TransformData
 		{
-			m_BillboardsData.reserve(billboards.size());
+			glm::vec3 Location;
+			glm::vec2 Scale;
+			uint32_t EntityID;
+		};
 
-			for (auto& billboard : billboards)
-				m_BillboardsData.emplace_back(std::move(billboard));
+		std::vector<TransformData> transforms;
+		transforms.reserve(billboards.size());
+		for (auto& billboard : billboards)
+		{
+			const Transform& worldTransform = billboard->GetWorldTransform();
+			transforms.push_back({ worldTransform.Location, glm::vec2(worldTransform.Scale3D), billboard->Parent.GetID() });
+		}
+
+		RenderManager::Submit([this, transforms = std::move(transforms)](Ref<CommandBuffer>& cmd)
+		{
+			for (auto& transform : transforms)
+			{
+				auto it = m_ComponentInstances.find(transform.EntityID);
+				if (it == m_ComponentInstances.end())
+					continue; // Billboard without a texture
+
+				const uint32_t index = it->second;
+				auto& instance = m_Instances[index];
+				instance.Position = transform.Location;
+				instance.Scale = transform.Scale;
+				m_MovedInstances.push_back(index);
+				MarkDirty(index, index + 1);
+			}
 		});
 	}
 
-	void RenderBillboardsTask::AddAdditionalBillboard(const Transform& worldTransform, const Ref<Texture2D>& texture, int entityID)
+	void RenderBillboardsTask::SetAdditionalBillboards(std::vector<AdditionalBillboard>&& billboards)
 	{
-		if (!texture)
-			return;
+		std::vector<BillboardInstance> instances;
+		instances.reserve(billboards.size());
+		for (auto& billboard : billboards)
+		{
+			if (!billboard.Texture)
+				continue;
+
+			auto& instance = instances.emplace_back();
+			instance.Position = billboard.WorldTransform.Location;
+			instance.Scale = glm::vec2(billboard.WorldTransform.Scale3D);
+			instance.TextureIndex = TextureSystem::AddTexture(billboard.Texture);
+			instance.EntityID = billboard.EntityID;
+		}
 
-		const uint32_t textureIndex = TextureSystem::AddTexture(texture);
-		RenderManager::Submit([this, worldTransform, textureIndex, entityID](Ref<CommandBuffer>& cmd)
+		RenderManager::Submit([this, instances = std::move(instances)](Ref<CommandBuffer>& cmd) mutable
 		{
-			m_BillboardsData.emplace_back(worldTransform, textureIndex, entityID);
+			ReplaceInstances(m_ComponentsCount, m_Instances.size(), std::move(instances));
 		});
 	}
 	
@@ -294,6 +330,7 @@ namespace Eagle
 		}
 
 		state.DepthStencilAttachment = depthAttachment;
+		state.PerInstanceAttribs = PerInstanceAttribs;
 		state.CullMode = CullMode::Back;
 
 		if (m_Pipeline)
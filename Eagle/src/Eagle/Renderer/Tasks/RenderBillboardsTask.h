@@ -23,41 +23,68 @@ namespace Eagle
 
 		void InitWithOptions(const SceneRendererSettings& settings) override;
 
-		void SetBillboards(const std::vector<const BillboardComponent*>& billboards);
-		void AddAdditionalBillboard(const Transform& worldTransform, const Ref<Texture2D>& texture, int entityID = -1);
+		// If 'bDirty' is false, passed data is ignored and last state is used to render
+		void SetBillboards(const std::vector<const BillboardComponent*>& billboards, bool bDirty);
 
-	private:
-		struct BillboardVertex
+		// Updates transforms of billboards that were already set
+		void SetTransforms(const std::vector<const BillboardComponent*>& billboards);
+
+		struct AdditionalBillboard
 		{
-			glm::vec3 Position = glm::vec3{ 0.f };
-			glm::vec3 PrevPosition = glm::vec3{ 0.f };
-			uint32_t TextureIndex = 0;
+			Transform WorldTransform;
+			Ref<Texture2D> Texture;
 			int EntityID = -1;
 		};
+		// Replaces engine billboards (light icons, etc). They're kept until the next call
+		void SetAdditionalBillboards(std::vector<AdditionalBillboard>&& billboards);
 
-		struct BillboardData
+	private:
+		// Per-instance data. Quad vertices are generated in the vertex shader from the unit quad
+		struct BillboardInstance
 		{
-			Transform WorldTransform;
+			glm::vec3 Position = glm::vec3{ 0.f }; // World space
+			glm::vec2 Scale = glm::vec2{ 1.f };
+			glm::vec3 PrevPosition = glm::vec3{ 0.f };
+			glm::vec2 PrevScale = glm::vec2{ 1.f };
 			uint32_t TextureIndex = 0;
 			int EntityID = -1;
+		};
 
-			BillboardData() = default;
-
-			BillboardData(const Transform& transform, uint32_t textureIndex, int entityID)
-				: WorldTransform(transform), TextureIndex(textureIndex), EntityID(entityID) {}
+		struct CameraData
+		{
+			glm::mat4 View;
+			glm::mat4 Proj;
+			glm::mat4 PrevView;
+			glm::mat4 PrevProj;
 		};
 
 		void InitPipeline();
 		void UpdateBuffers(const Ref<CommandBuffer>& cmd);
-		void UpdateIndexBuffer(const Ref<CommandBuffer>& cmd);
 		void RenderBillboards(const Ref<CommandBuffer>& cmd);
-		void ProcessBillboardsData();
+
+		// Replaces [begin; end) range of `m_Instances` with `instances`.
+		// Previous positions are taken from the replaced instances of the same entities to keep the motion
+		void ReplaceInstances(size_t begin, size_t end, std::vector<BillboardInstance>&& instances);
+
+		// After instances were uploaded, their previous positions are set to the current ones for the next frame
+		void ResetMovedInstances();
+
+		void MarkDirty(size_t begin, size_t end)
+		{
+			m_UploadBegin = glm::min(m_UploadBegin, begin);
+			m_UploadEnd = glm::max(m_UploadEnd, end);
+		}
 
 	private:
-		std::vector<BillboardData> m_BillboardsData; // Data to build VertexBuffer from
-		std::vector<BillboardVertex> m_Vertices;
-		Ref<Buffer> m_VertexBuffer;
-		Ref<Buffer> m_IndexBuffer;
+		std::vector<BillboardInstance> m_Instances; // Billboards of components followed by additional billboards
+		std::unordered_map<uint32_t, uint32_t> m_ComponentInstances; // Entity ID -> Index into `m_Instances`
+		std::vector<uint32_t> m_MovedInstances; // Instances whose previous position differs from the current one
+		size_t m_ComponentsCount = 0;
+		size_t m_UploadBegin = SIZE_MAX; // Range of `m_Instances` that needs to be uploaded
+		size_t m_UploadEnd = 0;
+
+		Ref<Buffer> m_InstanceBuffer;
+		Ref<Buffer> m_CameraBuffer;
 		Ref<Image> m_ResultImage;
 		Ref<PipelineGraphics> m_Pipeline;
 		uint64_t m_TexturesUpdatedFrames[RendererConfig::FramesInFlight] = { 0 };
@@ -65,9 +92,9 @@ namespace Eagle
 		bool bMotionRequired = false;
 
 		static constexpr size_t s_DefaultBillboardQuadCount = 10; // How much quads we can render without reallocating
-		static constexpr size_t s_DefaultBillboardVerticesCount = s_DefaultBillboardQuadCount * 4;
+		static constexpr size_t s_BaseBillboardInstanceBufferSize = s_DefaultBillboardQuadCount * sizeof(BillboardInstance);
 
-		static constexpr size_t s_BaseBillboardVertexBufferSize = s_DefaultBillboardVerticesCount * sizeof(BillboardVertex);
-		static constexpr size_t s_BaseBillboardIndexBufferSize  = s_DefaultBillboardQuadCount * (sizeof(Index) * 6);
+	public:
+		inline static const std::vector<PipelineGraphicsState::VertexInputAttribute> PerInstanceAttribs = { {1u}, {2u}, {3u}, {4u}, {5u}, {6u} }; // Locations of Per-Instance data in shader
 	};
 }
@@ -12,62 +12,22 @@
 
 namespace Eagle
 {
-	static constexpr glm::vec4 s_QuadVertexPosition[4] = {
-		{ 0.f, 0.f, 0.0f, 1.0f },
-		{ 1.f, 0.f, 0.0f, 1.0f },
-		{ 1.f, 1.f, 0.0f, 1.0f },
-		{ 0.f, 1.f, 0.0f, 1.0f }
-	};
-
-	static void UploadIndexBuffer(const Ref<CommandBuffer>& cmd, Ref<Buffer>& buffer)
-	{
-		const size_t& ibSize = buffer->GetSize();
-		uint32_t offset = 0;
-		std::vector<Index> indices(ibSize / sizeof(Index));
-		for (size_t i = 0; i < indices.size(); i += 6)
-		{
-			indices[i + 0] = offset + 0;
-			indices[i + 1] = offset + 1;
-			indices[i + 2] = offset + 2;
-
-			indices[i + 3] = offset + 2;
-			indices[i + 4] = offset + 3;
-			indices[i + 5] = offset + 0;
-
-			offset += 4;
-		}
-
-		cmd->Write(buffer, indices.data(), ibSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Index);
-		cmd->TransitionLayout(buffer, BufferReadAccess::Index, BufferReadAccess::Index);
-	}
-
 	RenderImages2DTask::RenderImages2DTask(SceneRenderer& renderer)
 		: RendererTask(renderer)
 	{
 		InitPipeline();
 
-		BufferSpecifications vertexSpecs;
-		vertexSpecs.Size = s_BaseVertexBufferSize;
-		vertexSpecs.Layout = BufferReadAccess::Vertex;
-		vertexSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
-
-		BufferSpecifications indexSpecs;
-		indexSpecs.Size = s_BaseIndexBufferSize;
-		indexSpecs.Layout = BufferReadAccess::Index;
-		indexSpecs.Usage = BufferUsage::IndexBuffer | BufferUsage::TransferDst;
+		BufferSpecifications instanceSpecs;
+		instanceSpecs.Size = s_BaseInstanceBufferSize;
+		instanceSpecs.Layout = BufferReadAccess::Vertex;
+		instanceSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
 
-		m_VertexBuffer = Buffer::Create(vertexSpecs, "Images2D_VertexBuffer");
-		m_IndexBuffer = Buffer::Create(indexSpecs, "Images2D_IndexBuffer");
-
-		RenderManager::Submit([this](Ref<CommandBuffer>& cmd)
-		{
-			UploadIndexBuffer(cmd, m_IndexBuffer);
-		});
+		m_InstanceBuffer = Buffer::Create(instanceSpecs, "Images2D_InstanceBuffer");
 	}
 	
 	void RenderImages2DTask::RecordCommandBuffer(const Ref<CommandBuffer>& cmd)
 	{
-		if (m_Quads.empty())
+		if (m_Instances.empty())
 			return;
 
 		EG_GPU_TIMING_SCOPED(cmd, "Images 2D");
@@ -86,34 +46,13 @@ namespace Eagle
 		EG_GPU_TIMING_SCOPED(cmd, "Upload Images 2D");
 		EG_CPU_TIMING_SCOPED("Upload Images 2D");
 
-		auto& vb = m_VertexBuffer;
-		auto& ib = m_IndexBuffer;
-		auto& quads = m_Quads;
+		auto& buffer = m_InstanceBuffer;
+		const size_t currentSize = m_Instances.size() * sizeof(ImageInstance);
+		if (currentSize > buffer->GetSize())
+			buffer->Resize(glm::max(currentSize, buffer->GetSize() * 3 / 2));
 
-		// Reserving enough space to hold Vertex & Index data
-		const size_t currentVertexSize = quads.size() * sizeof(QuadVertex);
-		const size_t currentIndexSize = (quads.size() / 4) * (sizeof(Index) * 6);
-
-		if (currentVertexSize > vb->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, vb->GetSize() * 3 / 2);
-			constexpr size_t alignment = 4 * sizeof(QuadVertex);
-			newSize += alignment - (newSize % alignment);
-
-			vb->Resize(newSize);
-		}
-		if (currentIndexSize > ib->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, ib->GetSize() * 3 / 2);
-			constexpr size_t alignment = 6 * sizeof(Index);
-			newSize += alignment - (newSize % alignment);
-
-			ib->Resize(newSize);
-			UploadIndexBuffer(cmd, ib);
-		}
-
-		cmd->Write(vb, quads.data(), currentVertexSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
-		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		cmd->Write(buffer, m_Instances.data(), currentSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+		cmd->TransitionLayout(buffer, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
 	}
 
 	void RenderImages2DTask::Render(const Ref<CommandBuffer>& cmd)
@@ -126,9 +65,10 @@ namespace Eagle
 		auto& pipeline = (m_Renderer.IsRuntime() && !bObjectPickingEnabled) ? m_PipelineNoEntityID : m_Pipeline;
 		pipeline->SetTextureArray(m_Textures, 0, 0);
 
-		const uint32_t quadsCount = (uint32_t)(m_Quads.size() / 4);
+		const uint32_t quadsCount = (uint32_t)m_Instances.size();
 		cmd->BeginGraphics(pipeline);
-		cmd->DrawIndexed(m_VertexBuffer, m_IndexBuffer, quadsCount * 6, 0, 0);
+		cmd->DrawIndexedInstanced(RenderManager::GetUnitQuadVertexBuffer(), RenderManager::GetUnitQuadIndexBuffer(), RenderManager::UnitQuadIndexCount, 0, 0,
+			quadsCount, 0, m_InstanceBuffer);
 		cmd->EndGraphics();
 
 		auto& stats = m_Renderer.GetStats2D();
@@ -167,28 +107,18 @@ namespace Eagle
 			else
 				textureIndex = it->second;
 
-			{
-				const glm::mat4 rotate = glm::rotate(glm::mat4(1.0f), glm::radians(component.Rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-				const glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), glm::vec3(component.Scale, 1.f));
-				const glm::mat4 transform = scaleMat * rotate;
-
-				constexpr glm::vec4 s_TexCoords[4] = {
-					glm::vec4(0.f, 1.f, 0.f, 1.f),
-					glm::vec4(1.f, 1.f, 0.f, 1.f),
-					glm::vec4(1.f, 0.f, 0.f, 1.f),
-					glm::vec4(0.f, 0.f, 0.f, 1.f)
-				};
-
-				for (int i = 0; i < 4; ++i)
-				{
-					auto& q1 = m_Quads.emplace_back();
-					q1.Tint = component.Tint;
-					q1.TextureIndex = textureIndex;
-					q1.Position = glm::vec2(transform * s_TexCoords[i]) + component.Pos;
-					q1.EntityID = component.EntityID;
-					q1.Opacity = component.Opacity;
-				}
-			}
+			const glm::mat4 rotate = glm::rotate(glm::mat4(1.0f), glm::radians(component.Rotation), glm::vec3(0.0f, 0.0f, 1.0f));
+			const glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), glm::vec3(component.Scale, 1.f));
+			const glm::mat4 transform = scaleMat * rotate;
+
+			auto& instance = m_Instances.emplace_back();
+			instance.Position = component.Pos;
+			instance.AxisX = glm::vec2(transform[0]);
+			instance.AxisY = glm::vec2(transform[1]);
+			instance.Tint = component.Tint;
+			instance.TextureIndex = textureIndex;
+			instance.EntityID = component.EntityID;
+			instance.Opacity = component.Opacity;
 		}
 
 		return textureCurrentIndex;
@@ -221,7 +151,7 @@ namespace Eagle
 		RenderManager::Submit([components = std::move(datas), this](const Ref<CommandBuffer>&)
 		{
 			bUpdate = true;
-			m_Quads.clear();
+			m_Instances.clear();
 			m_Textures.clear();
 			m_TexturesMap.clear();
 
@@ -260,6 +190,7 @@ namespace Eagle
 		state.VertexShader = Shader::Create("assets/shaders/image2D.vert", ShaderType::Vertex, noObjectIDDefine);
 		state.FragmentShader = Shader::Create("assets/shaders/image2D.frag", ShaderType::Fragment, noObjectIDDefine);
 		state.ColorAttachments.push_back(colorAttachment);
+		state.PerInstanceAttribs = PerInstanceAttribs;
 		state.CullMode = CullMode::Back;
 
 		if (m_PipelineNoEntityID)
@@ -23,11 +23,14 @@ namespace Eagle
 		void SetImages(const std::vector<const Image2DComponent*>& images, bool bDirty);
 
 	private:
-		struct QuadVertex
+		// Per-instance data. Quad vertices are generated in the vertex shader from the unit quad
+		struct ImageInstance
 		{
+			glm::vec2 Position;
+			glm::vec2 AxisX;
+			glm::vec2 AxisY;
 			glm::vec3 Tint;
 			uint32_t TextureIndex;
-			glm::vec2 Position;
 			int EntityID;
 			float Opacity;
 		};
@@ -51,19 +54,18 @@ namespace Eagle
 	private:
 		Ref<PipelineGraphics> m_Pipeline;
 		Ref<PipelineGraphics> m_PipelineNoEntityID;
-		Ref<Buffer> m_VertexBuffer;
-		Ref<Buffer> m_IndexBuffer;
+		Ref<Buffer> m_InstanceBuffer;
 
-		std::vector<QuadVertex> m_Quads;
+		std::vector<ImageInstance> m_Instances;
 		std::unordered_map<Ref<Texture2D>, uint32_t> m_TexturesMap;
 		std::vector<Ref<Texture2D>> m_Textures;
 
 		bool bUpdate = true;
 
 		static constexpr size_t s_DefaultQuadCount = 64; // How much quads we can render without reallocating
-		static constexpr size_t s_DefaultVerticesCount = s_DefaultQuadCount * 4;
+		static constexpr size_t s_BaseInstanceBufferSize = s_DefaultQuadCount * sizeof(ImageInstance);
 
-		static constexpr size_t s_BaseVertexBufferSize = s_DefaultVerticesCount * sizeof(QuadVertex);
-		static constexpr size_t s_BaseIndexBufferSize = s_DefaultQuadCount * (sizeof(Index) * 6);
+	public:
+		inline static const std::vector<PipelineGraphicsState::VertexInputAttribute> PerInstanceAttribs = { {1u}, {2u}, {3u}, {4u}, {5u}, {6u}, {7u} }; // Locations of Per-Instance data in shader
 	};
 }
@@ -25,18 +25,36 @@ namespace Eagle
 
 		m_VertexBuffer = Buffer::Create(linesVertexSpecs, "LinesVertexBuffer");
 		m_Vertices.reserve(s_DefaultLinesVerticesCount);
+
+		BufferSpecifications shapesInstanceSpecs;
+		shapesInstanceSpecs.Size = s_BaseShapesInstanceBufferSize;
+		shapesInstanceSpecs.Layout = BufferReadAccess::Vertex;
+		shapesInstanceSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
+
+		m_ShapesInstanceBuffer = Buffer::Create(shapesInstanceSpecs, "DebugShapes_InstanceBuffer");
+		m_ShapeInstances.reserve(s_DefaultShapesCount);
+		CreateShapesGeometry();
 	}
 
 	void RenderLinesTask::RecordCommandBuffer(const Ref<CommandBuffer>& cmd)
 	{
-		if (m_Vertices.empty())
+		const bool bHasLines = !m_Vertices.empty();
+		const bool bHasShapes = !m_ShapeInstances.empty();
+		if (!bHasLines && !bHasShapes)
 			return;
 
 		EG_CPU_TIMING_SCOPED("Debug lines");
 		EG_GPU_TIMING_SCOPED(cmd, "Debug lines");
 
-		UploadVertexBuffer(cmd);
-		RenderLines(cmd);
+		if (bHasLines)
+			UploadVertexBuffer(cmd);
+		if (bHasShapes)
+			UploadShapes(cmd);
+
+		if (bHasLines)
+			RenderLines(cmd);
+		if (bHasShapes)
+			RenderShapes(cmd);
 	}
 
 	void RenderLinesTask::SetDebugLines(const std::vector<RendererLine>& lines)
@@ -56,6 +74,40 @@ namespace Eagle
 		});
 	}
 
+	void RenderLinesTask::SetDebugShapes(const std::vector<RendererDebugShape>& shapes)
+	{
+		// Instances are sorted by shape type so that each type is rendered with a single draw call
+		std::array<uint32_t, (size_t)DebugShapeType::Count> counts{};
+		for (auto& shape : shapes)
+			++counts[(size_t)shape.Type];
+
+		std::array<uint32_t, (size_t)DebugShapeType::Count> offsets{};
+		for (size_t i = 1; i < offsets.size(); ++i)
+			offsets[i] = offsets[i - 1] + counts[i - 1];
+
+		std::vector<DebugShapeInstance> instances(shapes.size());
+		for (auto& shape : shapes)
+		{
+			const glm::mat4 rows = glm::transpose(shape.Transform);
+
+			auto& instance = instances[offsets[(size_t)shape.Type]++];
+			instance.TransformRow0 = rows[0];
+			instance.TransformRow1 = rows[1];
+			instance.TransformRow2 = rows[2];
+			instance.Color = shape.Color;
+		}
+
+		RenderManager::Submit([this, instances = std::move(instances), counts](Ref<CommandBuffer>& cmd) mutable
+		{
+			std::swap(m_ShapeInstances, m_PrevShapeInstances);
+			m_ShapeInstances = std::move(instances);
+			std::copy(counts.begin(), counts.end(), m_ShapeInstancesCount);
+
+			// Only the instances that differ from the previous ones are uploaded
+			bUploadShapes |= AccumulateChangedRange(m_PrevShapeInstances, m_ShapeInstances, m_UploadBegin, m_UploadEnd);
+		});
+	}
+
 	void RenderLinesTask::RenderLines(const Ref<CommandBuffer>& cmd)
 	{
 		EG_CPU_TIMING_SCOPED("Render Debug lines");
@@ -91,6 +143,179 @@ namespace Eagle
 		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
 	}
 
+	void RenderLinesTask::RenderShapes(const Ref<CommandBuffer>& cmd)
+	{
+		EG_CPU_TIMING_SCOPED("Render Debug shapes");
+		EG_GPU_TIMING_SCOPED(cmd, "Render Debug shapes");
+
+		if (bJitter)
+			m_ShapesPipeline->SetBuffer(m_Renderer.GetJitter(), 0, 0);
+
+		cmd->BeginGraphics(m_ShapesPipeline);
+		cmd->SetGraphicsRootConstants(&m_Renderer.GetViewProjection()[0][0], nullptr);
+
+		uint32_t firstInstance = 0;
+		for (size_t i = 0; i < (size_t)DebugShapeType::Count; ++i)
+		{
+			const uint32_t instancesCount = m_ShapeInstancesCount[i];
+			if (instancesCount == 0)
+				continue;
+
+			const auto& range = m_ShapeRanges[i];
+			cmd->DrawIndexedInstanced(m_ShapesVertexBuffer, m_ShapesIndexBuffer, range.IndexCount, range.FirstIndex, 0,
+				instancesCount, firstInstance, m_ShapesInstanceBuffer);
+			firstInstance += instancesCount;
+		}
+		cmd->EndGraphics();
+	}
+
+	void RenderLinesTask::UploadShapes(const Ref<CommandBuffer>& cmd)
+	{
+		if (!bUploadShapes)
+			return;
+
+		EG_CPU_TIMING_SCOPED("Upload Debug shapes data");
+		EG_GPU_TIMING_SCOPED(cmd, "Upload Debug shapes data");
+
+		bUploadShapes = false;
+
+		auto& buffer = m_ShapesInstanceBuffer;
+		const auto& instances = m_ShapeInstances;
+		const size_t currentSize = instances.size() * sizeof(DebugShapeInstance);
+
+		size_t uploadBegin = m_UploadBegin;
+		size_t uploadEnd = glm::min(m_UploadEnd, instances.size());
+		m_UploadBegin = SIZE_MAX;
+		m_UploadEnd = 0;
+
+		if (currentSize > buffer->GetSize())
+		{
+			buffer->Resize(glm::max(currentSize, buffer->GetSize() * 3 / 2));
+
+			// Contents are lost, everything needs to be uploaded
+			uploadBegin = 0;
+			uploadEnd = instances.size();
+		}
+
+		if (uploadBegin < uploadEnd)
+		{
+			const size_t offset = uploadBegin * sizeof(DebugShapeInstance);
+			const size_t size = (uploadEnd - uploadBegin) * sizeof(DebugShapeInstance);
+			cmd->Write(buffer, instances.data() + uploadBegin, size, offset, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(buffer, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+		}
+	}
+
+	void RenderLinesTask::CreateShapesGeometry()
+	{
+		std::vector<glm::vec3> vertices;
+		std::vector<Index> indices;
+
+		// Adds an arc as a line strip. `axisX` and `axisY` define the plane of the arc. Returns the index of the first vertex
+		auto addArc = [&vertices, &indices](const glm::vec3& center, const glm::vec3& axisX, const glm::vec3& axisY, uint32_t segments, float arc)
+		{
+			const Index first = (Index)vertices.size();
+			for (uint32_t i = 0; i <= segments; ++i)
+			{
+				const float angle = (float(i) / segments) * arc;
+				vertices.push_back(center + glm::cos(angle) * axisX + glm::sin(angle) * axisY);
+			}
+			for (uint32_t i = 0; i < segments; ++i)
+			{
+				indices.push_back(first + i);
+				indices.push_back(first + i + 1);
+			}
+			return first;
+		};
+		auto beginShape = [this, &indices](DebugShapeType type)
+		{
+			m_ShapeRanges[(size_t)type].FirstIndex = (uint32_t)indices.size();
+		};
+		auto endShape = [this, &indices](DebugShapeType type)
+		{
+			auto& range = m_ShapeRanges[(size_t)type];
+			range.IndexCount = (uint32_t)indices.size() - range.FirstIndex;
+		};
+
+		constexpr float pi = glm::pi<float>();
+		constexpr float cos45 = 0.707106f;
+		constexpr uint32_t segments = s_ShapeCircleSegments;
+
+		// Sphere
+		beginShape(DebugShapeType::Sphere);
+		addArc(glm::vec3(0.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f), segments, 2.f * pi);
+		addArc(glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.f, 1.f), segments, 2.f * pi);
+		addArc(glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(cos45, 0.f, cos45), segments, 2.f * pi);
+		addArc(glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(-cos45, 0.f, cos45), segments, 2.f * pi);
+		endShape(DebugShapeType::Sphere);
+
+		// Box
+		{
+			beginShape(DebugShapeType::Box);
+			const Index first = (Index)vertices.size();
+			for (uint32_t i = 0; i < 8; ++i)
+				vertices.push_back(glm::vec3((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f));
+
+			constexpr Index edges[24] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 2, 1, 3, 4, 6, 5, 7, 0, 4, 1, 5, 2, 6, 3, 7 };
+			for (Index edge : edges)
+				indices.push_back(first + edge);
+			endShape(DebugShapeType::Box);
+		}
+
+		// Cylinder
+		{
+			beginShape(DebugShapeType::Cylinder);
+			const Index left = addArc(glm::vec3(-1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.f, 1.f), segments, 2.f * pi);
+			const Index right = addArc(glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.f, 1.f), segments, 2.f * pi);
+			for (uint32_t i = 0; i < segments; i += segments / 4)
+			{
+				indices.push_back(left + i);
+				indices.push_back(right + i);
+			}
+			endShape(DebugShapeType::Cylinder);
+		}
+
+		// Hemisphere
+		beginShape(DebugShapeType::Hemisphere);
+		addArc(glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(1.f, 0.f, 0.f), segments / 2, pi);
+		addArc(glm::vec3(0.f), glm::vec3(0.f, 0.f, 1.f), glm::vec3(1.f, 0.f, 0.f), segments / 2, pi);
+		endShape(DebugShapeType::Hemisphere);
+
+		// Cone
+		{
+			beginShape(DebugShapeType::Cone);
+			const Index apex = (Index)vertices.size();
+			vertices.push_back(glm::vec3(0.f));
+			const Index base = addArc(glm::vec3(0.f, 0.f, 1.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f), segments, 2.f * pi);
+			for (uint32_t i = 0; i < segments; ++i)
+			{
+				indices.push_back(apex);
+				indices.push_back(base + i);
+			}
+			endShape(DebugShapeType::Cone);
+		}
+
+		BufferSpecifications vertexSpecs;
+		vertexSpecs.Size = vertices.size() * sizeof(glm::vec3);
+		vertexSpecs.Layout = BufferReadAccess::Vertex;
+		vertexSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
+		m_ShapesVertexBuffer = Buffer::Create(vertexSpecs, "DebugShapes_VertexBuffer");
+
+		BufferSpecifications indexSpecs;
+		indexSpecs.Size = indices.size() * sizeof(Index);
+		indexSpecs.Layout = BufferReadAccess::Index;
+		indexSpecs.Usage = BufferUsage::IndexBuffer | BufferUsage::TransferDst;
+		m_ShapesIndexBuffer = Buffer::Create(indexSpecs, "DebugShapes_IndexBuffer");
+
+		RenderManager::Submit([vb = m_ShapesVertexBuffer, ib = m_ShapesIndexBuffer, vertices = std::move(vertices), indices = std::move(indices)](Ref<CommandBuffer>& cmd)
+		{
+			cmd->Write(vb, vertices.data(), vertices.size() * sizeof(glm::vec3), 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->Write(ib, indices.data(), indices.size() * sizeof(Index), 0, BufferLayoutType::Unknown, BufferReadAccess::Index);
+			cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(ib, BufferReadAccess::Index, BufferReadAccess::Index);
+		});
+	}
+
 	void RenderLinesTask::InitPipeline()
 	{
 		ColorAttachment colorAttachment;
@@ -123,5 +348,13 @@ namespace Eagle
 			m_Pipeline->SetState(state);
 		else
 			m_Pipeline = PipelineGraphics::Create(state);
+
+		state.VertexShader = Shader::Create("assets/shaders/debug_shape.vert", ShaderType::Vertex, defines);
+		state.PerInstanceAttribs = PerInstanceAttribs;
+
+		if (m_ShapesPipeline)
+			m_ShapesPipeline->SetState(state);
+		else
+			m_ShapesPipeline = PipelineGraphics::Create(state);
 	}
 }
@@ -26,28 +26,69 @@ namespace Eagle
 			InitPipeline();
 		}
 
+		// Lines are for arbitrary data (user lines, PhysX debug buffer, etc)
 		void SetDebugLines(const std::vector<RendererLine>& lines);
 
+		// Shapes are rendered instanced using unit wireframe meshes. Prefer them over lines when it's possible
+		void SetDebugShapes(const std::vector<RendererDebugShape>& shapes);
+
 		struct LineVertex
 		{
 			glm::vec3 Color = glm::vec3{ 0.f, 0.f, 0.f };
 			glm::vec3 Position = glm::vec3{ 0.f };
 		};
 
+		// Rows of an affine transformation matrix are stored to save space
+		struct DebugShapeInstance
+		{
+			glm::vec4 TransformRow0 = glm::vec4{ 1.f, 0.f, 0.f, 0.f };
+			glm::vec4 TransformRow1 = glm::vec4{ 0.f, 1.f, 0.f, 0.f };
+			glm::vec4 TransformRow2 = glm::vec4{ 0.f, 0.f, 1.f, 0.f };
+			glm::vec3 Color = glm::vec3{ 0.f, 0.f, 0.f };
+		};
+
 	private:
 		void InitPipeline();
 		void RenderLines(const Ref<CommandBuffer>& cmd);
+		void RenderShapes(const Ref<CommandBuffer>& cmd);
 		void UploadVertexBuffer(const Ref<CommandBuffer>& cmd);
+		void UploadShapes(const Ref<CommandBuffer>& cmd);
+		void CreateShapesGeometry();
 
 	private:
+		struct ShapeRange
+		{
+			uint32_t FirstIndex = 0;
+			uint32_t IndexCount = 0;
+		};
+
 		Ref<PipelineGraphics> m_Pipeline;
+		Ref<PipelineGraphics> m_ShapesPipeline;
 		Ref<Buffer> m_VertexBuffer;
 		std::vector<LineVertex> m_Vertices;
+
+		Ref<Buffer> m_ShapesVertexBuffer;
+		Ref<Buffer> m_ShapesIndexBuffer;
+		Ref<Buffer> m_ShapesInstanceBuffer;
+		std::vector<DebugShapeInstance> m_ShapeInstances; // Sorted by shape type
+		std::vector<DebugShapeInstance> m_PrevShapeInstances;
+		uint32_t m_ShapeInstancesCount[(size_t)DebugShapeType::Count] = { 0 };
+		ShapeRange m_ShapeRanges[(size_t)DebugShapeType::Count];
+		size_t m_UploadBegin = SIZE_MAX;
+		size_t m_UploadEnd = 0;
+		bool bUploadShapes = false;
+
 		float m_LineWidth = 1.f;
 		bool bJitter = false;
 
 		static constexpr size_t s_DefaultLinesCount = 256; // How much lines we can render without reallocating
 		static constexpr size_t s_DefaultLinesVerticesCount = s_DefaultLinesCount * 2;
 		static constexpr size_t s_BaseLinesVertexBufferSize = s_DefaultLinesVerticesCount * sizeof(LineVertex);
+		static constexpr size_t s_DefaultShapesCount = 64; // How much shapes we can render without reallocating
+		static constexpr size_t s_BaseShapesInstanceBufferSize = s_DefaultShapesCount * sizeof(DebugShapeInstance);
+		static constexpr uint32_t s_ShapeCircleSegments = 24;
+
+	public:
+		inline static const std::vector<PipelineGraphicsState::VertexInputAttribute> PerInstanceAttribs = { {1u}, {2u}, {3u}, {4u} }; // Locations of Per-Instance data in shader
 	};
 }
@@ -29,13 +29,14 @@ namespace Eagle
 
 	static void Draw(const Ref<CommandBuffer>& cmd, Ref<PipelineGraphics>& pipeline, const SpriteGeometryData& spritesData, const PushData& pushData, SceneRenderer::Statistics2D& stats)
 	{
-		if (spritesData.QuadVertices.empty())
+		if (spritesData.Instances.empty())
 			return;
 
-		const uint32_t quadsCount = (uint32_t)(spritesData.QuadVertices.size() / 4);
+		const uint32_t quadsCount = (uint32_t)spritesData.Instances.size();
 		cmd->BeginGraphics(pipeline);
 		cmd->SetGraphicsRootConstants(&pushData, nullptr);
-		cmd->DrawIndexed(spritesData.VertexBuffer, spritesData.IndexBuffer, quadsCount * 6, 0, 0);
+		cmd->DrawIndexedInstanced(RenderManager::GetUnitQuadVertexBuffer(), RenderManager::GetUnitDoubleSidedQuadIndexBuffer(), RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0,
+			quadsCount, 0, spritesData.InstanceBuffer);
 		cmd->EndGraphics();
 		++stats.DrawCalls;
 		stats.QuadCount += quadsCount;
@@ -52,7 +53,7 @@ namespace Eagle
 		const auto& spritesData = m_Renderer.GetOpaqueSpritesData();
 		const auto& notCastingShadowspritesData = m_Renderer.GetOpaqueNotCastingShadowSpriteData();
 
-		if (spritesData.QuadVertices.empty() && notCastingShadowspritesData.QuadVertices.empty())
+		if (spritesData.Instances.empty() && notCastingShadowspritesData.Instances.empty())
 			return;
 
 		EG_CPU_TIMING_SCOPED("Render Opaque Sprites");
@@ -87,7 +88,7 @@ namespace Eagle
 		const auto& spritesData = m_Renderer.GetMaskedSpritesData();
 		const auto& notCastingShadowspritesData = m_Renderer.GetMaskedNotCastingShadowSpriteData();
 
-		if (spritesData.QuadVertices.empty() && notCastingShadowspritesData.QuadVertices.empty())
+		if (spritesData.Instances.empty() && notCastingShadowspritesData.Instances.empty())
 			return;
 
 		EG_CPU_TIMING_SCOPED("Render Masked Sprites");
@@ -188,6 +189,7 @@ namespace Eagle
 			state.ColorAttachments.push_back(velocityAttachment);
 		}
 		state.DepthStencilAttachment = depthAttachment;
+		state.PerInstanceAttribs = PerInstanceAttribs;
 		state.CullMode = CullMode::Back;
 
 		if (m_OpaquePipeline)
@@ -44,5 +44,8 @@ namespace Eagle
 		uint64_t m_MaskedTexturesUpdatedFrames[RendererConfig::FramesInFlight] = { 0 };
 		bool bMotionRequired = false;
 		bool bJitter = false;
+
+	public:
+		inline static const std::vector<PipelineGraphicsState::VertexInputAttribute> PerInstanceAttribs = { {1u}, {2u}, {3u}, {4u} }; // Locations of Per-Instance data in shader
 	};
 }
@@ -6,63 +6,29 @@
 #include "Eagle/Renderer/VidWrappers/Texture.h"
 #include "Eagle/Renderer/VidWrappers/RenderCommandManager.h"
 #include "Eagle/Components/Components.h"
+#include "Eagle/UI/Font.h"
 
 #include "Eagle/Debug/CPUTimings.h"
 #include "Eagle/Debug/GPUTimings.h"
 
-#include <codecvt>
-
 namespace Eagle
 {
-	static void UploadIndexBuffer(const Ref<CommandBuffer>& cmd, Ref<Buffer>& buffer)
-	{
-		const size_t& ibSize = buffer->GetSize();
-		uint32_t offset = 0;
-		std::vector<Index> indices(ibSize / sizeof(Index));
-		for (size_t i = 0; i < indices.size(); i += 6)
-		{
-			indices[i + 0] = offset + 0;
-			indices[i + 1] = offset + 1;
-			indices[i + 2] = offset + 2;
-
-			indices[i + 3] = offset + 2;
-			indices[i + 4] = offset + 3;
-			indices[i + 5] = offset + 0;
-
-			offset += 4;
-		}
-
-		cmd->Write(buffer, indices.data(), ibSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Index);
-		cmd->TransitionLayout(buffer, BufferReadAccess::Index, BufferReadAccess::Index);
-	}
-
 	RenderText2DTask::RenderText2DTask(SceneRenderer& renderer)
 		: RendererTask(renderer)
 	{
 		InitPipeline();
 
-		BufferSpecifications vertexSpecs;
-		vertexSpecs.Size = s_BaseVertexBufferSize;
-		vertexSpecs.Layout = BufferReadAccess::Vertex;
-		vertexSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
-
-		BufferSpecifications indexSpecs;
-		indexSpecs.Size = s_BaseIndexBufferSize;
-		indexSpecs.Layout = BufferReadAccess::Index;
-		indexSpecs.Usage = BufferUsage::IndexBuffer | BufferUsage::TransferDst;
-
-		m_VertexBuffer = Buffer::Create(vertexSpecs, "Text2D_VertexBuffer");
-		m_IndexBuffer = Buffer::Create(indexSpecs, "Text2D_IndexBuffer");
+		BufferSpecifications instanceSpecs;
+		instanceSpecs.Size = s_BaseInstanceBufferSize;
+		instanceSpecs.Layout = BufferReadAccess::Vertex;
+		instanceSpecs.Usage = BufferUsage::VertexBuffer | BufferUsage::TransferDst;
 
-		RenderManager::Submit([this](Ref<CommandBuffer>& cmd)
-		{
-			UploadIndexBuffer(cmd, m_IndexBuffer);
-		});
+		m_InstanceBuffer = Buffer::Create(instanceSpecs, "Text2D_InstanceBuffer");
 	}
 	
 	void RenderText2DTask::RecordCommandBuffer(const Ref<CommandBuffer>& cmd)
 	{
-		if (m_Quads.empty())
+		if (m_Glyphs.empty())
 			return;
 
 		EG_GPU_TIMING_SCOPED(cmd, "Text 2D");
@@ -82,35 +48,31 @@ namespace Eagle
 
 		bUpload = false;
 
-		auto& vb = m_VertexBuffer;
-		auto& ib = m_IndexBuffer;
-		auto& quads = m_Quads;
-		using TextVertexType = QuadVertex;
+		auto& buffer = m_InstanceBuffer;
+		const auto& glyphs = m_Glyphs;
+		const size_t currentSize = glyphs.size() * sizeof(GlyphInstance);
 
-		// Reserving enough space to hold Vertex & Index data
-		const size_t currentVertexSize = quads.size() * sizeof(TextVertexType);
-		const size_t currentIndexSize = (quads.size() / 4) * (sizeof(Index) * 6);
+		size_t uploadBegin = m_UploadBegin;
+		size_t uploadEnd = glm::min(m_UploadEnd, glyphs.size());
+		m_UploadBegin = SIZE_MAX;
+		m_UploadEnd = 0;
 
-		if (currentVertexSize > vb->GetSize())
+		if (currentSize > buffer->GetSize())
 		{
-			size_t newSize = glm::max(currentVertexSize, vb->GetSize() * 3 / 2);
-			constexpr size_t alignment = 4 * sizeof(TextVertexType);
-			newSize += alignment - (newSize % alignment);
+			buffer->Resize(glm::max(currentSize, buffer->GetSize() * 3 / 2));
 
-			vb->Resize(newSize);
+			// Contents are lost, everything needs to be uploaded
+			uploadBegin = 0;
+			uploadEnd = glyphs.size();
 		}
-		if (currentIndexSize > ib->GetSize())
-		{
-			size_t newSize = glm::max(currentVertexSize, ib->GetSize() * 3 / 2);
-			constexpr size_t alignment = 6 * sizeof(Index);
-			newSize += alignment - (newSize % alignment);
 
-			ib->Resize(newSize);
-			UploadIndexBuffer(cmd, ib);
+		if (uploadBegin < uploadEnd)
+		{
+			const size_t offset = uploadBegin * sizeof(GlyphInstance);
+			const size_t size = (uploadEnd - uploadBegin) * sizeof(GlyphInstance);
+			cmd->Write(buffer, glyphs.data() + uploadBegin, size, offset, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
+			cmd->TransitionLayout(buffer, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
 		}
-
-		cmd->Write(vb, quads.data(), currentVertexSize, 0, BufferLayoutType::Unknown, BufferReadAccess::Vertex);
-		cmd->TransitionLayout(vb, BufferReadAccess::Vertex, BufferReadAccess::Vertex);
 	}
 
 	void RenderText2DTask::Render(const Ref<CommandBuffer>& cmd)
@@ -123,9 +85,10 @@ namespace Eagle
 		auto& pipeline = (m_Renderer.IsRuntime() && !bObjectPickingEnabled) ? m_PipelineNoEntityID : m_Pipeline;
 		pipeline->SetTextureArray(m_Atlases, 0, 0);
 
-		const uint32_t quadsCount = (uint32_t)(m_Quads.size() / 4);
+		const uint32_t quadsCount = (uint32_t)m_Glyphs.size();
 		cmd->BeginGraphics(pipeline);
-		cmd->DrawIndexed(m_VertexBuffer, m_IndexBuffer, quadsCount * 6, 0, 0);
+		cmd->DrawIndexedInstanced(RenderManager::GetUnitQuadVertexBuffer(), RenderManager::GetUnitQuadIndexBuffer(), RenderManager::UnitQuadIndexCount, 0, 0,
+			quadsCount, 0, m_InstanceBuffer);
 		cmd->EndGraphics();
 
 		auto& stats = m_Renderer.GetStats2D();
@@ -139,10 +102,47 @@ namespace Eagle
 		m_PipelineNoEntityID->Resize(size.x, size.y);
 	}
 
-	static std::u32string ToUTF32(const std::string& s)
+	void RenderText2DTask::FillTextData(Text2DComponentData& data, const Text2DComponent* text)
 	{
-		std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-		return conv.from_bytes(s);
+		data.Font = text->GetFont();
+		data.Text = text->GetText();
+		data.Color = text->GetColor();
+		data.LineSpacing = text->GetLineSpacing();
+		data.Pos = text->GetPosition();
+		data.Scale = text->GetScale();
+		data.Rotation = text->GetRotation();
+		data.KerningOffset = text->GetKerning();
+		data.MaxWidth = text->GetMaxWidth();
+		data.EntityID = text->Parent.GetID();
+		data.Opacity = text->GetOpacity();
+	}
+
+	void RenderText2DTask::WriteGlyphs(const Text2DComponentData& component, const std::vector<GlyphQuad>& glyphs, uint32_t atlasIndex,
+		size_t glyphsCapacity, GlyphInstance* instances)
+	{
+		const glm::mat4 rotate = glm::rotate(glm::mat4(1.0f), glm::radians(component.Rotation), glm::vec3(0.0f, 0.0f, 1.0f));
+		const glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), glm::vec3(component.Scale.x, -component.Scale.y, 1.f));
+		const glm::mat4 transform = scaleMat * rotate;
+
+		const glm::mat2 transform2D = glm::mat2(transform);
+		for (auto& glyph : glyphs)
+		{
+			const glm::vec2 planeMin = glm::vec2(glyph.PlaneBounds.x, glyph.PlaneBounds.y);
+			const glm::vec2 planeMax = glm::vec2(glyph.PlaneBounds.z, glyph.PlaneBounds.w);
+
+			auto& instance = *instances++;
+			instance.Origin = transform2D * planeMin + component.Pos;
+			instance.EdgeX = transform2D * glm::vec2(planeMax.x - planeMin.x, 0.f);
+			instance.EdgeY = transform2D * glm::vec2(0.f, planeMax.y - planeMin.y);
+			instance.AtlasBounds = glyph.AtlasBounds;
+			instance.Color = component.Color;
+			instance.AtlasIndex = atlasIndex;
+			instance.EntityID = component.EntityID;
+			instance.Opacity = component.Opacity;
+		}
+
+		// Spare glyphs have zero edges, so nothing is rasterized for them
+		std::fill_n(instances, glyphsCapacity - glyphs.size(), GlyphInstance{});
 	}
 
 	void RenderText2DTask::SetTexts(const std::vector<const Text2DComponent*>& texts, bool bDirty)
@@ -155,170 +155,151 @@ namespace Eagle
 
 		for (auto& text : texts)
 		{
-			const auto& font = text->GetFont();
-			if (!font)
+			if (!text->GetFont())
 				continue;
 
-			auto& data = datas.emplace_back();
-			data.Font = font;
-			data.Text = ToUTF32(text->GetText());
-			data.Color = text->GetColor();
-			data.LineSpacing = text->GetLineSpacing();
-			data.Pos = text->GetPosition();
-			data.Scale = text->GetScale();
-			data.Rotation = text->GetRotation();
-			data.KerningOffset = text->GetKerning();
-			data.MaxWidth = text->GetMaxWidth();
-			data.EntityID = text->Parent.GetID();
-			data.Opacity = text->GetOpacity();
+			FillTextData(datas.emplace_back(), text);
 		}
 
-		RenderManager::Submit([components = std::move(datas), this](const Ref<CommandBuffer>&)
+		RenderManager::Submit([components = std::move(datas), this](const Ref<CommandBuffer>&) mutable
 		{
-			bUpload = true;
-			m_Quads.clear();
-			m_Atlases.clear();
-			m_FontAtlases.clear();
-
-			const uint32_t atlasesCount = ProcessTexts(components);
-
-			m_Atlases.resize(atlasesCount);
-			for (auto& atlas : m_FontAtlases)
-				m_Atlases[atlas.second] = atlas.first;
+			m_Components = std::move(components);
+			RebuildTexts();
 		});
 	}
 
-	uint32_t RenderText2DTask::ProcessTexts(const std::vector<Text2DComponentData>& textComponents)
+	void RenderText2DTask::UpdateTexts(const std::vector<const Text2DComponent*>& texts)
 	{
-		if (textComponents.empty())
-			return 0;
+		if (texts.empty())
+			return;
+
+		EG_CPU_TIMING_SCOPED("Renderer. Update Texts 2D");
+
+		std::vector<Text2DComponentData> datas;
+		datas.reserve(texts.size());
+		for (auto& text : texts)
+		{
+			auto& data = datas.emplace_back();
+			FillTextData(data, text);
+			if (!text->IsVisible())
+				data.Font.reset(); // Hidden texts are handled the same way as texts without a font
+		}
 
-		uint32_t atlasCurrentIndex = 0u;
-		for (auto& component : textComponents)
+		RenderManager::Submit([components = std::move(datas), this](const Ref<CommandBuffer>&) mutable
 		{
-			const auto& fontGeometry = component.Font->GetFontGeometry();
-			const auto& metrics = fontGeometry->getMetrics();
-			const auto& text = component.Text;
-			const auto& atlas = component.Font->GetAtlas();
-			uint32_t atlasIndex = atlasCurrentIndex;
-
-			auto it = m_FontAtlases.find(atlas);
-			if (it == m_FontAtlases.end())
+			bool bRebuild = false;
+			for (auto& component : components)
 			{
-				if (m_FontAtlases.size() == RendererConfig::MaxTextures) // Can't be more than EG_MAX_TEXTURES
+				auto it = m_ComponentIndices.find((uint32_t)component.EntityID);
+				if (it == m_ComponentIndices.end())
 				{
-					EG_CORE_CRITICAL("Not enough samplers to store all font atlases! Max supported fonts: {}", RendererConfig::MaxTextures);
-					atlasIndex = 0;
+					// The text wasn't rendered before since it was hidden or didn't have a font
+					if (component.Font)
+					{
+						m_Components.push_back(std::move(component));
+						bRebuild = true;
+					}
+					continue;
 				}
-				else
-					m_FontAtlases.emplace(atlas, atlasCurrentIndex++);
-			}
-			else
-				atlasIndex = it->second;
 
-			const double spaceAdvance = fontGeometry->getGlyph(' ')->getAdvance();
-			std::vector<int> nextLines = Font::GetNextLines(metrics, fontGeometry, text, spaceAdvance,
-				component.LineSpacing, component.KerningOffset, component.MaxWidth);
+				const size_t index = it->second;
+				m_Components[index] = std::move(component);
+				if (!bRebuild && !RelayoutText(index))
+					bRebuild = true;
+			}
 
+			if (bRebuild)
+				RebuildTexts();
+			else
 			{
-				const glm::mat4 rotate = glm::rotate(glm::mat4(1.0f), glm::radians(component.Rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-				const glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), glm::vec3(component.Scale.x, -component.Scale.y, 1.f));
-				const glm::mat4 transform = scaleMat * rotate;
-
-				double x = 0.0;
-				double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
-				double y = 0.0;
-				const size_t textSize = text.size();
-				for (int i = 0; i < textSize; i++)
-				{
-					char32_t character = text[i];
-					if (character == '\n' || Font::NextLine(i, nextLines))
-					{
-						x = 0;
-						y -= fsScale * metrics.lineHeight + component.LineSpacing;
-						continue;
-					}
+				// New fonts are appended, so indices of the existing atlases stay the same
+				GatherFontAtlases();
+				bUpload = true;
+			}
+		});
+	}
 
-					const bool bIsTab = character == '\t';
-					if (character == ' ' || bIsTab)
-					{
-						character = ' '; // treat tabs as spaces
-						double advance = spaceAdvance;
-						if (i < textSize - 1)
-						{
-							char32_t nextCharacter = text[i + 1];
-							if (nextCharacter == '\t')
-								nextCharacter = ' ';
-							fontGeometry->getAdvance(advance, character, nextCharacter);
-						}
-
-						// Tab is 4 spaces
-						x += (fsScale * advance + component.KerningOffset) * (bIsTab ? 4.0 : 1.0);
-						continue;
-					}
+	void RenderText2DTask::RebuildTexts()
+	{
+		EG_CPU_TIMING_SCOPED("Renderer. Rebuild Texts 2D");
 
-					auto glyph = fontGeometry->getGlyph(character);
-					if (!glyph)
-						glyph = fontGeometry->getGlyph('?');
-					if (!glyph)
-						continue;
+		// Texts that were hidden by `UpdateTexts` don't have a font
+		m_Components.erase(std::remove_if(m_Components.begin(), m_Components.end(),
+			[](const Text2DComponentData& text) { return !text.Font; }), m_Components.end());
 
-					double l, b, r, t;
-					glyph->getQuadAtlasBounds(l, b, r, t);
+		m_Glyphs.clear();
+		m_Ranges.clear();
+		m_FontAtlases.clear();
+		m_ComponentIndices.clear();
+		m_Ranges.reserve(m_Components.size());
 
-					double pl, pb, pr, pt;
-					glyph->getQuadPlaneBounds(pl, pb, pr, pt);
+		for (size_t i = 0; i < m_Components.size(); ++i)
+		{
+			const auto& component = m_Components[i];
+			m_ComponentIndices.emplace((uint32_t)component.EntityID, i);
 
-					pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
-					pl += x, pb += y, pr += x, pt += y;
+			const uint32_t atlasIndex = GetFontAtlasIndex(component.Font->GetAtlas());
+			const auto& glyphs = m_LayoutCache.GetLayout((uint32_t)component.EntityID, component.Font, component.Text,
+				component.LineSpacing, component.KerningOffset, component.MaxWidth);
 
-					double texelWidth = 1. / atlas->GetWidth();
-					double texelHeight = 1. / atlas->GetHeight();
-					l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
+			auto& range = m_Ranges.emplace_back();
+			range.FirstGlyph = m_Glyphs.size();
+			range.GlyphsCapacity = TextLayoutCache::GetGlyphsCapacity(glyphs.size());
+			m_Glyphs.resize(range.FirstGlyph + range.GlyphsCapacity);
+			WriteGlyphs(component, glyphs, atlasIndex, range.GlyphsCapacity, m_Glyphs.data() + range.FirstGlyph);
+		}
+		m_LayoutCache.RemoveUnused();
+		GatherFontAtlases();
 
-					const size_t q1Index = m_Quads.size();
-					{
-						auto& q1 = m_Quads.emplace_back();
-						q1.Color = component.Color;
-						q1.AtlasIndex = atlasIndex;
-						q1.Position = glm::vec2(transform * glm::vec4(pl, pb, 0.f, 1.f)) + component.Pos;
-						q1.TexCoord = { l, b };
-						q1.EntityID = component.EntityID;
-						q1.Opacity = component.Opacity;
-					}
+		m_UploadBegin = 0;
+		m_UploadEnd = m_Glyphs.size();
+		bUpload = true;
+	}
 
-					{
-						auto& q2 = m_Quads.emplace_back();
-						q2 = m_Quads[q1Index];
-						q2.Position = glm::vec2(transform * glm::vec4(pl, pt, 0.f, 1.f)) + component.Pos;
-						q2.TexCoord = { l, t };
-					}
+	bool RenderText2DTask::RelayoutText(size_t index)
+	{
+		const auto& component = m_Components[index];
+		const auto& range = m_Ranges[index];
+		if (component.Font)
+		{
+			const auto& glyphs = m_LayoutCache.GetLayout((uint32_t)component.EntityID, component.Font, component.Text,
+				component.LineSpacing, component.KerningOffset, component.MaxWidth);
+			if (glyphs.size() > range.GlyphsCapacity)
+				return false;
 
-					{
-						auto& q3 = m_Quads.emplace_back();
-						q3 = m_Quads[q1Index];
-						q3.Position = glm::vec2(transform * glm::vec4(pr, pt, 0.f, 1.f)) + component.Pos;
-						q3.TexCoord = { r, t };
-					}
+			const uint32_t atlasIndex = GetFontAtlasIndex(component.Font->GetAtlas());
+			WriteGlyphs(component, glyphs, atlasIndex, range.GlyphsCapacity, m_Glyphs.data() + range.FirstGlyph);
+		}
+		else
+			std::fill_n(m_Glyphs.data() + range.FirstGlyph, range.GlyphsCapacity, GlyphInstance{}); // Hidden until the next rebuild removes it
 
-					{
-						auto& q4 = m_Quads.emplace_back();
-						q4 = m_Quads[q1Index];
-						q4.Position = glm::vec2(transform * glm::vec4(pr, pb, 0.f, 1.f)) + component.Pos;
-						q4.TexCoord = { r, b };
-					}
+		m_UploadBegin = glm::min(m_UploadBegin, range.FirstGlyph);
+		m_UploadEnd = glm::max(m_UploadEnd, range.FirstGlyph + range.GlyphsCapacity);
+		return true;
+	}
 
-					if (i + 1 < textSize)
-					{
-						double advance = glyph->getAdvance();
-						fontGeometry->getAdvance(advance, character, text[i + 1]);
-						x += fsScale * advance + component.KerningOffset;
-					}
-				}
-			}
+	uint32_t RenderText2DTask::GetFontAtlasIndex(const Ref<Texture2D>& atlas)
+	{
+		auto it = m_FontAtlases.find(atlas);
+		if (it != m_FontAtlases.end())
+			return it->second;
+
+		if (m_FontAtlases.size() == RendererConfig::MaxTextures) // Can't be more than EG_MAX_TEXTURES
+		{
+			EG_CORE_CRITICAL("Not enough samplers to store all font atlases! Max supported fonts: {}", RendererConfig::MaxTextures);
+			return 0;
 		}
 
-		return atlasCurrentIndex;
+		const uint32_t index = (uint32_t)m_FontAtlases.size();
+		m_FontAtlases.emplace(atlas, index);
+		return index;
+	}
+
+	void RenderText2DTask::GatherFontAtlases()
+	{
+		m_Atlases.resize(m_FontAtlases.size());
+		for (auto& atlas : m_FontAtlases)
+			m_Atlases[atlas.second] = atlas.first;
 	}
 	
 	void RenderText2DTask::InitPipeline()
@@ -349,6 +330,7 @@ namespace Eagle
 		state.VertexShader = Shader::Create("assets/shaders/text2D.vert", ShaderType::Vertex, noObjectIDDefine);
 		state.FragmentShader = Shader::Create("assets/shaders/text2D.frag", ShaderType::Fragment, noObjectIDDefine);
 		state.ColorAttachments.push_back(colorAttachment);
+		state.PerInstanceAttribs = PerInstanceAttribs;
 		state.CullMode = CullMode::Front;
 
 		if (m_PipelineNoEntityID)
@@ -2,6 +2,7 @@
 
 #include "RendererTask.h"
 #include "Eagle/Renderer/VidWrappers/PipelineGraphics.h"
+#include "Eagle/UI/TextLayoutCache.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -22,14 +23,19 @@ namespace Eagle
 		void OnResize(glm::uvec2 size) override;
 
 		void SetTexts(const std::vector<const Text2DComponent*>& texts, bool bDirty);
+		// Relayouts only the passed texts into their glyph ranges. Texts that were added or removed need to go through `SetTexts`
+		void UpdateTexts(const std::vector<const Text2DComponent*>& texts);
 
 	private:
-		struct QuadVertex
+		// Per-instance data. Glyph quads are generated in the vertex shader from the unit quad
+		struct GlyphInstance
 		{
+			glm::vec2 Origin; // Screen-space position of the bottom-left corner
+			glm::vec2 EdgeX;
+			glm::vec2 EdgeY;
+			glm::vec4 AtlasBounds;
 			glm::vec3 Color;
 			uint32_t AtlasIndex;
-			glm::vec2 Position;
-			glm::vec2 TexCoord;
 			int EntityID;
 			float Opacity;
 		};
@@ -37,7 +43,7 @@ namespace Eagle
 		struct Text2DComponentData
 		{
 			Ref<Font> Font;
-			std::u32string Text;
+			std::string Text;
 			glm::vec3 Color;
 			float LineSpacing;
 			glm::vec2 Pos;
@@ -49,27 +55,48 @@ namespace Eagle
 			float Opacity;
 		};
 
+		// Glyphs of a single text component. Glyphs past the laid out ones are degenerate
+		struct GlyphsRange
+		{
+			size_t FirstGlyph = 0;
+			size_t GlyphsCapacity = 0;
+		};
+
 		void InitPipeline();
 
-		// Returns the number of unique atlases
-		uint32_t ProcessTexts(const std::vector<Text2DComponentData>& textComponents);
+		static void FillTextData(Text2DComponentData& data, const Text2DComponent* text);
+		static void WriteGlyphs(const Text2DComponentData& component, const std::vector<GlyphQuad>& glyphs, uint32_t atlasIndex,
+			size_t glyphsCapacity, GlyphInstance* instances);
+
+		// Lays out all texts from `m_Components`. Used when texts were added or removed, or a text didn't fit into its range
+		void RebuildTexts();
+		// Writes the text into its range. Returns false if it doesn't fit there anymore
+		bool RelayoutText(size_t index);
+		uint32_t GetFontAtlasIndex(const Ref<Texture2D>& atlas);
+		void GatherFontAtlases();
 
 	private:
 		Ref<PipelineGraphics> m_Pipeline;
 		Ref<PipelineGraphics> m_PipelineNoEntityID;
-		Ref<Buffer> m_VertexBuffer;
-		Ref<Buffer> m_IndexBuffer;
+		Ref<Buffer> m_InstanceBuffer;
 
-		std::vector<QuadVertex> m_Quads;
+		std::vector<GlyphInstance> m_Glyphs;
+		std::vector<Text2DComponentData> m_Components;
+		std::vector<GlyphsRange> m_Ranges; // Parallel to `m_Components`
+		std::unordered_map<uint32_t, size_t> m_ComponentIndices; // EntityID -> index to `m_Components`
+		TextLayoutCache m_LayoutCache;
 		std::unordered_map<Ref<Texture2D>, uint32_t> m_FontAtlases;
 		std::vector<Ref<Texture2D>> m_Atlases;
 
+		// Range of glyphs that needs to be uploaded
+		size_t m_UploadBegin = SIZE_MAX;
+		size_t m_UploadEnd = 0;
 		bool bUpload = true;
 
 		static constexpr size_t s_TextDefaultQuadCount = 64; // How much quads we can render without reallocating
-		static constexpr size_t s_TextDefaultVerticesCount = s_TextDefaultQuadCount * 4;
+		static constexpr size_t s_BaseInstanceBufferSize = s_TextDefaultQuadCount * sizeof(GlyphInstance);
 
-		static constexpr size_t s_BaseVertexBufferSize = s_TextDefaultVerticesCount * sizeof(QuadVertex);
-		static constexpr size_t s_BaseIndexBufferSize = s_TextDefaultQuadCount * (sizeof(Index) * 6);
+	public:
+		inline static const std::vector<PipelineGraphicsState::VertexInputAttribute> PerInstanceAttribs = { {1u}, {2u}, {3u}, {4u}, {5u}, {6u}, {7u}, {8u} }; // Locations of Per-Instance data in shader
 	};
 }
@@ -14,6 +14,7 @@
 #include "Eagle/Renderer/MaterialSystem.h"
 
 #include "RenderMeshesTask.h"
+#include "RenderSpritesTask.h"
 
 #include "Eagle/Debug/CPUTimings.h"
 #include "Eagle/Debug/GPUTimings.h"
@@ -1168,17 +1169,16 @@ namespace Eagle
 	void ShadowPassTask::ShadowPassOpacitySprites(const Ref<CommandBuffer>& cmd)
 	{
 		const auto& spritesData = m_Renderer.GetOpaqueSpritesData();
-		const auto& vertices = spritesData.QuadVertices;
-
-		const uint32_t quadsCount = (uint32_t)(vertices.size() / 4);
+		const uint32_t quadsCount = (uint32_t)spritesData.Instances.size();
 		if (quadsCount == 0)
 			return;
 
 		EG_GPU_TIMING_SCOPED(cmd, "Opacity Sprites shadow pass");
 		EG_CPU_TIMING_SCOPED("Opacity Sprites shadow pass");
 
-		const auto& vb = spritesData.VertexBuffer;
-		const auto& ib = spritesData.IndexBuffer;
+		const auto& vb = RenderManager::GetUnitQuadVertexBuffer();
+		const auto& ib = RenderManager::GetUnitDoubleSidedQuadIndexBuffer();
+		const auto& ivb = spritesData.InstanceBuffer;
 		const auto& transformsBuffer = m_Renderer.GetSpritesTransformsBuffer();
 
 		const glm::vec3 cameraPos = m_Renderer.GetViewPosition();
@@ -1202,7 +1202,7 @@ namespace Eagle
 				stats.QuadCount += quadsCount;
 				cmd->BeginGraphics(pipeline, m_DLFramebuffers[i]);
 				cmd->SetGraphicsRootConstants(&dirLight.ViewProj[i], nullptr);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 			}
 			bDidDrawDL = true;
@@ -1236,7 +1236,7 @@ namespace Eagle
 				cmd->TransitionLayout(vpsBuffer, BufferReadAccess::Uniform, BufferReadAccess::Uniform);
 
 				cmd->BeginGraphics(pipeline, framebuffers[i]);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 				++stats.DrawCalls;
 				stats.QuadCount += quadsCount;
@@ -1266,7 +1266,7 @@ namespace Eagle
 
 				cmd->BeginGraphics(pipeline, framebuffers[i]);
 				cmd->SetGraphicsRootConstants(&spotLight.ViewProj, nullptr);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 				++spotLightsCount;
 				++stats.DrawCalls;
@@ -1278,17 +1278,16 @@ namespace Eagle
 	void ShadowPassTask::ShadowPassTranslucentSprites(const Ref<CommandBuffer>& cmd)
 	{
 		const auto& spritesData = m_Renderer.GetTranslucentSpritesData();
-		const auto& vertices = spritesData.QuadVertices;
-
-		const uint32_t quadsCount = (uint32_t)(vertices.size() / 4);
+		const uint32_t quadsCount = (uint32_t)spritesData.Instances.size();
 		if (quadsCount == 0)
 			return;
 
 		EG_GPU_TIMING_SCOPED(cmd, "Translucent Sprites shadow pass");
 		EG_CPU_TIMING_SCOPED("Translucent Sprites shadow pass");
 
-		const auto& vb = spritesData.VertexBuffer;
-		const auto& ib = spritesData.IndexBuffer;
+		const auto& vb = RenderManager::GetUnitQuadVertexBuffer();
+		const auto& ib = RenderManager::GetUnitDoubleSidedQuadIndexBuffer();
+		const auto& ivb = spritesData.InstanceBuffer;
 		const auto& transformsBuffer = m_Renderer.GetSpritesTransformsBuffer();
 
 		const glm::vec3 cameraPos = m_Renderer.GetViewPosition();
@@ -1335,7 +1334,7 @@ namespace Eagle
 			{
 				cmd->BeginGraphics(pipeline, framebuffers[i]);
 				cmd->SetGraphicsRootConstants(&dirLight.ViewProj[i], nullptr);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 				++stats.DrawCalls;
 				stats.QuadCount += quadsCount;
@@ -1390,7 +1389,7 @@ namespace Eagle
 					cmd->TransitionLayout(vpsBuffer, BufferReadAccess::Uniform, BufferReadAccess::Uniform);
 
 					cmd->BeginGraphics(pipeline, framebuffers[i]);
-					cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+					cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 					cmd->EndGraphics();
 					++pointLightsCount;
 					++stats.DrawCalls;
@@ -1438,7 +1437,7 @@ namespace Eagle
 
 					cmd->BeginGraphics(pipeline, framebuffers[i]);
 					cmd->SetGraphicsRootConstants(&spotLight.ViewProj, nullptr);
-					cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+					cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 					cmd->EndGraphics();
 					++spotLightsCount;
 					++stats.DrawCalls;
@@ -1451,17 +1450,16 @@ namespace Eagle
 	void ShadowPassTask::ShadowPassMaskedSprites(const Ref<CommandBuffer>& cmd)
 	{
 		const auto& spritesData = m_Renderer.GetMaskedSpritesData();
-		const auto& vertices = spritesData.QuadVertices;
-
-		const uint32_t quadsCount = (uint32_t)(vertices.size() / 4);
+		const uint32_t quadsCount = (uint32_t)spritesData.Instances.size();
 		if (quadsCount == 0)
 			return;
 
 		EG_GPU_TIMING_SCOPED(cmd, "Masked Sprites shadow pass");
 		EG_CPU_TIMING_SCOPED("Masked Sprites shadow pass");
 
-		const auto& vb = spritesData.VertexBuffer;
-		const auto& ib = spritesData.IndexBuffer;
+		const auto& vb = RenderManager::GetUnitQuadVertexBuffer();
+		const auto& ib = RenderManager::GetUnitDoubleSidedQuadIndexBuffer();
+		const auto& ivb = spritesData.InstanceBuffer;
 		const auto& transformsBuffer = m_Renderer.GetSpritesTransformsBuffer();
 
 		const glm::vec3 cameraPos = m_Renderer.GetViewPosition();
@@ -1497,7 +1495,7 @@ namespace Eagle
 				stats.QuadCount += quadsCount;
 				cmd->BeginGraphics(pipeline, m_DLFramebuffers[i]);
 				cmd->SetGraphicsRootConstants(&dirLight.ViewProj[i], nullptr);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 			}
 			bDidDrawDL = true;
@@ -1543,7 +1541,7 @@ namespace Eagle
 				cmd->TransitionLayout(vpsBuffer, BufferReadAccess::Uniform, BufferReadAccess::Uniform);
 
 				cmd->BeginGraphics(pipeline, framebuffers[i]);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 				++stats.DrawCalls;
 				stats.QuadCount += quadsCount;
@@ -1583,7 +1581,7 @@ namespace Eagle
 
 				cmd->BeginGraphics(pipeline, framebuffers[i]);
 				cmd->SetGraphicsRootConstants(&spotLight.ViewProj, nullptr);
-				cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+				cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 				cmd->EndGraphics();
 				++spotLightsCount;
 				++stats.DrawCalls;
@@ -2362,6 +2360,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.DepthStencilAttachment = depthAttachment;
 			state.CullMode = CullMode::Front;
 			state.FrontFace = FrontFaceMode::Clockwise;
@@ -2386,6 +2385,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, plDefines);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.DepthStencilAttachment = depthAttachment;
 			state.CullMode = CullMode::Front;
 			state.FrontFace = FrontFaceMode::Clockwise;
@@ -2412,6 +2412,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, slDefines);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.DepthStencilAttachment = depthAttachment;
 			state.CullMode = CullMode::Back;
 			state.FrontFace = FrontFaceMode::Clockwise;
@@ -2436,6 +2437,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, { {"EG_MATERIALS_REQUIRED", ""} });
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.FragmentShader = Shader::Create("assets/shaders/shadow_map_masked.frag", ShaderType::Fragment);
 			state.DepthStencilAttachment = depthAttachment;
 			state.CullMode = CullMode::Front;
@@ -2462,6 +2464,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, plDefines);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.FragmentShader = Shader::Create("assets/shaders/shadow_map_masked.frag", ShaderType::Fragment);
 			state.DepthStencilAttachment = depthAttachment;
 			state.CullMode = CullMode::Front;
@@ -2490,6 +2493,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, slDefines);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.FragmentShader = Shader::Create("assets/shaders/shadow_map_masked.frag", ShaderType::Fragment);
 			state.DepthStencilAttachment = depthAttachment;
 			state.CullMode = CullMode::Back;
@@ -2542,6 +2546,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, { {"EG_MATERIALS_REQUIRED", ""} });
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.FragmentShader = Shader::Create("assets/shaders/shadow_map_translucent.frag", ShaderType::Fragment, fragmentDefines);
 			state.DepthStencilAttachment = depthAttachment;
 			state.FrontFace = FrontFaceMode::Clockwise;
@@ -2615,6 +2620,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, plDefines);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.FragmentShader = Shader::Create("assets/shaders/shadow_map_translucent.frag", ShaderType::Fragment, fragmentDefines);
 			state.DepthStencilAttachment = depthAttachment;
 			state.FrontFace = FrontFaceMode::Clockwise;
@@ -2690,6 +2696,7 @@ namespace Eagle
 
 			PipelineGraphicsState state;
 			state.VertexShader = Shader::Create("assets/shaders/shadow_map_sprites.vert", ShaderType::Vertex, slDefines);
+			state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 			state.FragmentShader = Shader::Create("assets/shaders/shadow_map_translucent.frag", ShaderType::Fragment, fragmentDefines);
 			state.DepthStencilAttachment = depthAttachment;
 			state.FrontFace = FrontFaceMode::Clockwise;
@@ -13,6 +13,7 @@ namespace Eagle
 		: RendererTask(renderer)
 	{
 		m_FinalImage = m_Renderer.GetHDROutput();
+		bUpscaling = m_Renderer.GetOptions().InternalState.bScaledRendering;
 		InitPipeline();
 	}
 	
@@ -23,11 +24,24 @@ namespace Eagle
 
 		struct PushData
 		{
+			glm::mat4 ProjInv;
 			glm::uvec2 Size;
 			glm::vec2 TexelSize;
+			glm::uvec2 RenderSize; // Part of the input that contains the scene
+			float RenderScale;
+			float PrevRenderScale;
+			glm::vec2 Jitter; // In pixels
+			uint32_t bResetHistory;
 		} pushData;
+		static_assert(sizeof(PushData) <= 128);
+		pushData.ProjInv = glm::inverse(m_Renderer.GetProjectionMatrix());
 		pushData.Size = m_FinalImage->GetSize();
 		pushData.TexelSize = 1.f / glm::vec2(pushData.Size);
+		pushData.RenderSize = m_Renderer.GetRenderSize();
+		pushData.RenderScale = m_Renderer.GetRenderScale();
+		pushData.PrevRenderScale = m_Renderer.GetPrevRenderScale();
+		pushData.Jitter = m_Renderer.GetJitterOffset() * glm::vec2(pushData.Size) * 0.5f;
+		pushData.bResetHistory = m_bResetHistory ? 1u : 0u;
 
 		constexpr uint32_t tileSize = 8;
 		const auto& size = pushData.Size;
@@ -49,25 +63,84 @@ namespace Eagle
 			cmd->CopyImage(m_FinalImage, ImageView{}, m_HistoryImage, ImageView{}, glm::ivec3{ 0 }, glm::ivec3{ 0 }, m_FinalImage->GetSize());
 		}
 
+		if (bUpscaling && !m_DepthHistory[0])
+		{
+			ImageSpecifications depthSpecs;
+			depthSpecs.Format = ImageFormat::R32_Float;
+			depthSpecs.Size = { size.x, size.y, 1 };
+			depthSpecs.Usage = ImageUsage::Sampled | ImageUsage::Storage;
+			m_DepthHistory[0] = Image::Create(depthSpecs, "TAA_DepthHistory_0");
+			m_DepthHistory[1] = Image::Create(depthSpecs, "TAA_DepthHistory_1");
+
+			cmd->TransitionLayout(m_DepthHistory[0], ImageLayoutType::Unknown, ImageReadAccess::PixelShaderRead);
+			cmd->TransitionLayout(m_DepthHistory[1], ImageLayoutType::Unknown, ImageReadAccess::PixelShaderRead);
+			pushData.bResetHistory = 1u;
+		}
+
 		m_Pipeline->SetImageSampler(m_HistoryImage, Sampler::BilinearSampler, 0, 0);
 		m_Pipeline->SetImageSampler(m_Renderer.GetGBuffer().Motion, Sampler::PointSampler, 0, 1);
 		m_Pipeline->SetImage(m_FinalImage, 0, 2);
 		m_Pipeline->SetImage(m_Result, 0, 3);
 
+		const auto& depth = m_Renderer.GetGBuffer().Depth;
+		const ImageLayout oldDepthLayout = depth->GetLayout();
+		if (bUpscaling)
+		{
+			const Ref<Image>& prevDepth = m_DepthHistory[m_DepthHistoryIndex];
+			const Ref<Image>& currentDepth = m_DepthHistory[m_DepthHistoryIndex ^ 1u];
+			m_Pipeline->SetImageSampler(depth, Sampler::PointSamplerClamp, 0, 4);
+			m_Pipeline->SetImageSampler(prevDepth, Sampler::PointSamplerClamp, 0, 5);
+			m_Pipeline->SetImage(currentDepth, 0, 6);
+
+			cmd->TransitionLayout(depth, oldDepthLayout, ImageReadAccess::PixelShaderRead);
+			cmd->TransitionLayout(currentDepth, currentDepth->GetLayout(), ImageLayoutType::StorageImage);
+		}
+
 		const ImageLayout oldLayout = m_FinalImage->GetLayout();
 		cmd->TransitionLayout(m_FinalImage, oldLayout, ImageLayoutType::StorageImage);
 
 		cmd->Dispatch(m_Pipeline, numGroups.x, numGroups.y, 1, &pushData);
 
 		cmd->TransitionLayout(m_FinalImage, ImageLayoutType::StorageImage, oldLayout);
+		if (bUpscaling)
+		{
+			const Ref<Image>& currentDepth = m_DepthHistory[m_DepthHistoryIndex ^ 1u];
+			cmd->TransitionLayout(currentDepth, ImageLayoutType::StorageImage, ImageReadAccess::PixelShaderRead);
+			cmd->TransitionLayout(depth, ImageReadAccess::PixelShaderRead, oldDepthLayout);
+			m_DepthHistoryIndex ^= 1u;
+		}
 		cmd->CopyImage(m_Result, ImageView{}, m_FinalImage, ImageView{}, glm::ivec3{0}, glm::ivec3{0}, m_FinalImage->GetSize());
 		cmd->CopyImage(m_Result, ImageView{}, m_HistoryImage, ImageView{}, glm::ivec3{0}, glm::ivec3{0}, m_FinalImage->GetSize());
+		m_bResetHistory = false;
+	}
+
+	void TAATask::InitWithOptions(const SceneRendererSettings& settings)
+	{
+		const bool bNewUpscaling = settings.InternalState.bScaledRendering;
+		if (bNewUpscaling == bUpscaling)
+			return;
+
+		bUpscaling = bNewUpscaling;
+		if (!bUpscaling)
+		{
+			m_DepthHistory[0].reset();
+			m_DepthHistory[1].reset();
+		}
+		m_bResetHistory = true;
+		InitPipeline();
 	}
 	
 	void TAATask::InitPipeline()
 	{
+		ShaderDefines defines;
+		if (bUpscaling)
+			defines["EG_TAA_UPSCALING"] = "";
+
 		PipelineComputeState state;
-		state.ComputeShader = Shader::Create("assets/shaders/taa.comp", ShaderType::Compute);
-		m_Pipeline = PipelineCompute::Create(state);
+		state.ComputeShader = Shader::Create("assets/shaders/taa.comp", ShaderType::Compute, defines);
+		if (m_Pipeline)
+			m_Pipeline->SetState(state);
+		else
+			m_Pipeline = PipelineCompute::Create(state);
 	}
 }
@@ -17,8 +17,14 @@ namespace Eagle
 		{
 			m_HistoryImage->Resize(glm::uvec3(size, 1));
 			m_Result->Resize(glm::uvec3(size, 1));
+			for (auto& depth : m_DepthHistory)
+				if (depth)
+					depth->Resize(glm::uvec3(size, 1));
+			m_bResetHistory = true;
 		}
 
+		void InitWithOptions(const SceneRendererSettings& settings) override;
+
 	private:
 		void InitPipeline();
 
@@ -27,5 +33,12 @@ namespace Eagle
 		Ref<Image> m_FinalImage;
 		Ref<Image> m_HistoryImage;
 		Ref<Image> m_Result;
+
+		// Used by upscaling for disocclusion detection. Linear depth of the output, ping-ponged each frame
+		Ref<Image> m_DepthHistory[2];
+		uint32_t m_DepthHistoryIndex = 0;
+
+		bool bUpscaling = false;
+		bool m_bResetHistory = true;
 	};
 }
@@ -7,6 +7,7 @@
 #include "Eagle/Renderer/MaterialSystem.h"
 #include "Eagle/Renderer/VidWrappers/RenderCommandManager.h"
 #include "Eagle/Renderer/Tasks/RenderMeshesTask.h"
+#include "Eagle/Renderer/Tasks/RenderSpritesTask.h"
 
 #include "Eagle/Debug/CPUTimings.h"
 #include "Eagle/Debug/GPUTimings.h"
@@ -53,7 +54,7 @@ namespace Eagle
 		const auto& textsNoShadowData = m_Renderer.GetTranslucentLitNotCastingShadowTextData();
 
 		if (meshes.empty() &&
-			spritesData.QuadVertices.empty() && spritesNoShadowData.QuadVertices.empty() &&
+			spritesData.Instances.empty() && spritesNoShadowData.Instances.empty() &&
 			textsData.QuadVertices.empty() && textsNoShadowData.QuadVertices.empty())
 		{
 			m_OITBuffer.reset(); // Release buffers since it's not needed
@@ -269,14 +270,13 @@ namespace Eagle
 
 	void TransparencyTask::RenderSpritesDepth(const Ref<CommandBuffer>& cmd, const SpriteGeometryData& spritesData)
 	{
-		const auto& vertices = spritesData.QuadVertices;
-
-		const uint32_t quadsCount = (uint32_t)(vertices.size() / 4);
+		const uint32_t quadsCount = (uint32_t)spritesData.Instances.size();
 		if (quadsCount == 0)
 			return;
 
-		const auto& vb = spritesData.VertexBuffer;
-		const auto& ib = spritesData.IndexBuffer;
+		const auto& vb = RenderManager::GetUnitQuadVertexBuffer();
+		const auto& ib = RenderManager::GetUnitDoubleSidedQuadIndexBuffer();
+		const auto& ivb = spritesData.InstanceBuffer;
 		const auto& transformsBuffer = m_Renderer.GetSpritesTransformsBuffer();
 
 		const glm::mat4& viewProj = m_Renderer.GetViewProjection();
@@ -291,7 +291,7 @@ namespace Eagle
 
 		cmd->BeginGraphics(m_SpritesDepthPipeline);
 		cmd->SetGraphicsRootConstants(&viewProj[0][0], &viewportSize);
-		cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+		cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 		cmd->EndGraphics();
 	}
 
@@ -390,13 +390,13 @@ namespace Eagle
 
 	void TransparencyTask::RenderSpritesColor(const Ref<CommandBuffer>& cmd, const SpriteGeometryData& spritesData)
 	{
-		const auto& vertices = spritesData.QuadVertices;
-
-		if (vertices.empty())
+		const uint32_t quadsCount = (uint32_t)spritesData.Instances.size();
+		if (quadsCount == 0)
 			return;
 
-		const auto& vb = spritesData.VertexBuffer;
-		const auto& ib = spritesData.IndexBuffer;
+		const auto& vb = RenderManager::GetUnitQuadVertexBuffer();
+		const auto& ib = RenderManager::GetUnitDoubleSidedQuadIndexBuffer();
+		const auto& ivb = spritesData.InstanceBuffer;
 		const auto& transformsBuffer = m_Renderer.GetSpritesTransformsBuffer();
 
 		const glm::mat4& viewProj = m_Renderer.GetViewProjection();
@@ -428,15 +428,13 @@ namespace Eagle
 		m_SpritesColorPipeline->SetImageSamplerArray(m_Renderer.GetPointLightShadowMaps(), m_Renderer.GetPointLightShadowMapsSamplers(), 3, 0);
 		m_SpritesColorPipeline->SetImageSamplerArray(m_Renderer.GetSpotLightShadowMaps(), m_Renderer.GetSpotLightShadowMapsSamplers(), 4, 0);
 
-		const uint32_t quadsCount = (uint32_t)(vertices.size() / 4);
-
 		auto& stats = m_Renderer.GetStats2D();
 		++stats.DrawCalls;
 		stats.QuadCount += quadsCount;
 
 		cmd->BeginGraphics(m_SpritesColorPipeline);
 		cmd->SetGraphicsRootConstants(&viewProj[0][0], &m_ColorPushData);
-		cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+		cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 		cmd->EndGraphics();
 	}
 
@@ -557,16 +555,15 @@ namespace Eagle
 			const SpriteGeometryData* spritesDatas[2] = { &m_Renderer.GetTranslucentSpritesData(), &m_Renderer.GetTranslucentNotCastingShadowSpriteData() };
 			for (const auto& spritesData : spritesDatas)
 			{
-				const auto& vertices = spritesData->QuadVertices;
-
-				if (!vertices.empty())
+				const uint32_t quadsCount = (uint32_t)spritesData->Instances.size();
+				if (quadsCount != 0)
 				{
 					const auto& transformsBuffer = m_Renderer.GetSpritesTransformsBuffer();
 					m_SpritesEntityIDPipeline->SetBuffer(transformsBuffer, 0, 0);
 
-					const auto& vb = spritesData->VertexBuffer;
-					const auto& ib = spritesData->IndexBuffer;
-					const uint32_t quadsCount = (uint32_t)(vertices.size() / 4);
+					const auto& vb = RenderManager::GetUnitQuadVertexBuffer();
+					const auto& ib = RenderManager::GetUnitDoubleSidedQuadIndexBuffer();
+					const auto& ivb = spritesData->InstanceBuffer;
 
 					auto& stats = m_Renderer.GetStats2D();
 					++stats.DrawCalls;
@@ -574,7 +571,7 @@ namespace Eagle
 
 					cmd->BeginGraphics(m_SpritesEntityIDPipeline);
 					cmd->SetGraphicsRootConstants(&viewProj[0][0], nullptr);
-					cmd->DrawIndexed(vb, ib, quadsCount * 6, 0, 0);
+					cmd->DrawIndexedInstanced(vb, ib, RenderManager::UnitDoubleSidedQuadIndexCount, 0, 0, quadsCount, 0, ivb);
 					cmd->EndGraphics();
 				}
 			}
@@ -699,6 +696,7 @@ namespace Eagle
 		state.FragmentShader = m_TransparencyColorShader;
 		state.ColorAttachments.push_back(attachment);
 		state.DepthStencilAttachment = depthAttachment;
+		state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 		state.CullMode = CullMode::Back;
 
 		ShaderSpecializationInfo constants;
@@ -831,6 +829,7 @@ namespace Eagle
 		state.FragmentShader = ShaderLibrary::GetOrLoad("assets/shaders/transparency/transparency_entityID.frag", ShaderType::Fragment);
 		state.ColorAttachments.push_back(objectIDAttachment);
 		state.DepthStencilAttachment = depthAttachment;
+		state.PerInstanceAttribs = RenderSpritesTask::PerInstanceAttribs;
 		state.CullMode = CullMode::None;
 
 		m_SpritesEntityIDPipeline = PipelineGraphics::Create(state);
@@ -24,6 +24,25 @@ namespace Eagle
 		m_VolumetricsImage = Image::Create(specs, "PBR_Volumetric");
 		m_VolumetricsImageBlurred = Image::Create(specs, "PBR_Volumetric_Blurred");
 
+		ImageSpecifications froxelSpecs;
+		froxelSpecs.Format = ImageFormat::R16G16B16A16_Float;
+		froxelSpecs.Size = GetFroxelGridSize(glm::uvec2(size));
+		froxelSpecs.Type = ImageType::Type3D;
+		froxelSpecs.Usage = ImageUsage::Sampled | ImageUsage::Storage;
+		m_FroxelScattering[0] = Image::Create(froxelSpecs, "Volumetric_Froxel_Scattering_0");
+		m_FroxelScattering[1] = Image::Create(froxelSpecs, "Volumetric_Froxel_Scattering_1");
+		m_FroxelIntegrated = Image::Create(froxelSpecs, "Volumetric_Froxel_Integrated");
+
+		BufferSpecifications froxelDataSpecs;
+		froxelDataSpecs.Size = sizeof(FroxelData);
+		froxelDataSpecs.Usage = BufferUsage::TransferDst | BufferUsage::UniformBuffer;
+		m_FroxelDataBuffer = Buffer::Create(froxelDataSpecs, "Volumetric_Froxel_Data");
+
+		BufferSpecifications froxelLightsSpecs;
+		froxelLightsSpecs.Size = sizeof(glm::uvec2) * 64;
+		froxelLightsSpecs.Usage = BufferUsage::TransferDst | BufferUsage::StorageBuffer;
+		m_FroxelLightsBuffer = Buffer::Create(froxelLightsSpecs, "Volumetric_Froxel_Lights");
+
 		const auto& options = m_Renderer.GetOptions();
 		m_VolumetricSettings = options.VolumetricSettings;
 		m_Constants.VolumetricSamples = m_VolumetricSettings.Samples;
@@ -38,14 +57,23 @@ namespace Eagle
 		EG_GPU_TIMING_SCOPED(cmd, "Volumetric Light Pass");
 		EG_CPU_TIMING_SCOPED("Volumetric Light Pass");
 
+		const Timestep ts = Application::Get().GetTimestep();
+		m_Time += ts * m_VolumetricSettings.FogSpeed;
+
+		if (m_VolumetricSettings.Method == VolumetricLightsMethod::Froxels)
+			RecordFroxels(cmd);
+		else
+			RecordRayMarching(cmd);
+	}
+
+	void VolumetricLightTask::RecordRayMarching(const Ref<CommandBuffer>& cmd)
+	{
 		constexpr uint32_t tileSize = 8;
 		const glm::uvec2 size = m_ResultImage->GetSize();
 		const glm::uvec2 numGroups = { glm::ceil(size.x / float(tileSize)), glm::ceil(size.y / float(tileSize)) };
 
 		const glm::uvec2 halfSize = m_VolumetricsImage->GetSize();
 		const glm::uvec2 halfNumGroups = { glm::ceil(halfSize.x / float(tileSize)), glm::ceil(halfSize.y / float(tileSize)) };
-		const Timestep ts = Application::Get().GetTimestep();
-		m_Time += ts * m_VolumetricSettings.FogSpeed;
 
 		struct PushDataVol
 		{
@@ -155,11 +183,228 @@ namespace Eagle
 		cmd->TransitionLayout(m_ResultImage, m_ResultImage->GetLayout(), ImageReadAccess::PixelShaderRead);
 	}
 
+	void VolumetricLightTask::RecordFroxels(const Ref<CommandBuffer>& cmd)
+	{
+		CullFroxelLights();
+
+		constexpr uint32_t tileSize = 8;
+		constexpr uint32_t froxelTileSize = 4;
+		constexpr uint32_t jitterSize = 8;
+
+		const glm::uvec2 size = m_ResultImage->GetSize();
+		const glm::uvec2 renderSize = m_Renderer.GetRenderSize(); // Only this part is used if dynamic resolution is enabled
+		const glm::uvec2 numGroups = { glm::ceil(renderSize.x / float(tileSize)), glm::ceil(renderSize.y / float(tileSize)) };
+
+		const glm::uvec3 gridSize = m_FroxelIntegrated->GetSize();
+		const glm::uvec3 froxelNumGroups = glm::uvec3(glm::ceil(glm::vec3(gridSize) / float(froxelTileSize)));
+		const glm::uvec2 integrateNumGroups = { glm::ceil(gridSize.x / float(tileSize)), glm::ceil(gridSize.y / float(tileSize)) };
+
+		const uint32_t historyIndex = 1u - m_FroxelHistoryIndex;
+		Ref<Image>& scattering = m_FroxelScattering[m_FroxelHistoryIndex];
+		Ref<Image>& history = m_FroxelScattering[historyIndex];
+
+		{
+			const float maxShadowDistance = m_Renderer.GetShadowMaxDistance();
+
+			FroxelData data;
+			data.ViewProjInv = glm::inverse(m_Renderer.GetViewProjection());
+			data.PrevViewProj = m_Renderer.GetPrevViewProjection();
+			data.CameraPos = m_Renderer.GetViewPosition();
+			data.MaxDistance = glm::max(m_VolumetricSettings.MaxScatteringDistance, EG_FROXEL_NEAR * 2.f);
+			data.PrevCameraPos = glm::vec3(glm::inverse(m_Renderer.GetPrevViewMatrix())[3]);
+			data.Time = m_Time;
+			data.GridSize = gridSize;
+			data.MaxShadowDistance2 = maxShadowDistance * maxShadowDistance;
+			data.RenderScale = m_Renderer.GetRenderScale();
+			data.PrevRenderScale = m_Renderer.GetPrevRenderScale();
+			data.JitterZ = CreateHaltonSequence(uint32_t(RenderManager::GetFrameNumber() % jitterSize) + 1u, 2) - 0.5f;
+			data.bHistoryValid = uint32_t(bFroxelHistoryValid);
+			data.PointLightsCount = m_FroxelPointLightsCount;
+			data.SpotLightsCount = m_FroxelSpotLightsCount;
+			data.bHasDirLight = uint32_t(m_Renderer.HasDirectionalLight());
+
+			cmd->Write(m_FroxelDataBuffer, &data, sizeof(FroxelData), 0, BufferLayoutType::Unknown, BufferReadAccess::Uniform);
+			cmd->Barrier(m_FroxelDataBuffer);
+
+			const size_t lightsDataSize = m_FroxelLights.size() * sizeof(glm::uvec2);
+			if (lightsDataSize > m_FroxelLightsBuffer->GetSize())
+				m_FroxelLightsBuffer->Resize((lightsDataSize * 3) / 2);
+
+			if (lightsDataSize)
+			{
+				cmd->Write(m_FroxelLightsBuffer, m_FroxelLights.data(), lightsDataSize, 0, BufferLayoutType::Unknown, BufferLayoutType::StorageBuffer);
+				cmd->StorageBufferBarrier(m_FroxelLightsBuffer);
+			}
+		}
+
+		const auto& gbuffer = m_Renderer.GetGBuffer();
+
+		{
+			EG_GPU_TIMING_SCOPED(cmd, "Volumetric Froxels Inject");
+			EG_CPU_TIMING_SCOPED("Volumetric Froxels Inject");
+
+			m_FroxelInjectPipeline->SetImage(scattering, 0, 0);
+			m_FroxelInjectPipeline->SetImageSampler(history, Sampler::BilinearSamplerClamp, 0, 1);
+			m_FroxelInjectPipeline->SetBuffer(m_FroxelDataBuffer, 0, 2);
+			m_FroxelInjectPipeline->SetBuffer(m_FroxelLightsBuffer, 0, 3);
+			m_FroxelInjectPipeline->SetBuffer(m_Renderer.GetPointLightsBuffer(), EG_SCENE_SET, 0);
+			m_FroxelInjectPipeline->SetBuffer(m_Renderer.GetSpotLightsBuffer(), EG_SCENE_SET, 1);
+			m_FroxelInjectPipeline->SetBuffer(m_Renderer.GetDirectionalLightBuffer(), EG_SCENE_SET, 2);
+			m_FroxelInjectPipeline->SetBuffer(m_Renderer.GetCameraBuffer(), EG_SCENE_SET, 3);
+			m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetDirectionalLightShadowMaps(), m_Renderer.GetDirectionalLightShadowMapsSamplers(), 2, 0);
+			m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetPointLightShadowMaps(), m_Renderer.GetPointLightShadowMapsSamplers(), 3, 0);
+			m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetSpotLightShadowMaps(), m_Renderer.GetSpotLightShadowMapsSamplers(), 4, 0);
+
+			if (bTranslucentShadows)
+			{
+				m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetDirectionalLightShadowMapsColored(), m_Renderer.GetDirectionalLightShadowMapsSamplers(), 5, 0);
+				m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetPointLightShadowMapsColored(), m_Renderer.GetPointLightShadowMapsSamplers(), 6, 0);
+				m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetSpotLightShadowMapsColored(), m_Renderer.GetSpotLightShadowMapsSamplers(), 7, 0);
+
+				m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetDirectionalLightShadowMapsColoredDepth(), m_Renderer.GetDirectionalLightShadowMapsSamplers(), 8, 0);
+				m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetPointLightShadowMapsColoredDepth(), m_Renderer.GetPointLightShadowMapsSamplers(), 9, 0);
+				m_FroxelInjectPipeline->SetImageSamplerArray(m_Renderer.GetSpotLightShadowMapsColoredDepth(), m_Renderer.GetSpotLightShadowMapsSamplers(), 10, 0);
+			}
+
+			// If the history is not valid, its content is never read. It still needs to be in a readable layout though
+			cmd->TransitionLayout(history, history->GetLayout(), ImageReadAccess::PixelShaderRead);
+			cmd->TransitionLayout(scattering, ImageLayoutType::Unknown, ImageLayoutType::StorageImage);
+			cmd->Dispatch(m_FroxelInjectPipeline, froxelNumGroups.x, froxelNumGroups.y, froxelNumGroups.z, nullptr);
+			cmd->TransitionLayout(scattering, ImageLayoutType::StorageImage, ImageReadAccess::PixelShaderRead);
+		}
+
+		{
+			EG_GPU_TIMING_SCOPED(cmd, "Volumetric Froxels Integrate");
+			EG_CPU_TIMING_SCOPED("Volumetric Froxels Integrate");
+
+			m_FroxelIntegratePipeline->SetImageSampler(scattering, Sampler::PointSamplerClamp, 0, 0);
+			m_FroxelIntegratePipeline->SetImage(m_FroxelIntegrated, 0, 1);
+			m_FroxelIntegratePipeline->SetBuffer(m_FroxelDataBuffer, 0, 2);
+
+			cmd->TransitionLayout(m_FroxelIntegrated, ImageLayoutType::Unknown, ImageLayoutType::StorageImage);
+			cmd->Dispatch(m_FroxelIntegratePipeline, integrateNumGroups.x, integrateNumGroups.y, 1, nullptr);
+			cmd->TransitionLayout(m_FroxelIntegrated, ImageLayoutType::StorageImage, ImageReadAccess::PixelShaderRead);
+		}
+
+		{
+			EG_GPU_TIMING_SCOPED(cmd, "Volumetric Composite");
+			EG_CPU_TIMING_SCOPED("Volumetric Composite");
+
+			struct PushDataComp
+			{
+				glm::ivec2 Size;
+				glm::vec2 TexelSize;
+			} pushDataComp;
+			pushDataComp.Size = size;
+			pushDataComp.TexelSize = 1.f / glm::vec2(size);
+
+			m_FroxelCompositePipeline->SetImageSampler(m_FroxelIntegrated, Sampler::BilinearSamplerClamp, 0, 0);
+			m_FroxelCompositePipeline->SetImageSampler(gbuffer.Depth, Sampler::PointSampler, 0, 1);
+			m_FroxelCompositePipeline->SetImage(m_ResultImage, 0, 2);
+			m_FroxelCompositePipeline->SetBuffer(m_FroxelDataBuffer, 0, 3);
+
+			cmd->TransitionLayout(m_ResultImage, m_ResultImage->GetLayout(), ImageLayoutType::StorageImage);
+			cmd->TransitionLayout(gbuffer.Depth, gbuffer.Depth->GetLayout(), ImageReadAccess::PixelShaderRead);
+			cmd->Dispatch(m_FroxelCompositePipeline, numGroups.x, numGroups.y, 1, &pushDataComp);
+			cmd->TransitionLayout(gbuffer.Depth, gbuffer.Depth->GetLayout(), ImageLayoutType::DepthStencilWrite);
+			cmd->TransitionLayout(m_ResultImage, m_ResultImage->GetLayout(), ImageReadAccess::PixelShaderRead);
+		}
+
+		m_FroxelHistoryIndex = historyIndex;
+		bFroxelHistoryValid = true;
+	}
+
+	void VolumetricLightTask::CullFroxelLights()
+	{
+		EG_CPU_TIMING_SCOPED("Volumetric. Cull Froxel Lights");
+
+		const glm::mat4& viewProj = m_Renderer.GetViewProjection();
+		const glm::vec3 cameraPos = m_Renderer.GetViewPosition();
+		const float maxDistance = m_VolumetricSettings.MaxScatteringDistance;
+
+		// Frustum planes are extracted from the rows of the view-projection matrix. Depth is in [0; 1] range
+		auto getRow = [&viewProj](int i) { return glm::vec4(viewProj[0][i], viewProj[1][i], viewProj[2][i], viewProj[3][i]); };
+		const glm::vec4 row0 = getRow(0);
+		const glm::vec4 row1 = getRow(1);
+		const glm::vec4 row2 = getRow(2);
+		const glm::vec4 row3 = getRow(3);
+		glm::vec4 planes[6] = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row2, row3 - row2 };
+		for (auto& plane : planes)
+			plane /= glm::length(glm::vec3(plane));
+
+		auto isVisible = [&](const glm::vec3& center, float radius)
+		{
+			// Froxels don't extend further than `maxDistance`
+			const glm::vec3 toLight = center - cameraPos;
+			const float reach = maxDistance + radius;
+			if (glm::dot(toLight, toLight) > reach * reach)
+				return false;
+
+			for (const auto& plane : planes)
+				if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+					return false;
+			return true;
+		};
+
+		// Shadow maps are indexed in the same order as in the shaders: every shadow casting light takes the next one,
+		// even if it's culled or not volumetric
+		m_FroxelLights.clear();
+
+		uint32_t shadowMapIndex = 0;
+		const auto& pointLights = m_Renderer.GetPointLights();
+		for (uint32_t i = 0; i < (uint32_t)pointLights.size(); ++i)
+		{
+			const auto& light = pointLights[i];
+			uint32_t lightShadowMap = EG_FROXEL_NO_SHADOW;
+			if (light.DoesCastShadows())
+			{
+				if (shadowMapIndex < EG_MAX_LIGHT_SHADOW_MAPS)
+					lightShadowMap = shadowMapIndex;
+				++shadowMapIndex;
+			}
+
+			const bool bVolumetric = std::signbit(light.VolumetricFogIntensity);
+			if (bVolumetric && isVisible(light.Position, glm::sqrt(glm::abs(light.Radius2))))
+				m_FroxelLights.emplace_back(i, lightShadowMap);
+		}
+		m_FroxelPointLightsCount = (uint32_t)m_FroxelLights.size();
+
+		shadowMapIndex = 0;
+		const auto& spotLights = m_Renderer.GetSpotLights();
+		for (uint32_t i = 0; i < (uint32_t)spotLights.size(); ++i)
+		{
+			const auto& light = spotLights[i];
+			uint32_t lightShadowMap = EG_FROXEL_NO_SHADOW;
+			if (light.bCastsShadows)
+			{
+				if (shadowMapIndex < EG_MAX_LIGHT_SHADOW_MAPS)
+					lightShadowMap = shadowMapIndex;
+				++shadowMapIndex;
+			}
+
+			if (light.bVolumetricLight && isVisible(light.Position, glm::sqrt(light.Distance2)))
+				m_FroxelLights.emplace_back(i, lightShadowMap);
+		}
+		m_FroxelSpotLightsCount = (uint32_t)m_FroxelLights.size() - m_FroxelPointLightsCount;
+	}
+
+	glm::uvec3 VolumetricLightTask::GetFroxelGridSize(glm::uvec2 size)
+	{
+		const glm::uvec2 gridSize = glm::uvec2(glm::ceil(glm::vec2(size) / float(EG_FROXEL_TILE_SIZE)));
+		return glm::uvec3(glm::max(gridSize, glm::uvec2(1u)), EG_FROXEL_SLICES);
+	}
+
 	void VolumetricLightTask::OnResize(glm::uvec2 size)
 	{
 		const glm::uvec2 halfSize = glm::max(size / 2u, glm::uvec2(1u));
 		m_VolumetricsImage->Resize(glm::uvec3(halfSize, 1u));
 		m_VolumetricsImageBlurred->Resize(glm::uvec3(halfSize, 1u));
+
+		const glm::uvec3 gridSize = GetFroxelGridSize(size);
+		m_FroxelScattering[0]->Resize(gridSize);
+		m_FroxelScattering[1]->Resize(gridSize);
+		m_FroxelIntegrated->Resize(gridSize);
+		bFroxelHistoryValid = false;
 	}
 
 	void VolumetricLightTask::InitPipeline(bool bStutterlessChanged, bool translucentShadowsChanged, bool bVolumetricFogChanged)
@@ -278,5 +523,42 @@ namespace Eagle
 			state.ComputeShader = Shader::Create("assets/shaders/guassian.comp", ShaderType::Compute);
 			m_GuassianPipeline = PipelineCompute::Create(state);
 		}
+
+		InitFroxelPipelines(translucentShadowsChanged, bVolumetricFogChanged);
+	}
+
+	void VolumetricLightTask::InitFroxelPipelines(bool translucentShadowsChanged, bool bVolumetricFogChanged)
+	{
+		ShaderDefines defines;
+		if (bTranslucentShadows)
+			defines["EG_TRANSLUCENT_SHADOWS"] = "";
+		if (m_VolumetricSettings.bFogEnable)
+			defines["EG_VOLUMETRIC_FOG"] = "";
+
+		if (m_FroxelInjectPipeline)
+		{
+			if (translucentShadowsChanged || bVolumetricFogChanged)
+				m_FroxelInjectPipeline->GetState().ComputeShader->SetDefines(defines);
+		}
+		else
+		{
+			PipelineComputeState state;
+			state.ComputeShader = Shader::Create("assets/shaders/volumetric_froxel_inject.comp", ShaderType::Compute, defines);
+			m_FroxelInjectPipeline = PipelineCompute::Create(state);
+		}
+
+		if (!m_FroxelIntegratePipeline)
+		{
+			PipelineComputeState state;
+			state.ComputeShader = Shader::Create("assets/shaders/volumetric_froxel_integrate.comp", ShaderType::Compute);
+			m_FroxelIntegratePipeline = PipelineCompute::Create(state);
+		}
+
+		if (!m_FroxelCompositePipeline)
+		{
+			PipelineComputeState state;
+			state.ComputeShader = Shader::Create("assets/shaders/volumetric_froxel_composite.comp", ShaderType::Compute);
+			m_FroxelCompositePipeline = PipelineCompute::Create(state);
+		}
 	}
 }
@@ -20,6 +20,10 @@ namespace Eagle
 			bool bVolumetricFogChanged = false;
 			if (m_VolumetricSettings != settings.VolumetricSettings)
 			{
+				if (m_VolumetricSettings.Method != settings.VolumetricSettings.Method ||
+					m_VolumetricSettings.MaxScatteringDistance != settings.VolumetricSettings.MaxScatteringDistance)
+					bFroxelHistoryValid = false;
+
 				bReloadPipeline |= m_VolumetricSettings.Samples != settings.VolumetricSettings.Samples;
 				bVolumetricFogChanged = m_VolumetricSettings.bFogEnable != settings.VolumetricSettings.bFogEnable;
 				bReloadPipeline |= bVolumetricFogChanged;
@@ -57,6 +61,41 @@ namespace Eagle
 
 	private:
 		void InitPipeline(bool bStutterlessChanged, bool translucentShadowsChanged, bool bVolumetricFogChanged);
+		void InitFroxelPipelines(bool translucentShadowsChanged, bool bVolumetricFogChanged);
+
+		void RecordRayMarching(const Ref<CommandBuffer>& cmd);
+		void RecordFroxels(const Ref<CommandBuffer>& cmd);
+
+		// Selects volumetric lights that can affect the froxel volume and assigns them their shadow maps
+		void CullFroxelLights();
+
+		static glm::uvec3 GetFroxelGridSize(glm::uvec2 size);
+
+		// Matches `FroxelData` in `volumetric_froxel_utils.h`
+		struct FroxelData
+		{
+			glm::mat4 ViewProjInv;
+			glm::mat4 PrevViewProj;
+
+			glm::vec3 CameraPos;
+			float MaxDistance;
+
+			glm::vec3 PrevCameraPos;
+			float Time;
+
+			glm::uvec3 GridSize;
+			float MaxShadowDistance2;
+
+			float RenderScale;
+			float PrevRenderScale;
+			float JitterZ;
+			uint32_t bHistoryValid;
+
+			uint32_t PointLightsCount;
+			uint32_t SpotLightsCount;
+			uint32_t bHasDirLight;
+			uint32_t unused = 0;
+		};
 
 		struct ConstantData
 		{
@@ -89,7 +128,21 @@ namespace Eagle
 		VolumetricLightsSettings m_VolumetricSettings;
 		Ref<Image> m_VolumetricsImage; // Volumetric effect is rendered separately into here. Half res
 		Ref<Image> m_VolumetricsImageBlurred;
-		
+
+		// Froxels
+		Ref<PipelineCompute> m_FroxelInjectPipeline;
+		Ref<PipelineCompute> m_FroxelIntegratePipeline;
+		Ref<PipelineCompute> m_FroxelCompositePipeline;
+		Ref<Image> m_FroxelScattering[2]; // Ping-ponged, previous one is used as a history
+		Ref<Image> m_FroxelIntegrated;
+		Ref<Buffer> m_FroxelDataBuffer;
+		Ref<Buffer> m_FroxelLightsBuffer;
+		std::vector<glm::uvec2> m_FroxelLights; // x - light index, y - shadow map index or `EG_FROXEL_NO_SHADOW`. Point lights first
+		uint32_t m_FroxelPointLightsCount = 0;
+		uint32_t m_FroxelSpotLightsCount = 0;
+		uint32_t m_FroxelHistoryIndex = 0;
+		bool bFroxelHistoryValid = false;
+
 		float m_Time = 0.0;
 		bool bStutterlessShaders = false;
 		bool bTranslucentShadows = false;
@@ -2,6 +2,7 @@
 #include "Buffer.h"
 #include "Eagle/Renderer/RendererContext.h"
 #include "Platform/Vulkan/VulkanBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace Eagle
 {
@@ -12,6 +13,7 @@ namespace Eagle
 		switch (RendererContext::Current())
 		{
 			case RendererAPIType::Vulkan: return MakeRef<VulkanBuffer>(specs, debugName);
+			case RendererAPIType::Null: return MakeRef<NullBuffer>(specs, debugName);
 		}
 
 		EG_CORE_ASSERT(false, "Unknown renderer API");
@@ -34,6 +34,7 @@ namespace Eagle
 		MemoryType GetMemoryType() const { return m_Specs.MemoryType; }
 		BufferUsage GetUsage() const { return m_Specs.Usage; }
 		BufferLayout GetLayout() const { return m_Specs.Layout; }
+		uint64_t GetResourceID() const { return m_ResourceID; }
 
 		bool HasUsage(BufferUsage usage) const { return HasFlags(m_Specs.Usage, usage); }
 
@@ -47,8 +48,10 @@ namespace Eagle
 	protected:
 		BufferSpecifications m_Specs;
 		std::string m_DebugName;
+		uint64_t m_ResourceID = GenerateRenderResourceID(); // Regenerated when the buffer is recreated
 
 		friend class VulkanCommandManager;
 		friend class VulkanCommandBuffer;
+		friend class NullCommandBuffer;
 	};
 }
@@ -2,6 +2,7 @@
 #include "DescriptorManager.h"
 #include "Eagle/Renderer/RendererContext.h"
 #include "Platform/Vulkan/VulkanDescriptorManager.h"
+#include "Platform/Null/NullDescriptorManager.h"
 
 namespace Eagle
 {
@@ -10,6 +11,7 @@ namespace Eagle
 		switch (RendererContext::Current())
 		{
 			case RendererAPIType::Vulkan: return VulkanDescriptorManager::WriteDescriptors(pipeline, writeDatas);
+			case RendererAPIType::Null: return NullDescriptorManager::WriteDescriptors(pipeline, writeDatas);
 		}
 
 		EG_CORE_ASSERT(false, "Unknown renderer API");
@@ -23,6 +25,7 @@ namespace Eagle
 		switch (RendererContext::Current())
 		{
 			case RendererAPIType::Vulkan: return MakeRef<VulkanDescriptorManager>(numDescriptors, maxSets);
+			case RendererAPIType::Null: return MakeRef<NullDescriptorManager>(numDescriptors, maxSets);
 		}
 
 		EG_CORE_ASSERT(false, "Unknown renderer API");
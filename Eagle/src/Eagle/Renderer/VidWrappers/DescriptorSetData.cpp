@@ -189,4 +189,28 @@ namespace Eagle
             m_bDirty = true;
         }
     }
+
+    size_t DescriptorSetData::GetHash() const
+    {
+        // `m_Bindings` is unordered, so hashes of separate bindings are summed up
+        size_t result = 0;
+        for (auto& [idx, binding] : m_Bindings)
+        {
+            size_t bindingHash = std::hash<uint32_t>()(idx);
+            for (auto& image : binding.ImageBindings)
+            {
+                HashCombine(bindingHash, image.ImageID);
+                HashCombine(bindingHash, image.ImageViewHandle);
+                HashCombine(bindingHash, image.SamplerID);
+            }
+            for (auto& buffer : binding.BufferBindings)
+            {
+                HashCombine(bindingHash, buffer.BufferID);
+                HashCombine(bindingHash, buffer.Offset);
+                HashCombine(bindingHash, buffer.Range);
+            }
+            result += bindingHash;
+        }
+        return result;
+    }
 }
@@ -12,27 +12,42 @@ namespace Eagle
 	{
 		// Additional Structs
 	public:
+		// Resources are compared by their IDs rather than by API handles. Handles of destroyed resources can be reused by new ones,
+		// and a cached descriptor set would match the new resource while still referencing the destroyed one
 		struct ImageBinding
 		{
 			void* ImageHandle = nullptr;
 			void* ImageViewHandle = nullptr;
 			void* SamplerHandle = nullptr;
+			uint64_t ImageID = 0;
+			uint64_t SamplerID = 0;
 
 			ImageBinding() = default;
-			ImageBinding(const Ref<Eagle::Image>& image) : ImageHandle(image->GetHandle()), ImageViewHandle(image->GetImageViewHandle()) {}
-			ImageBinding(const Ref<Eagle::Image>& image, const ImageView& view) : ImageHandle(image->GetHandle()), ImageViewHandle(image->GetImageViewHandle(view)) {}
+			ImageBinding(const Ref<Eagle::Image>& image)
+				: ImageHandle(image->GetHandle())
+				, ImageViewHandle(image->GetImageViewHandle())
+				, ImageID(image->GetResourceID()) {}
+			ImageBinding(const Ref<Eagle::Image>& image, const ImageView& view)
+				: ImageHandle(image->GetHandle())
+				, ImageViewHandle(image->GetImageViewHandle(view))
+				, ImageID(image->GetResourceID()) {}
 			ImageBinding(const Ref<Eagle::Image>& image, const ImageView& view, const Ref<Eagle::Sampler>& sampler)
 				: ImageHandle(image->GetHandle())
 				, ImageViewHandle(image->GetImageViewHandle(view))
-				, SamplerHandle(sampler ? sampler->GetHandle() : nullptr) {}
+				, SamplerHandle(sampler ? sampler->GetHandle() : nullptr)
+				, ImageID(image->GetResourceID())
+				, SamplerID(sampler ? sampler->GetResourceID() : 0) {}
 			ImageBinding(const Ref<Eagle::Image>& image, const Ref<Eagle::Sampler>& sampler)
 				: ImageHandle(image->GetHandle())
 				, ImageViewHandle(image->GetImageViewHandle())
-				, SamplerHandle(sampler ? sampler->GetHandle() : nullptr) {}
+				, SamplerHandle(sampler ? sampler->GetHandle() : nullptr)
+				, ImageID(image->GetResourceID())
+				, SamplerID(sampler ? sampler->GetResourceID() : 0) {}
 
+			// Views are owned by the image and live as long as its ID, so their handles can be compared
 			bool operator!=(const ImageBinding& other) const
 			{
-				return ImageHandle != other.ImageHandle || ImageViewHandle != other.ImageViewHandle || SamplerHandle != other.SamplerHandle;
+				return ImageID != other.ImageID || ImageViewHandle != other.ImageViewHandle || SamplerID != other.SamplerID;
 			}
 
 			friend bool operator!=(const std::vector<ImageBinding>& left, const std::vector<ImageBinding>& right)
@@ -55,16 +70,17 @@ namespace Eagle
 			void* BufferViewHandle = nullptr;
 			size_t Offset = 0;
 			size_t Range = size_t(-1);
+			uint64_t BufferID = 0;
 
 			BufferBinding() = default;
 			BufferBinding(const Ref<Eagle::Buffer>& buffer)
-				: BufferHandle(buffer->GetHandle()), BufferViewHandle(buffer->GetViewHandle()) {}
+				: BufferHandle(buffer->GetHandle()), BufferViewHandle(buffer->GetViewHandle()), BufferID(buffer->GetResourceID()) {}
 			BufferBinding(const Ref<Eagle::Buffer>& buffer, size_t offset, size_t range)
-				: BufferHandle(buffer->GetHandle()), BufferViewHandle(buffer->GetViewHandle()), Offset(offset), Range(range) {}
+				: BufferHandle(buffer->GetHandle()), BufferViewHandle(buffer->GetViewHandle()), Offset(offset), Range(range), BufferID(buffer->GetResourceID()) {}
 
 			bool operator != (const BufferBinding& other) const
 			{
-				return BufferHandle != other.BufferHandle || Offset != other.Offset || Range != other.Range;
+				return BufferID != other.BufferID || Offset != other.Offset || Range != other.Range;
 			}
 
 			friend bool operator!=(const std::vector<BufferBinding>& left, const std::vector<BufferBinding>& right)
@@ -85,6 +101,11 @@ namespace Eagle
 		{
 			std::vector<ImageBinding> ImageBindings = { {} };
 			std::vector<BufferBinding> BufferBindings = { {} };
+
+			bool operator==(const Binding& other) const
+			{
+				return !(ImageBindings != other.ImageBindings) && !(BufferBindings != other.BufferBindings);
+			}
 		};
 
 	public:
@@ -94,6 +115,9 @@ namespace Eagle
 		void MakeDirty() { m_bDirty = true; }
 		void OnFlushed() { m_bDirty = false; }
 
+		// Hash of the bound resources. Doesn't depend on the order in which bindings were set
+		size_t GetHash() const;
+
 		void SetArg(uint32_t idx, const Ref<Buffer>& buffer);
 		void SetArg(uint32_t idx, const Ref<Buffer>& buffer, std::size_t offset, std::size_t size);
 		void SetArgArray(uint32_t idx, const std::vector<Ref<Buffer>>& buffers);
@@ -2,6 +2,7 @@
 #include "Fence.h"
 
 #include "Platform/Vulkan/VulkanFence.h"
+#include "Platform/Null/NullFence.h"
 
 namespace Eagle
 {
@@ -10,6 +11,7 @@ namespace Eagle
 		switch (RendererContext::Current())
 		{
 			case RendererAPIType::Vulkan: return MakeRef<VulkanFence>(bSignaled);
+			case RendererAPIType::Null: return MakeRef<NullFence>(bSignaled);
 		}
 
 		EG_CORE_ASSERT(false, "Unknown renderer API");
@@ -3,6 +3,7 @@
 
 #include "Eagle/Renderer/RenderManager.h"
 #include "Platform/Vulkan/VulkanFramebuffer.h"
+#include "Platform/Null/NullFramebuffer.h"
 
 namespace Eagle
 {
@@ -12,6 +13,8 @@ namespace Eagle
 		{
 			case RendererAPIType::Vulkan:
 				return MakeRef<VulkanFramebuffer>(images, size, renderPassHandle);
+			case RendererAPIType::Null:
+				return MakeRef<NullFramebuffer>(images, size, renderPassHandle);
 		}
 		EG_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
@@ -23,6 +26,8 @@ namespace Eagle
 		{
 		case RendererAPIType::Vulkan:
 			return MakeRef<VulkanFramebuffer>(image, imageView, size, renderPassHandle);
+		case RendererAPIType::Null:
+			return MakeRef<NullFramebuffer>(image, imageView, size, renderPassHandle);
 		}
 		EG_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
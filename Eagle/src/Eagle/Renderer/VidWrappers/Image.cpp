@@ -3,6 +3,7 @@
 
 #include "RenderCommandManager.h"
 #include "Platform/Vulkan/VulkanImage.h"
+#include "Platform/Null/NullImage.h"
 
 namespace Eagle
 {
@@ -17,6 +18,8 @@ namespace Eagle
         {
             case RendererAPIType::Vulkan: result = MakeRef<VulkanImage>(specs, debugName);
                 break;
+            case RendererAPIType::Null: result = MakeRef<NullImage>(specs, debugName);
+                break;
             default:
             EG_CORE_ASSERT(false, "Unknown renderer API");
             return result;
@@ -55,6 +55,7 @@ namespace Eagle
         uint32_t GetLayersCount() const { return m_Specs.bIsCube ? 6 : 1; }
         bool IsCube() const { return m_Specs.bIsCube; }
         const std::string& GetDebugName() const { return m_DebugName; }
+        uint64_t GetResourceID() const { return m_ResourceID; }
 
         virtual void Resize(const glm::uvec3& size) = 0;
         [[nodiscard]] virtual void* Map() = 0;
@@ -78,9 +79,11 @@ namespace Eagle
     protected:
         ImageSpecifications m_Specs;
         std::string m_DebugName;
+        uint64_t m_ResourceID = GenerateRenderResourceID(); // Regenerated when the image is recreated
         bool bCalculateMipsCountInternally = false;
 
         friend class VulkanCommandManager;
         friend class VulkanCommandBuffer;
+        friend class NullCommandBuffer;
     };
 }
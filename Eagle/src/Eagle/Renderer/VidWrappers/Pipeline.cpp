@@ -80,12 +80,63 @@ namespace Eagle
 		m_DescriptorSetData[RenderManager::GetCurrentFrameIndex()][set].SetArgArray(binding, images, imageViews, samplers);
 	}
 
-	Ref<DescriptorSet>& Pipeline::AllocateDescriptorSet(uint32_t set)
-	{
-		auto& desciptorSet = m_DescriptorSets[RenderManager::GetCurrentFrameIndex()];
-		assert(desciptorSet.find(set) == desciptorSet.end()); // Should not be present
-		Ref<DescriptorSet>& nonInitializedSet = desciptorSet[set];
-		nonInitializedSet = RenderManager::GetDescriptorSetManager()->AllocateDescriptorSet(shared_from_this(), set);
-		return nonInitializedSet;
+	const Ref<DescriptorSet>& Pipeline::GetOrAllocateDescriptorSet(uint32_t set, const DescriptorSetData& data, bool& bAllocated)
+	{
+		const uint64_t frameNumber = RenderManager::GetFrameNumber();
+		const size_t hash = data.GetHash();
+		auto& setCache = m_DescriptorSetsCache[set];
+
+		// Bindless sets are huge and usually only grow, so the old ones are not kept around
+		if (IsBindlessSet(set) && setCache.find(hash) == setCache.end())
+		{
+			for (auto it = setCache.begin(); it != setCache.end(); )
+			{
+				if (it->second.DescriptorSet.use_count() == 1)
+					it = setCache.erase(it);
+				else
+					++it;
+			}
+		}
+
+		auto& cachedSet = setCache[hash];
+
+		bAllocated = !cachedSet.DescriptorSet || (cachedSet.Bindings != data.GetBindings());
+		if (bAllocated)
+		{
+			// If it was a collision, the previous set stays alive while it's referenced
+			cachedSet.DescriptorSet = RenderManager::GetDescriptorSetManager()->AllocateDescriptorSet(shared_from_this(), set);
+			cachedSet.Bindings = data.GetBindings();
+		}
+		cachedSet.LastUsedFrame = frameNumber;
+
+		return cachedSet.DescriptorSet;
+	}
+
+	void Pipeline::ReleaseStaleDescriptorSets()
+	{
+		const uint64_t frameNumber = RenderManager::GetFrameNumber();
+		if (m_LastReleaseFrame == frameNumber)
+			return;
+
+		m_LastReleaseFrame = frameNumber;
+		for (auto& [set, cache] : m_DescriptorSetsCache)
+		{
+			for (auto it = cache.begin(); it != cache.end(); )
+			{
+				// Sets that are still referenced by `m_DescriptorSets` are in use even if their data didn't change
+				const bool bStale = (it->second.LastUsedFrame + RendererConfig::DescriptorSetLifetime < frameNumber) && (it->second.DescriptorSet.use_count() == 1);
+				if (bStale)
+					it = cache.erase(it);
+				else
+					++it;
+			}
+		}
+	}
+
+	void Pipeline::ClearDescriptorSets()
+	{
+		for (auto& perFrameData : m_DescriptorSets)
+			perFrameData.clear();
+		m_DescriptorSetsCache.clear();
 	}
 }
@@ -34,15 +34,35 @@ namespace Eagle
 
 		virtual void* GetPipelineHandle() const = 0;
 		virtual void* GetPipelineLayoutHandle() const = 0;
+		virtual bool IsBindlessSet(uint32_t set) const = 0;
 
 		const std::unordered_map<uint32_t, DescriptorSetData>& GetDescriptorSetsData() const { return m_DescriptorSetData[RenderManager::GetCurrentFrameIndex()]; }
 		std::unordered_map<uint32_t, DescriptorSetData>& GetDescriptorSetsData() { return m_DescriptorSetData[RenderManager::GetCurrentFrameIndex()]; }
 		const std::unordered_map<uint32_t, Ref<DescriptorSet>>& GetDescriptorSets() const { return m_DescriptorSets[RenderManager::GetCurrentFrameIndex()]; }
+		std::unordered_map<uint32_t, Ref<DescriptorSet>>& GetDescriptorSets() { return m_DescriptorSets[RenderManager::GetCurrentFrameIndex()]; }
 
-		Ref<DescriptorSet>& AllocateDescriptorSet(uint32_t set);
+		// Returns a descriptor set that has the same resources bound as `data`. If there's no such set, a new one is allocated
+		// and `bAllocated` is set to true. In that case, it needs to be written
+		const Ref<DescriptorSet>& GetOrAllocateDescriptorSet(uint32_t set, const DescriptorSetData& data, bool& bAllocated);
+
+		// Frees cached descriptor sets that weren't used for `RendererConfig::DescriptorSetLifetime` frames. Does nothing if it was already called this frame
+		void ReleaseStaleDescriptorSets();
+
+	protected:
+		// Should be called when the pipeline layout is recreated
+		void ClearDescriptorSets();
 
 	protected:
+		struct CachedDescriptorSet
+		{
+			Ref<DescriptorSet> DescriptorSet;
+			std::unordered_map<uint32_t, DescriptorSetData::Binding> Bindings; // To resolve hash collisions
+			uint64_t LastUsedFrame = 0;
+		};
+
 		std::array<std::unordered_map<uint32_t, DescriptorSetData>, RendererConfig::FramesInFlight> m_DescriptorSetData; // Set -> Data
 		std::array<std::unordered_map<uint32_t, Ref<DescriptorSet>>, RendererConfig::FramesInFlight> m_DescriptorSets; // Set -> DescriptorSet
+		std::unordered_map<uint32_t, std::unordered_map<size_t, CachedDescriptorSet>> m_DescriptorSetsCache; // Set -> (Bindings hash -> DescriptorSet)
+		uint64_t m_LastReleaseFrame = uint64_t(-1);
 	};
 }
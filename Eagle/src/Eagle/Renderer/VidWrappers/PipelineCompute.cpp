@@ -4,6 +4,7 @@
 #include "Eagle/Renderer/RenderManager.h"
 
 #include "Platform/Vulkan/VulkanPipelineCompute.h"
+#include "Platform/Null/NullPipelineCompute.h"
 
 namespace Eagle
 {
@@ -15,6 +16,8 @@ namespace Eagle
 		{
 			case RendererAPIType::Vulkan: result = MakeRef<VulkanPipelineCompute>(state, parentPipeline);
 				break;
+			case RendererAPIType::Null: result = MakeRef<NullPipelineCompute>(state, parentPipeline);
+				break;
 			default:
 				EG_CORE_ASSERT(false, "Unknown API");
 		}
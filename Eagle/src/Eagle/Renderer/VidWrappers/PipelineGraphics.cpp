@@ -3,6 +3,7 @@
 
 #include "Eagle/Renderer/RenderManager.h"
 #include "Platform/Vulkan/VulkanPipelineGraphics.h"
+#include "Platform/Null/NullPipelineGraphics.h"
 
 namespace Eagle
 {
@@ -13,6 +14,8 @@ namespace Eagle
 		{
 			case RendererAPIType::Vulkan: result = MakeRef<VulkanPipelineGraphics>(state, parentPipeline);
 				break;
+			case RendererAPIType::Null: result = MakeRef<NullPipelineGraphics>(state, parentPipeline);
+				break;
 			default:
 				EG_CORE_ASSERT(false, "Unknown API");
 		}
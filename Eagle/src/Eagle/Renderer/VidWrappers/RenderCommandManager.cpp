@@ -3,6 +3,7 @@
 
 #include "Eagle/Renderer/RenderManager.h"
 #include "Platform/Vulkan/VulkanCommandManager.h"
+#include "Platform/Null/NullCommandManager.h"
 
 namespace Eagle
 {
@@ -11,6 +12,7 @@ namespace Eagle
 		switch (RenderManager::GetAPI())
 		{
 			case RendererAPIType::Vulkan:  return MakeRef<VulkanCommandManager>(queueFamily, bAllowReuse);
+			case RendererAPIType::Null:    return MakeRef<NullCommandManager>(queueFamily, bAllowReuse);
 		}
 		EG_CORE_ASSERT(false, "Unknown RendererAPI");
 		return nullptr;
@@ -74,6 +74,9 @@ namespace Eagle
 		virtual void Dispatch(Ref<PipelineCompute>& pipeline, uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ, const void* pushConstants = nullptr) = 0;
 
 		virtual void BeginGraphics(Ref<PipelineGraphics>& pipeline) = 0;
+		// Limits the render area of the following `BeginGraphics(pipeline)` calls to the top-left part of their attachments.
+		// Doesn't affect passes that use custom framebuffers. Used for rendering at a dynamic resolution
+		virtual void SetRenderAreaScale(float scale) = 0;
 		virtual void BeginGraphics(Ref<PipelineGraphics>& pipeline, const Ref<Framebuffer>& framebuffer) = 0;
 		virtual void EndGraphics() = 0;
 		virtual void Draw(uint32_t vertexCount, uint32_t firstVertex) = 0;
@@ -128,9 +131,10 @@ namespace Eagle
 
 		virtual void GenerateMips(Ref<Image>& image, ImageLayout initialLayout, ImageLayout finalLayout) = 0;
 
-#ifdef EG_GPU_TIMINGS
 		virtual void StartTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex) = 0;
 		virtual void EndTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex) = 0;
+
+#ifdef EG_GPU_TIMINGS
 		virtual void BeginMarker(std::string_view name) = 0;
 		virtual void EndMarker() = 0;
 #endif
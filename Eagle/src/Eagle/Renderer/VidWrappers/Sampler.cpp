@@ -2,6 +2,7 @@
 #include "Sampler.h"
 
 #include "Platform/Vulkan/VulkanSampler.h"
+#include "Platform/Null/NullSampler.h"
 
 namespace Eagle
 {
@@ -20,6 +21,7 @@ namespace Eagle
 		switch (RendererContext::Current())
 		{
 			case RendererAPIType::Vulkan: return MakeRef<VulkanSampler>(filterMode, addressMode, compareOp, minLod, maxLod, maxAnisotropy);
+			case RendererAPIType::Null: return MakeRef<NullSampler>(filterMode, addressMode, compareOp, minLod, maxLod, maxAnisotropy);
 		}
 
 		EG_CORE_ASSERT(false, "Unknown renderer API");
@@ -26,6 +26,7 @@ namespace Eagle
 		float GetMinLod() const { return m_MinLod; }
 		float GetMaxLod() const { return m_MaxLod; }
 		float GetMaxAnisotropy() const { return m_MaxAnisotropy; }
+		uint64_t GetResourceID() const { return m_ResourceID; }
 
 		static Ref<Sampler> Create(FilterMode filterMode, AddressMode addressMode, CompareOperation compareOp, float minLod, float maxLod, float maxAnisotropy = 1.f);
 
@@ -43,6 +44,7 @@ namespace Eagle
 		float m_MinLod = 0.f;
 		float m_MaxLod = 0.f;
 		float m_MaxAnisotropy = 1.f;
+		uint64_t m_ResourceID = GenerateRenderResourceID();
 	};
 
 }
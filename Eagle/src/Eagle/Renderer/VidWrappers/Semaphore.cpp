@@ -2,6 +2,7 @@
 #include "Semaphore.h"
 
 #include "Platform/Vulkan/VulkanSemaphore.h"
+#include "Platform/Null/NullSemaphore.h"
 
 namespace Eagle
 {
@@ -10,6 +11,7 @@ namespace Eagle
 		switch (RendererContext::Current())
 		{
 		case RendererAPIType::Vulkan: return MakeRef<VulkanSemaphore>();
+		case RendererAPIType::Null: return MakeRef<NullSemaphore>();
 		}
 
 		EG_CORE_ASSERT(false, "Unknown renderer API");
@@ -3,6 +3,7 @@
 
 #include "Eagle/Renderer/RenderManager.h"
 #include "Platform/Vulkan/VulkanShader.h"
+#include "Platform/Null/NullShader.h"
 
 namespace Eagle
 {
@@ -45,6 +46,9 @@ namespace Eagle
 			case RendererAPIType::Vulkan:
 				result = MakeRef<VulkanShader>(path, shaderType, defines);
 				break;
+			case RendererAPIType::Null:
+				result = MakeRef<NullShader>(path, shaderType, defines);
+				break;
 			default:
 				EG_CORE_ASSERT(false, "Unknown RendererAPI!");
 		}
@@ -4,6 +4,8 @@
 #include "Eagle/Renderer/RenderManager.h"
 #include "Platform/Vulkan/VulkanTexture2D.h"
 #include "Platform/Vulkan/VulkanTextureCube.h"
+#include "Platform/Null/NullTexture2D.h"
+#include "Platform/Null/NullTextureCube.h"
 #include "Eagle/Utils/PlatformUtils.h"
 
 #include "stb_image.h"
@@ -43,6 +45,9 @@ namespace Eagle
 			case RendererAPIType::Vulkan:
 				texture = MakeRef<VulkanTexture2D>(path, properties);
 				break;
+			case RendererAPIType::Null:
+				texture = MakeRef<NullTexture2D>(path, properties);
+				break;
 
 			default:
 				EG_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -62,6 +67,9 @@ namespace Eagle
 			case RendererAPIType::Vulkan: 
 				texture = MakeRef<VulkanTexture2D>(format, size, data, properties, name);
 				break;
+			case RendererAPIType::Null:
+				texture = MakeRef<NullTexture2D>(format, size, data, properties, name);
+				break;
 				
 			default:
 				EG_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -86,6 +94,9 @@ namespace Eagle
 		case RendererAPIType::Vulkan:
 			texture = MakeRef<VulkanTextureCube>(path, layerSize);
 			break;
+		case RendererAPIType::Null:
+			texture = MakeRef<NullTextureCube>(path, layerSize);
+			break;
 
 		default:
 			EG_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -105,6 +116,9 @@ namespace Eagle
 		case RendererAPIType::Vulkan:
 			texture = MakeRef<VulkanTextureCube>(texture2D, layerSize);
 			break;
+		case RendererAPIType::Null:
+			texture = MakeRef<NullTextureCube>(texture2D, layerSize);
+			break;
 
 		default:
 			EG_CORE_ASSERT(false, "Unknown RendererAPI!");
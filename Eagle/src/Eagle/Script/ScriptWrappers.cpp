@@ -396,8 +396,10 @@ namespace Eagle
 
 		const glm::vec2 viewportSize = scene->ViewportBounds[1] - scene->ViewportBounds[0];
 
-		const int mouseX = int(pos->x);
-		const int mouseY = int(pos->y);
+		// With dynamic resolution, the scene occupies only a part of the GBuffer
+		const float renderScale = sceneRenderer->GetRenderScale();
+		const int mouseX = int(pos->x * renderScale);
+		const int mouseY = int(pos->y * renderScale);
 
 		if (mouseX >= 0 && mouseY >= 0 && mouseX < (int)viewportSize.x && mouseY < (int)viewportSize.y)
 		{
@@ -2971,7 +2973,7 @@ namespace Eagle
 		Entity entity = scene->GetEntityByGUID(entityID);
 
 		if (entity)
-			entity.GetComponent<CameraComponent>().Primary = val;
+			entity.GetComponent<CameraComponent>().SetPrimary(val);
 		else
 			EG_CORE_ERROR("[ScriptEngine] Couldn't set 'IsPrimary'. Entity is null");
 	}
@@ -2982,7 +2984,7 @@ namespace Eagle
 		Entity entity = scene->GetEntityByGUID(entityID);
 
 		if (entity)
-			return entity.GetComponent<CameraComponent>().Primary;
+			return entity.GetComponent<CameraComponent>().IsPrimary();
 		else
 		{
 			EG_CORE_ERROR("[ScriptEngine] Couldn't read 'IsPrimary'. Entity is null");
@@ -3981,7 +3983,7 @@ namespace Eagle
 			TextureLibrary::GetDefault(textureID, &texture);
 			if (!texture)
 				TextureLibrary::Get(textureID, &texture);
-			entity.GetComponent<BillboardComponent>().Texture = Cast<Texture2D>(texture);
+			entity.GetComponent<BillboardComponent>().SetTexture(Cast<Texture2D>(texture));
 		}
 		else
 			EG_CORE_ERROR("[ScriptEngine] Couldn't set billboard texture. Entity is null");
@@ -3998,8 +4000,8 @@ namespace Eagle
 		}
 
 		auto& billboard = entity.GetComponent<BillboardComponent>();
-		if (billboard.Texture)
-			return billboard.Texture->GetGUID();
+		if (const auto& texture = billboard.GetTexture())
+			return texture->GetGUID();
 		return { 0, 0 };
 	}
 
@@ -0,0 +1,128 @@
+#include "egpch.h"
+#include "TextLayoutCache.h"
+#include "Font.h"
+
+#include "Eagle/Renderer/VidWrappers/Texture.h"
+
+#include <codecvt>
+
+namespace Eagle
+{
+	static std::u32string ToUTF32(const std::string& s)
+	{
+		std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
+		return conv.from_bytes(s);
+	}
+
+	const std::vector<GlyphQuad>& TextLayoutCache::GetLayout(uint32_t id, const Ref<Font>& font, const std::string& text,
+		float lineSpacing, float kerningOffset, float maxWidth, bool* bOutChanged)
+	{
+		auto& layout = m_Layouts[id];
+		layout.bUsed = true;
+
+		const bool bChanged = layout.Font != font || layout.LineSpacing != lineSpacing || layout.KerningOffset != kerningOffset ||
+			layout.MaxWidth != maxWidth || layout.Text != text;
+		if (bChanged)
+		{
+			layout.Font = font;
+			layout.Text = text;
+			layout.LineSpacing = lineSpacing;
+			layout.KerningOffset = kerningOffset;
+			layout.MaxWidth = maxWidth;
+			layout.Glyphs.clear();
+			Layout(font, ToUTF32(text), lineSpacing, kerningOffset, maxWidth, layout.Glyphs);
+		}
+
+		if (bOutChanged)
+			*bOutChanged = bChanged;
+		return layout.Glyphs;
+	}
+
+	void TextLayoutCache::RemoveUnused()
+	{
+		for (auto it = m_Layouts.begin(); it != m_Layouts.end(); )
+		{
+			if (it->second.bUsed)
+			{
+				it->second.bUsed = false;
+				++it;
+			}
+			else
+				it = m_Layouts.erase(it);
+		}
+	}
+
+	void TextLayoutCache::Layout(const Ref<Font>& font, const std::u32string& text, float lineSpacing, float kerningOffset, float maxWidth, std::vector<GlyphQuad>& outGlyphs)
+	{
+		const auto& fontGeometry = font->GetFontGeometry();
+		const auto& metrics = fontGeometry->getMetrics();
+		const auto& atlas = font->GetAtlas();
+
+		const double spaceAdvance = fontGeometry->getGlyph(' ')->getAdvance();
+		std::vector<int> nextLines = Font::GetNextLines(metrics, fontGeometry, text, spaceAdvance, lineSpacing, kerningOffset, maxWidth);
+
+		const double texelWidth = 1. / atlas->GetWidth();
+		const double texelHeight = 1. / atlas->GetHeight();
+		const double fsScale = 1 / (metrics.ascenderY - metrics.descenderY);
+		double x = 0.0;
+		double y = 0.0;
+
+		const size_t textSize = text.size();
+		outGlyphs.reserve(outGlyphs.size() + textSize);
+		for (int i = 0; i < textSize; i++)
+		{
+			char32_t character = text[i];
+			if (character == '\n' || Font::NextLine(i, nextLines))
+			{
+				x = 0;
+				y -= fsScale * metrics.lineHeight + lineSpacing;
+				continue;
+			}
+
+			const bool bIsTab = character == '\t';
+			if (character == ' ' || bIsTab)
+			{
+				character = ' '; // treat tabs as spaces
+				double advance = spaceAdvance;
+				if (i < textSize - 1)
+				{
+					char32_t nextCharacter = text[i + 1];
+					if (nextCharacter == '\t')
+						nextCharacter = ' ';
+					fontGeometry->getAdvance(advance, character, nextCharacter);
+				}
+
+				// Tab is 4 spaces
+				x += (fsScale * advance + kerningOffset) * (bIsTab ? 4.0 : 1.0);
+				continue;
+			}
+
+			auto glyph = fontGeometry->getGlyph(character);
+			if (!glyph)
+				glyph = fontGeometry->getGlyph('?');
+			if (!glyph)
+				continue;
+
+			double l, b, r, t;
+			glyph->getQuadAtlasBounds(l, b, r, t);
+
+			double pl, pb, pr, pt;
+			glyph->getQuadPlaneBounds(pl, pb, pr, pt);
+
+			pl *= fsScale, pb *= fsScale, pr *= fsScale, pt *= fsScale;
+			pl += x, pb += y, pr += x, pt += y;
+			l *= texelWidth, b *= texelHeight, r *= texelWidth, t *= texelHeight;
+
+			auto& quad = outGlyphs.emplace_back();
+			quad.PlaneBounds = glm::vec4(pl, pb, pr, pt);
+			quad.AtlasBounds = glm::vec4(l, b, r, t);
+
+			if (i + 1 < textSize)
+			{
+				double advance = glyph->getAdvance();
+				fontGeometry->getAdvance(advance, character, text[i + 1]);
+				x += fsScale * advance + kerningOffset;
+			}
+		}
+	}
+}
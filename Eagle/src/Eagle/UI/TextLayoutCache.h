@@ -0,0 +1,51 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Eagle
+{
+	class Font;
+
+	struct GlyphQuad
+	{
+		glm::vec4 PlaneBounds; // Left, bottom, right, top. In text space
+		glm::vec4 AtlasBounds; // Left, bottom, right, top. Normalized atlas coords
+	};
+
+	// Stores laid out glyphs of text components so that only changed texts are processed again.
+	// Not thread-safe, should be used by a single thread (render thread)
+	class TextLayoutCache
+	{
+	public:
+		// `id` - unique id of a text component (entity id)
+		// Returns laid out glyphs. Relayouts the text only if one of the parameters has changed since the last call.
+		// `bOutChanged` is set to true if the layout was recalculated
+		const std::vector<GlyphQuad>& GetLayout(uint32_t id, const Ref<Font>& font, const std::string& text,
+			float lineSpacing, float kerningOffset, float maxWidth, bool* bOutChanged = nullptr);
+
+		// Removes layouts that were not requested since the last call to `RemoveUnused`
+		void RemoveUnused();
+
+		void Clear() { m_Layouts.clear(); }
+
+		// Number of glyphs to reserve for a text. Spare glyphs let the text grow a bit (for example, a counter going from 9 to 10)
+		// without moving glyphs of other texts
+		static size_t GetGlyphsCapacity(size_t glyphsCount) { return glyphsCount + glm::max(glyphsCount / 4, size_t(4)); }
+
+		static void Layout(const Ref<Font>& font, const std::u32string& text, float lineSpacing, float kerningOffset, float maxWidth, std::vector<GlyphQuad>& outGlyphs);
+
+	private:
+		struct TextLayout
+		{
+			std::vector<GlyphQuad> Glyphs;
+			Ref<Font> Font;
+			std::string Text;
+			float LineSpacing = 0.f;
+			float KerningOffset = 0.f;
+			float MaxWidth = 0.f;
+			bool bUsed = false;
+		};
+
+		std::unordered_map<uint32_t, TextLayout> m_Layouts;
+	};
+}
@@ -1628,7 +1628,7 @@ namespace Eagle::UI
 		if (ImGui::BeginPopupModal(title.data(), NULL, ImGuiWindowFlags_AlwaysAutoResize))
 		{
 			char buf[128] = {0};
-			memcpy_s(buf, sizeof(buf), input.c_str(), input.size());
+			memcpy(buf, input.c_str(), std::min(sizeof(buf) - 1, input.size()));
 			if (ImGui::InputTextWithHint("##MyInputPopup", hint.data(), buf, sizeof(buf)))
 				input = buf;
 
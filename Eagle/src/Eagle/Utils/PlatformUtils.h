@@ -10,6 +10,7 @@ namespace Eagle
 		static const wchar_t* TEXTURE_FILTER = L"Texture (*.png,*.jpg)\0*.png;*.jpg\0";
 		static const wchar_t* SCENE_FILTER = L"Eagle Scene (*.eagle)\0*.eagle\0";
 		static const wchar_t* MESH_FILTER = L"3D-Model (*.fbx,*.blend,*.3ds,*.obj,*.smd,*.vta,*.stl)|*.fbx;*.blend;*.3ds;*.obj;*.smd;*.vta;*.stl";
+		static const wchar_t* YAML_FILTER = L"YAML (*.yaml)\0*.yaml\0";
 
 		//Returns empty string if failed
 		Path OpenFile(const wchar_t* filter);
@@ -34,6 +35,15 @@ namespace Eagle
 		bool WereScriptsRebuild();
 
 		bool IsSSE2Supported();
+
+		struct ProcessMemory
+		{
+			uint64_t Current = 0; // Bytes resident in RAM (working set)
+			uint64_t Peak = 0;
+		};
+
+		// Returns zeros if failed
+		ProcessMemory GetProcessMemory();
 	}
 
 	namespace Dialog
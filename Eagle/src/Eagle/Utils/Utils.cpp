@@ -65,4 +65,106 @@ namespace Eagle::Utils
 	{
 		return MyFindStrTemplate(str1, str2);
 	}
+
+	static uint32_t PNGCrc32(const uint8_t* data, size_t size, uint32_t crc = 0u)
+	{
+		static const auto s_Table = []()
+		{
+			std::array<uint32_t, 256> table{};
+			for (uint32_t i = 0; i < 256; ++i)
+			{
+				uint32_t c = i;
+				for (int k = 0; k < 8; ++k)
+					c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+				table[i] = c;
+			}
+			return table;
+		}();
+
+		crc = ~crc;
+		for (size_t i = 0; i < size; ++i)
+			crc = s_Table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+		return ~crc;
+	}
+
+	static void PNGWriteU32(std::vector<uint8_t>& out, uint32_t value)
+	{
+		out.push_back(uint8_t(value >> 24));
+		out.push_back(uint8_t(value >> 16));
+		out.push_back(uint8_t(value >> 8));
+		out.push_back(uint8_t(value));
+	}
+
+	static void PNGWriteChunk(std::ofstream& file, const char* type, const std::vector<uint8_t>& data)
+	{
+		std::vector<uint8_t> chunk;
+		chunk.reserve(data.size() + 12);
+		PNGWriteU32(chunk, uint32_t(data.size()));
+		chunk.insert(chunk.end(), type, type + 4);
+		chunk.insert(chunk.end(), data.begin(), data.end());
+		PNGWriteU32(chunk, PNGCrc32(chunk.data() + 4, chunk.size() - 4));
+		file.write((const char*)chunk.data(), chunk.size());
+	}
+
+	bool WritePNG(const Path& path, uint32_t width, uint32_t height, const uint8_t* rgba)
+	{
+		std::ofstream file(path, std::ios::binary);
+		if (!file)
+			return false;
+
+		static constexpr uint8_t s_Signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		file.write((const char*)s_Signature, sizeof(s_Signature));
+
+		std::vector<uint8_t> header;
+		PNGWriteU32(header, width);
+		PNGWriteU32(header, height);
+		header.push_back(8); // Bit depth
+		header.push_back(6); // Color type: RGBA
+		header.push_back(0); // Compression
+		header.push_back(0); // Filter
+		header.push_back(0); // Interlace
+		PNGWriteChunk(file, "IHDR", header);
+
+		// Each scanline is prefixed with a filter type (0 - none)
+		const size_t rowSize = size_t(width) * 4u;
+		std::vector<uint8_t> raw;
+		raw.reserve((rowSize + 1) * height);
+		for (uint32_t y = 0; y < height; ++y)
+		{
+			raw.push_back(0);
+			raw.insert(raw.end(), rgba + y * rowSize, rgba + (y + 1) * rowSize);
+		}
+
+		// zlib stream made of uncompressed (stored) deflate blocks
+		constexpr size_t maxBlockSize = 65535;
+		std::vector<uint8_t> zlib;
+		zlib.reserve(raw.size() + raw.size() / maxBlockSize * 5 + 16);
+		zlib.push_back(0x78);
+		zlib.push_back(0x01);
+		size_t offset = 0;
+		do
+		{
+			const size_t blockSize = std::min(maxBlockSize, raw.size() - offset);
+			const bool bLast = offset + blockSize == raw.size();
+			zlib.push_back(bLast ? 1 : 0);
+			zlib.push_back(uint8_t(blockSize));
+			zlib.push_back(uint8_t(blockSize >> 8));
+			zlib.push_back(uint8_t(~blockSize));
+			zlib.push_back(uint8_t(~blockSize >> 8));
+			zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + blockSize);
+			offset += blockSize;
+		} while (offset < raw.size());
+
+		uint32_t a = 1, b = 0; // Adler-32
+		for (uint8_t value : raw)
+		{
+			a = (a + value) % 65521u;
+			b = (b + a) % 65521u;
+		}
+		PNGWriteU32(zlib, (b << 16) | a);
+		PNGWriteChunk(file, "IDAT", zlib);
+		PNGWriteChunk(file, "IEND", {});
+
+		return bool(file);
+	}
 }
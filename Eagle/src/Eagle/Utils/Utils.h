@@ -47,6 +47,9 @@ namespace Eagle::Utils
 	size_t FindSubstringI(const std::string& str1, const std::string& str2);
 	size_t FindSubstringI(const std::wstring& str1, const std::wstring& str2);
 
+	// Writes tightly packed 8-bit RGBA pixels to an uncompressed PNG file. Intended for debug dumps, not for assets
+	bool WritePNG(const Path& path, uint32_t width, uint32_t height, const uint8_t* rgba);
+
 	template<typename Enum>
 	const char* GetEnumName(Enum value)
 	{
@@ -0,0 +1,51 @@
+#include "egpch.h"
+#include "HeadlessWindow.h"
+
+#include "Eagle/Core/Application.h"
+#include "Eagle/Events/ApplicationEvent.h"
+#include "Platform/Vulkan/VulkanContext.h"
+#include "Platform/Vulkan/VulkanSwapchain.h"
+
+namespace Eagle
+{
+	HeadlessWindow::HeadlessWindow(const WindowProps& props) : Window(props)
+	{
+		EG_CORE_INFO("Creating headless window {0}", m_Props.Title);
+		m_Window = nullptr;
+
+		if (RendererContext::Current() == RendererAPIType::Vulkan)
+		{
+			auto vulkanContext = Cast<VulkanContext>(Application::Get().GetRenderContext());
+			vulkanContext->InitDevices(VK_NULL_HANDLE, false);
+			m_Swapchain = MakeRef<VulkanSwapchain>(glm::uvec2(m_Props.Width, m_Props.Height));
+			m_Swapchain->Init(VulkanContext::GetDevice(), m_Props.VSync);
+		}
+	}
+
+	HeadlessWindow::~HeadlessWindow()
+	{
+		m_Swapchain.reset();
+	}
+
+	void HeadlessWindow::SetVSync(bool enable)
+	{
+		m_Props.VSync = enable;
+		if (m_Swapchain)
+			m_Swapchain->SetVSyncEnabled(enable);
+	}
+
+	void HeadlessWindow::SetWindowSize(int width, int height)
+	{
+		m_Props.Width = uint32_t(width);
+		m_Props.Height = uint32_t(height);
+
+		if (m_Swapchain)
+			m_Swapchain->SetOffscreenSize(glm::uvec2(m_Props.Width, m_Props.Height));
+
+		if (m_EventCallback)
+		{
+			WindowResizeEvent event(width, height);
+			m_EventCallback(event);
+		}
+	}
+}
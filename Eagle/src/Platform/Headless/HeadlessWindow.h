@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Eagle/Core/Window.h"
+
+namespace Eagle
+{
+	// Window without a native window. Used for headless runs.
+	// If the renderer API is Vulkan, creates an offscreen swapchain that renders into an image ring.
+	// For the null API, there's no swapchain
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow(const WindowProps& props);
+		virtual ~HeadlessWindow();
+
+		void ProcessEvents() override {}
+
+		virtual void* GetNativeWindow() const override { return nullptr; }
+
+		//Window attributes
+		virtual void SetEventCallback(const EventCallbackFn& callback) override { m_EventCallback = callback; }
+		virtual void SetVSync(bool enable) override;
+		virtual void SetFocus(bool focus) override {}
+		virtual void SetWindowSize(int width, int height) override;
+		virtual void SetWindowMaximized(bool bMaximize) override { m_bMaximized = bMaximize; }
+		virtual void SetWindowPos(int x, int y) override { m_Pos = glm::vec2(x, y); }
+		virtual void SetWindowTitle(const std::string& title) override { m_Props.Title = title; }
+		virtual void SetWindowIcon(const Path& iconPath) override {}
+		virtual void SetFullscreen(bool bFullscreen) override { m_Props.Fullscreen = bFullscreen; }
+
+		virtual glm::vec2 GetWindowSize() const override { return glm::vec2(m_Props.Width, m_Props.Height); }
+		virtual bool IsMaximized() const override { return m_bMaximized; }
+		virtual glm::vec2 GetWindowPos() const override { return m_Pos; }
+		virtual Ref<VulkanSwapchain>& GetSwapchain() override { return m_Swapchain; }
+
+	private:
+		EventCallbackFn m_EventCallback;
+		Ref<VulkanSwapchain> m_Swapchain;
+		glm::vec2 m_Pos = glm::vec2(0.f);
+		bool m_bMaximized = false;
+	};
+}
@@ -0,0 +1,49 @@
+#include "egpch.h"
+
+#include "Eagle/Input/Input.h"
+
+// Linux builds only support headless windows, so there is no device to poll.
+// Queries return released buttons and a zero cursor, same as WindowsInput does without a GLFW window
+namespace Eagle
+{
+	static bool s_CursorVisible = true;
+
+	bool Input::IsKeyPressed(Key keyCode)
+	{
+		return false;
+	}
+
+	bool Input::IsMouseButtonPressed(Mouse mouseButton)
+	{
+		return false;
+	}
+
+	std::pair<float, float> Input::GetMousePosition()
+	{
+		return { 0.f, 0.f };
+	}
+
+	float Input::GetMouseX()
+	{
+		return 0.f;
+	}
+
+	float Input::GetMouseY()
+	{
+		return 0.f;
+	}
+
+	void Input::SetShowMouse(bool bShow)
+	{
+		s_CursorVisible = bShow;
+	}
+
+	void Input::SetMousePos(double xPos, double yPos)
+	{
+	}
+
+	bool Input::IsMouseVisible()
+	{
+		return s_CursorVisible;
+	}
+}
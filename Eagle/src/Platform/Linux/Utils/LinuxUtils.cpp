@@ -0,0 +1,119 @@
+#include "egpch.h"
+
+#include "Eagle/Utils/PlatformUtils.h"
+
+// File system access is portable. Dialogs and the file explorer need a desktop,
+// which headless Linux builds don't have, so they log and return the 'cancelled' result
+namespace Eagle
+{
+	namespace FileDialog
+	{
+		Path OpenFile(const wchar_t* filter)
+		{
+			EG_CORE_WARN("File dialogs are not supported on Linux");
+			return Path();
+		}
+
+		Path SaveFile(const wchar_t* filter)
+		{
+			EG_CORE_WARN("File dialogs are not supported on Linux");
+			return Path();
+		}
+	}
+
+	namespace FileSystem
+	{
+		bool Write(const Path& path, const DataBuffer& buffer)
+		{
+			if (!std::filesystem::exists(path))
+				std::filesystem::create_directories(path.parent_path());
+
+			std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+
+			if (!stream)
+			{
+				stream.close();
+				return false;
+			}
+
+			stream.write((const char*)buffer.Data, buffer.Size);
+			stream.close();
+			return true;
+		}
+
+		DataBuffer Read(const Path& path)
+		{
+			std::ifstream stream(path, std::ios::binary | std::ios::ate);
+
+			std::streampos end = stream.tellg();
+			stream.seekg(0, std::ios::beg);
+			size_t size = end - stream.tellg();
+			EG_CORE_ASSERT(size != 0, "Empty file");
+
+			DataBuffer buffer;
+			buffer.Allocate(size);
+			stream.read((char*)buffer.Data, buffer.Size);
+
+			return buffer;
+		}
+
+		Path GetFullPath(const Path& path)
+		{
+			return std::filesystem::absolute(path);
+		}
+	}
+
+	namespace Utils
+	{
+		void OpenInExplorer(const Path& path)
+		{
+			EG_CORE_WARN("Opening '{}' in the file explorer is not supported on Linux", path.u8string());
+		}
+
+		void ShowInExplorer(const Path& path)
+		{
+			EG_CORE_WARN("Showing '{}' in the file explorer is not supported on Linux", path.u8string());
+		}
+
+		void OpenLink(const Path& path)
+		{
+			EG_CORE_WARN("Opening '{}' is not supported on Linux", path.u8string());
+		}
+
+		bool WereScriptsRebuild()
+		{
+			// Script rebuilds are signalled by a named Win32 event
+			return false;
+		}
+
+		bool IsSSE2Supported()
+		{
+			return __builtin_cpu_supports("sse2");
+		}
+
+		ProcessMemory GetProcessMemory()
+		{
+			// Values are in kB, for example: "VmRSS:	  123456 kB"
+			ProcessMemory result;
+			std::ifstream stream("/proc/self/status");
+			std::string line;
+			while (std::getline(stream, line))
+			{
+				if (line.rfind("VmRSS:", 0) == 0)
+					result.Current = std::stoull(line.substr(6)) * 1024u;
+				else if (line.rfind("VmHWM:", 0) == 0)
+					result.Peak = std::stoull(line.substr(6)) * 1024u;
+			}
+			return result;
+		}
+	}
+
+	namespace Dialog
+	{
+		bool YesNoQuestion(const std::string& title, const std::string& message)
+		{
+			EG_CORE_WARN("'{}' was answered 'No': message boxes are not supported on Linux", title);
+			return false;
+		}
+	}
+}
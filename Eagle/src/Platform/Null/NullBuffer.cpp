@@ -0,0 +1,34 @@
+#include "egpch.h"
+#include "NullBuffer.h"
+#include "NullContext.h"
+
+namespace Eagle
+{
+	NullBuffer::NullBuffer(const BufferSpecifications& specs, const std::string& debugName)
+		: Buffer(specs, debugName)
+	{
+		if (m_Specs.MemoryType != MemoryType::Gpu)
+			m_Memory.resize(m_Specs.Size);
+		NullContext::OnAllocated(m_Specs.Size);
+	}
+
+	NullBuffer::~NullBuffer()
+	{
+		NullContext::OnFreed(m_Specs.Size);
+	}
+
+	void NullBuffer::Resize(size_t size)
+	{
+		NullContext::OnFreed(m_Specs.Size);
+		m_Specs.Size = size;
+		NullContext::OnAllocated(m_Specs.Size);
+		m_ResourceID = GenerateRenderResourceID();
+
+		// Matches other backends: the contents are lost
+		if (m_Specs.MemoryType != MemoryType::Gpu)
+		{
+			m_Memory.clear();
+			m_Memory.resize(size);
+		}
+	}
+}
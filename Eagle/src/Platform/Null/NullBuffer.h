@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Buffer.h"
+
+namespace Eagle
+{
+	class NullBuffer : public Buffer
+	{
+	public:
+		NullBuffer(const BufferSpecifications& specs, const std::string& debugName = "");
+		virtual ~NullBuffer();
+
+		void Resize(size_t size) override;
+
+		// Only CPU-visible buffers have memory. Others are never mapped
+		[[nodiscard]] void* Map() override
+		{
+			assert(m_Specs.MemoryType != MemoryType::Gpu);
+			return m_Memory.data();
+		}
+		void Unmap() override {}
+
+		void* GetHandle() const override { return (void*)this; }
+		void* GetViewHandle() const override { return (void*)this; }
+
+	private:
+		std::vector<uint8_t> m_Memory;
+	};
+}
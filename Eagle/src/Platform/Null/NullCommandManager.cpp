@@ -0,0 +1,323 @@
+#include "egpch.h"
+#include "NullCommandManager.h"
+#include "NullFence.h"
+
+#include "Eagle/Renderer/VidWrappers/PipelineGraphics.h"
+#include "Eagle/Renderer/VidWrappers/PipelineCompute.h"
+#include "Eagle/Renderer/VidWrappers/StagingManager.h"
+#include "Eagle/Renderer/VidWrappers/Framebuffer.h"
+
+namespace Eagle
+{
+	Ref<CommandBuffer> NullCommandManager::AllocateCommandBuffer(bool bBegin)
+	{
+		Ref<CommandBuffer> cmd = MakeRef<NullCommandBuffer>(false);
+		if (bBegin)
+			cmd->Begin();
+		return cmd;
+	}
+
+	Ref<CommandBuffer> NullCommandManager::AllocateSecondaryCommandbuffer(bool bBegin)
+	{
+		Ref<CommandBuffer> cmd = MakeRef<NullCommandBuffer>(true);
+		if (bBegin)
+			cmd->Begin();
+		return cmd;
+	}
+
+	void NullCommandManager::Submit(CommandBuffer* cmdBuffers, uint32_t cmdBuffersCount, const Ref<Fence>& signalFence,
+		const Semaphore* waitSemaphores, uint32_t waitSemaphoresCount, const Semaphore* signalSemaphores, uint32_t signalSemaphoresCount)
+	{
+		if (signalFence)
+			Cast<NullFence>(signalFence)->Signal();
+	}
+
+	void NullCommandBuffer::Begin()
+	{
+		EG_CORE_ASSERT(m_bIsRecording == false);
+		m_bIsRecording = true;
+
+		ResetBoundDescriptorSets(BindPoint::Graphics);
+		ResetBoundDescriptorSets(BindPoint::Compute);
+	}
+
+	void NullCommandBuffer::End()
+	{
+		EG_CORE_ASSERT(m_bIsRecording == true);
+		m_bIsRecording = false;
+	}
+
+	void NullCommandBuffer::Dispatch(Ref<PipelineCompute>& pipeline, uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ, const void* pushConstants)
+	{
+		Ref<Pipeline> purePipeline = Cast<Pipeline>(pipeline);
+		CommitDescriptors(purePipeline, BindPoint::Compute);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.PipelineBinds;
+		++stats.Dispatches;
+	}
+
+	void NullCommandBuffer::BeginGraphics(Ref<PipelineGraphics>& pipeline)
+	{
+		m_CurrentGraphicsPipeline = pipeline;
+		m_CurrentFramebuffer.reset();
+		ResetBoundDescriptorSets(BindPoint::Graphics);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.RenderPassBegins;
+		++stats.PipelineBinds;
+	}
+
+	void NullCommandBuffer::BeginGraphics(Ref<PipelineGraphics>& pipeline, const Ref<Framebuffer>& framebuffer)
+	{
+		m_CurrentGraphicsPipeline = pipeline;
+		m_CurrentFramebuffer = framebuffer;
+		ResetBoundDescriptorSets(BindPoint::Graphics);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.RenderPassBegins;
+		++stats.PipelineBinds;
+	}
+
+	void NullCommandBuffer::EndGraphics()
+	{
+		assert(m_CurrentGraphicsPipeline);
+
+		auto& state = m_CurrentGraphicsPipeline->GetState();
+		if (m_CurrentFramebuffer)
+		{
+			uint32_t index = 0;
+			auto& images = m_CurrentFramebuffer->GetImages();
+			for (auto& attachment : state.ColorAttachments)
+				images[index++]->SetImageLayout(attachment.FinalLayout);
+			if (state.DepthStencilAttachment.Image)
+				images[index++]->SetImageLayout(state.DepthStencilAttachment.FinalLayout);
+		}
+		else
+		{
+			for (auto& attachment : state.ColorAttachments)
+			{
+				if (attachment.Image)
+					attachment.Image->SetImageLayout(attachment.FinalLayout);
+			}
+			if (state.DepthStencilAttachment.Image)
+				state.DepthStencilAttachment.Image->SetImageLayout(state.DepthStencilAttachment.FinalLayout);
+		}
+
+		m_CurrentGraphicsPipeline = nullptr;
+		m_CurrentFramebuffer = nullptr;
+	}
+
+	void NullCommandBuffer::Draw(uint32_t vertexCount, uint32_t firstVertex)
+	{
+		assert(m_CurrentGraphicsPipeline);
+		Ref<Pipeline> purePipeline = Cast<Pipeline>(m_CurrentGraphicsPipeline);
+		CommitDescriptors(purePipeline, BindPoint::Graphics);
+		++RenderManager::GetCurrentRHIStats().Draws;
+	}
+
+	void NullCommandBuffer::Draw(const Ref<Buffer>& vertexBuffer, uint32_t vertexCount, uint32_t firstVertex)
+	{
+		assert(vertexBuffer->HasUsage(BufferUsage::VertexBuffer));
+		Draw(vertexCount, firstVertex);
+		++RenderManager::GetCurrentRHIStats().VertexBufferBinds;
+	}
+
+	void NullCommandBuffer::DrawIndexedInstanced(const Ref<Buffer>& vertexBuffer, const Ref<Buffer>& indexBuffer, uint32_t indexCount, uint32_t firstIndex, int32_t vertexOffset,
+		uint32_t instanceCount, uint32_t firstInstance, const Ref<Buffer>& perInstanceBuffer)
+	{
+		assert(vertexBuffer->HasUsage(BufferUsage::VertexBuffer));
+		assert(perInstanceBuffer->HasUsage(BufferUsage::VertexBuffer));
+		assert(indexBuffer->HasUsage(BufferUsage::IndexBuffer));
+		Draw(indexCount, firstIndex);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.VertexBufferBinds;
+		++stats.IndexBufferBinds;
+	}
+
+	void NullCommandBuffer::DrawIndexed(const Ref<Buffer>& vertexBuffer, const Ref<Buffer>& indexBuffer, uint32_t indexCount, uint32_t firstIndex, uint32_t vertexOffset)
+	{
+		assert(vertexBuffer->HasUsage(BufferUsage::VertexBuffer));
+		assert(indexBuffer->HasUsage(BufferUsage::IndexBuffer));
+		Draw(indexCount, firstIndex);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.VertexBufferBinds;
+		++stats.IndexBufferBinds;
+	}
+
+	void NullCommandBuffer::ExecuteSecondary(const Ref<CommandBuffer>& secondaryCmd)
+	{
+		ResetBoundDescriptorSets(BindPoint::Graphics);
+		ResetBoundDescriptorSets(BindPoint::Compute);
+	}
+
+	void NullCommandBuffer::TransitionLayout(const Ref<Image>& image, ImageLayout oldLayout, ImageLayout newLayout)
+	{
+		TransitionLayout(image, ImageView{ 0, image->GetMipsCount(), 0 }, oldLayout, newLayout);
+	}
+
+	void NullCommandBuffer::TransitionLayout(const Ref<Image>& image, const ImageView& imageView, ImageLayout oldLayout, ImageLayout newLayout)
+	{
+		if (imageView.MipLevel == 0)
+			image->SetImageLayout(newLayout);
+		++RenderManager::GetCurrentRHIStats().Barriers;
+	}
+
+	void NullCommandBuffer::CopyImage(const Ref<Image>& src, const ImageView& srcView,
+		Ref<Image>& dst, const ImageView& dstView, ImageLayout dstOldLayout, ImageLayout dstNewLayout,
+		const glm::ivec3& srcOffset, const glm::ivec3& dstOffset,
+		const glm::uvec3& size)
+	{
+		assert(src->HasUsage(ImageUsage::TransferSrc));
+		assert(dst->HasUsage(ImageUsage::TransferDst));
+
+		const ImageLayout srcOldLayout = src->GetLayout();
+
+		TransitionLayout(src, srcOldLayout, ImageReadAccess::CopySource);
+		TransitionLayout(dst, dstOldLayout, ImageLayoutType::CopyDest);
+		TransitionLayout(src, ImageReadAccess::CopySource, srcOldLayout);
+		TransitionLayout(dst, ImageLayoutType::CopyDest, dstNewLayout);
+	}
+
+	void NullCommandBuffer::TransitionLayout(const Ref<Buffer>& buffer, BufferLayout oldLayout, BufferLayout newLayout)
+	{
+		buffer->SetLayout(newLayout);
+		++RenderManager::GetCurrentRHIStats().Barriers;
+	}
+
+	void NullCommandBuffer::CopyBuffer(const Ref<Buffer>& src, Ref<Buffer>& dst, size_t srcOffset, size_t dstOffset, size_t size)
+	{
+		assert(src->HasUsage(BufferUsage::TransferSrc));
+		assert(dst->HasUsage(BufferUsage::TransferDst));
+
+		const BufferLayout srcOldLayout = src->GetLayout();
+		const BufferLayout dstOldLayout = dst->GetLayout();
+
+		TransitionLayout(src, srcOldLayout, BufferReadAccess::CopySource);
+		TransitionLayout(dst, dstOldLayout, BufferLayoutType::CopyDest);
+		TransitionLayout(src, BufferReadAccess::CopySource, srcOldLayout);
+		TransitionLayout(dst, BufferLayoutType::CopyDest, dstOldLayout);
+	}
+
+	void NullCommandBuffer::CopyBuffer(const Ref<StagingBuffer>& src, Ref<Buffer>& dst, size_t srcOffset, size_t dstOffset, size_t size)
+	{
+		CopyBuffer(src->GetBuffer(), dst, srcOffset, dstOffset, size);
+	}
+
+	void NullCommandBuffer::Write(Ref<Image>& image, const void* data, size_t size, ImageLayout initialLayout, ImageLayout finalLayout)
+	{
+		assert(image->HasUsage(ImageUsage::TransferDst));
+		assert(!image->HasUsage(ImageUsage::DepthStencilAttachment)); // Writing to depth-stencil is not supported
+
+		if (initialLayout != ImageLayoutType::CopyDest)
+			TransitionLayout(image, initialLayout, ImageLayoutType::CopyDest);
+		if (finalLayout != ImageLayoutType::CopyDest)
+			TransitionLayout(image, ImageLayoutType::CopyDest, finalLayout);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.StagingAllocations;
+		stats.BytesWritten += size;
+	}
+
+	void NullCommandBuffer::Write(Ref<Buffer>& buffer, const void* data, size_t size, size_t offset, BufferLayout initialLayout, BufferLayout finalLayout)
+	{
+		assert(buffer);
+		assert(buffer->HasUsage(BufferUsage::TransferDst));
+		assert(offset + size <= buffer->GetSize());
+
+		if (initialLayout != BufferLayoutType::CopyDest)
+			TransitionLayout(buffer, initialLayout, BufferLayoutType::CopyDest);
+		if (finalLayout != BufferLayoutType::CopyDest)
+			TransitionLayout(buffer, BufferLayoutType::CopyDest, finalLayout);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.StagingAllocations;
+		stats.BytesWritten += size;
+	}
+
+	void NullCommandBuffer::GenerateMips(Ref<Image>& image, ImageLayout initialLayout, ImageLayout finalLayout)
+	{
+		assert(image->HasUsage(ImageUsage::TransferSrc | ImageUsage::TransferDst));
+
+		// Same transitions as a real mips generation would do, so that barrier counts match
+		const uint32_t mipCount = image->GetMipsCount();
+		const uint32_t layersCount = image->GetLayersCount();
+		TransitionLayout(image, initialLayout, ImageLayoutType::CopyDest);
+		for (uint32_t i = 1; i < mipCount; ++i)
+		{
+			for (uint32_t layer = 0; layer < layersCount; ++layer)
+				TransitionLayout(image, ImageView{ i - 1, 1, layer, 1 }, ImageLayoutType::CopyDest, ImageReadAccess::CopySource);
+			for (uint32_t layer = 0; layer < layersCount; ++layer)
+				TransitionLayout(image, ImageView{ i - 1, 1, layer, 1 }, ImageReadAccess::CopySource, finalLayout);
+		}
+		for (uint32_t layer = 0; layer < layersCount; ++layer)
+			TransitionLayout(image, ImageView{ mipCount - 1, 1, layer, 1 }, ImageLayoutType::CopyDest, finalLayout);
+	}
+
+	void NullCommandBuffer::CommitDescriptors(Ref<Pipeline>& pipeline, BindPoint bindPoint)
+	{
+		// Reused to avoid allocations on each draw
+		static thread_local std::vector<DescriptorWriteData> writeDatas;
+		writeDatas.clear();
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		pipeline->ReleaseStaleDescriptorSets();
+
+		auto& descriptorSetsData = pipeline->GetDescriptorSetsData();
+		auto& descriptorSets = pipeline->GetDescriptorSets();
+		for (auto& [set, data] : descriptorSetsData)
+		{
+			Ref<DescriptorSet>& descriptorSet = descriptorSets[set];
+			if (descriptorSet && !data.IsDirty())
+				continue;
+
+			bool bAllocated = false;
+			descriptorSet = pipeline->GetOrAllocateDescriptorSet(set, data, bAllocated);
+			EG_CORE_ASSERT(descriptorSet);
+
+			if (bAllocated)
+				writeDatas.push_back({ descriptorSet.get(), &data });
+			else
+			{
+				data.OnFlushed();
+				++stats.DescriptorCacheHits;
+			}
+		}
+
+		if (writeDatas.size())
+		{
+			DescriptorManager::WriteDescriptors(pipeline, writeDatas);
+			stats.DescriptorWrites += uint32_t(writeDatas.size());
+		}
+
+		BoundDescriptorSets& boundSets = bindPoint == BindPoint::Compute ? m_BoundComputeSets : m_BoundGraphicsSets;
+		const void* pipelineLayout = pipeline->GetPipelineLayoutHandle();
+		if (boundSets.PipelineLayout != pipelineLayout)
+		{
+			boundSets.PipelineLayout = pipelineLayout;
+			boundSets.Sets.clear();
+		}
+
+		for (auto& [set, descriptorSet] : descriptorSets)
+		{
+			if (set >= boundSets.Sets.size())
+				boundSets.Sets.resize(size_t(set) + 1, nullptr);
+
+			const void* handle = descriptorSet->GetHandle();
+			if (boundSets.Sets[set] == handle)
+				continue;
+
+			boundSets.Sets[set] = handle;
+			++stats.DescriptorBinds;
+		}
+	}
+
+	void NullCommandBuffer::ResetBoundDescriptorSets(BindPoint bindPoint)
+	{
+		BoundDescriptorSets& boundSets = bindPoint == BindPoint::Compute ? m_BoundComputeSets : m_BoundGraphicsSets;
+		boundSets.PipelineLayout = nullptr;
+		boundSets.Sets.clear();
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/RenderCommandManager.h"
+
+namespace Eagle
+{
+	class Pipeline;
+
+	class NullCommandManager : public CommandManager
+	{
+	public:
+		NullCommandManager(CommandQueueFamily queueFamily, bool bAllowReuse) {}
+
+		[[nodiscard]] Ref<CommandBuffer> AllocateCommandBuffer(bool bBegin = true) override;
+		[[nodiscard]] Ref<CommandBuffer> AllocateSecondaryCommandbuffer(bool bBegin = true) override;
+
+		void Submit(CommandBuffer* cmdBuffers, uint32_t cmdBuffersCount,
+			const Ref<Fence>& signalFence,
+			const Semaphore* waitSemaphores = nullptr, uint32_t waitSemaphoresCount = 0,
+			const Semaphore* signalSemaphores = nullptr, uint32_t signalSemaphoresCount = 0) override;
+
+		void Submit(CommandBuffer* cmdBuffers, uint32_t cmdBuffersCount,
+			const Semaphore* waitSemaphores = nullptr, uint32_t waitSemaphoresCount = 0,
+			const Semaphore* signalSemaphores = nullptr, uint32_t signalSemaphoresCount = 0) override {}
+	};
+
+	// Doesn't record anything. Tracks resource layouts and resolves descriptor sets the same way other backends do,
+	// and counts the recorded work into `RHIStatistics`
+	class NullCommandBuffer : public CommandBuffer
+	{
+	public:
+		NullCommandBuffer(bool bSecondary) : m_bIsPrimary(!bSecondary) {}
+
+		void Begin() override;
+		void End() override;
+
+		void* GetHandle() override { return this; }
+		bool IsSecondary() const override { return !m_bIsPrimary; }
+
+		void Dispatch(Ref<PipelineCompute>& pipeline, uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ, const void* pushConstants = nullptr) override;
+
+		void BeginGraphics(Ref<PipelineGraphics>& pipeline) override;
+		void SetRenderAreaScale(float scale) override {}
+		void BeginGraphics(Ref<PipelineGraphics>& pipeline, const Ref<Framebuffer>& framebuffer) override;
+		void EndGraphics() override;
+		void Draw(uint32_t vertexCount, uint32_t firstVertex) override;
+		void Draw(const Ref<Buffer>& vertexBuffer, uint32_t vertexCount, uint32_t firstVertex) override;
+		void DrawIndexedInstanced(const Ref<Buffer>& vertexBuffer, const Ref<Buffer>& indexBuffer, uint32_t indexCount, uint32_t firstIndex, int32_t vertexOffset,
+			uint32_t instanceCount, uint32_t firstInstance, const Ref<Buffer>& perInstanceBuffer) override;
+		void DrawIndexed(const Ref<Buffer>& vertexBuffer, const Ref<Buffer>& indexBuffer, uint32_t indexCount, uint32_t firstIndex, uint32_t vertexOffset) override;
+		void ExecuteSecondary(const Ref<CommandBuffer>& secondaryCmd) override;
+
+		void SetGraphicsRootConstants(const void* vertexRootConstants, const void* fragmentRootConstants) override {}
+
+		void TransitionLayout(const Ref<Image>& image, ImageLayout oldLayout, ImageLayout newLayout) override;
+		void TransitionLayout(const Ref<Image>& image, const ImageView& imageView, ImageLayout oldLayout, ImageLayout newLayout) override;
+		void ClearColorImage(Ref<Image>& image, const glm::vec4& color) override {}
+		void ClearDepthStencilImage(Ref<Image>& image, float depthValue, uint32_t stencilValue) override {}
+		void CopyImage(const Ref<Image>& src, const ImageView& srcView,
+			Ref<Image>& dst, const ImageView& dstView, ImageLayout dstOldLayout, ImageLayout dstNewLayout,
+			const glm::ivec3& srcOffset, const glm::ivec3& dstOffset,
+			const glm::uvec3& size) override;
+
+		void TransitionLayout(const Ref<Buffer>& buffer, BufferLayout oldLayout, BufferLayout newLayout) override;
+		void CopyBuffer(const Ref<Buffer>& src, Ref<Buffer>& dst, size_t srcOffset, size_t dstOffset, size_t size) override;
+		void CopyBuffer(const Ref<StagingBuffer>& src, Ref<Buffer>& dst, size_t srcOffset, size_t dstOffset, size_t size) override;
+		void FillBuffer(Ref<Buffer>& dst, uint32_t data, size_t offset = 0, size_t numBytes = 0) override {}
+
+		void CopyBufferToImage(const Ref<Buffer>& src, Ref<Image>& dst, const std::vector<BufferImageCopy>& regions) override {}
+		void CopyImageToBuffer(const Ref<Image>& src, Ref<Buffer>& dst, const std::vector<BufferImageCopy>& regions) override {}
+
+		void Write(Ref<Image>& image, const void* data, size_t size, ImageLayout initialLayout, ImageLayout finalLayout) override;
+		void Write(Ref<Buffer>& buffer, const void* data, size_t size, size_t offset, BufferLayout initialLayout, BufferLayout finalLayout) override;
+
+		void GenerateMips(Ref<Image>& image, ImageLayout initialLayout, ImageLayout finalLayout) override;
+
+		void StartTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex) override {}
+		void EndTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex) override {}
+
+#ifdef EG_GPU_TIMINGS
+		void BeginMarker(std::string_view name) override {}
+		void EndMarker() override {}
+#endif
+
+	private:
+		enum class BindPoint { Graphics, Compute };
+
+		void CommitDescriptors(Ref<Pipeline>& pipeline, BindPoint bindPoint);
+		void ResetBoundDescriptorSets(BindPoint bindPoint);
+
+	private:
+		// Descriptor sets that are currently bound to the command buffer. Used to skip redundant binds
+		struct BoundDescriptorSets
+		{
+			const void* PipelineLayout = nullptr;
+			std::vector<const void*> Sets;
+		};
+
+		Ref<PipelineGraphics> m_CurrentGraphicsPipeline;
+		Ref<Framebuffer> m_CurrentFramebuffer;
+		BoundDescriptorSets m_BoundGraphicsSets;
+		BoundDescriptorSets m_BoundComputeSets;
+		bool m_bIsPrimary = true;
+		bool m_bIsRecording = false;
+	};
+}
@@ -0,0 +1,24 @@
+#include "egpch.h"
+#include "NullContext.h"
+
+namespace Eagle
+{
+	std::atomic<uint64_t> NullContext::s_AllocatedMemory = 0;
+
+	NullContext::NullContext()
+	{
+		m_Caps.Vendor = "None";
+		m_Caps.Device = "Null Device";
+		m_Caps.DriverVersion = "0";
+		m_Caps.ApiVersion = "Null RHI";
+		m_Caps.MaxSamples = 1;
+		m_Caps.MaxAnisotropy = 16.f;
+	}
+
+	const GPUMemoryStats NullContext::GetMemoryStats() const
+	{
+		GPUMemoryStats result;
+		result.Used = s_AllocatedMemory;
+		return result;
+	}
+}
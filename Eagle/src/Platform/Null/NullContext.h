@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Eagle/Renderer/RendererContext.h"
+
+namespace Eagle
+{
+	// Renderer context that doesn't talk to any GPU. Resources and command buffers of the null backend only keep
+	// the CPU-side state that the engine queries (sizes, layouts, descriptor sets) and count the work that was recorded.
+	// Used to measure CPU costs of the engine (scene updates, culling, uploads, command recording) without a device
+	class NullContext : public RendererContext
+	{
+	public:
+		NullContext();
+
+		void WaitIdle() const override {}
+		ImageFormat GetDepthFormat() const override { return ImageFormat::D32_Float; }
+		const GPUMemoryStats GetMemoryStats() const override;
+
+		// Amount of memory that resources would have taken on a GPU
+		static void OnAllocated(size_t size) { s_AllocatedMemory += size; }
+		static void OnFreed(size_t size) { s_AllocatedMemory -= size; }
+
+	private:
+		static std::atomic<uint64_t> s_AllocatedMemory;
+	};
+}
@@ -0,0 +1,21 @@
+#include "egpch.h"
+#include "NullDescriptorManager.h"
+
+namespace Eagle
+{
+	Ref<DescriptorSet> NullDescriptorManager::CopyDescriptorSet(const Ref<DescriptorSet>& src)
+	{
+		return MakeRef<NullDescriptorSet>(src->GetSetIndex());
+	}
+
+	Ref<DescriptorSet> NullDescriptorManager::AllocateDescriptorSet(const Ref<Pipeline>& pipeline, uint32_t set)
+	{
+		return MakeRef<NullDescriptorSet>(set);
+	}
+
+	void NullDescriptorManager::WriteDescriptors(const Ref<Pipeline>& pipeline, const std::vector<DescriptorWriteData>& writeDatas)
+	{
+		for (auto& writeData : writeDatas)
+			writeData.DescriptorSetData->OnFlushed();
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/DescriptorManager.h"
+
+namespace Eagle
+{
+	class NullDescriptorManager : public DescriptorManager
+	{
+	public:
+		NullDescriptorManager(uint32_t numDescriptors, uint32_t maxSets)
+			: DescriptorManager(numDescriptors, maxSets) {}
+
+		Ref<DescriptorSet> CopyDescriptorSet(const Ref<DescriptorSet>& src) override;
+		Ref<DescriptorSet> AllocateDescriptorSet(const Ref<Pipeline>& pipeline, uint32_t set) override;
+		static void WriteDescriptors(const Ref<Pipeline>& pipeline, const std::vector<DescriptorWriteData>& writeDatas);
+	};
+
+	class NullDescriptorSet : public DescriptorSet
+	{
+	public:
+		NullDescriptorSet(uint32_t set) : DescriptorSet(set) {}
+
+		void* GetHandle() const override { return (void*)this; }
+	};
+}
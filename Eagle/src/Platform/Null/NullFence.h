@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Fence.h"
+
+namespace Eagle
+{
+	// Work submitted to the null backend is complete by the time `Submit` returns, so fences are signaled on submission
+	class NullFence : public Fence
+	{
+	public:
+		NullFence(bool bSignaled = false) : m_bSignaled(bSignaled) {}
+
+		void* GetHandle() const override { return (void*)this; }
+		bool IsSignaled() const override { return m_bSignaled; }
+		void Reset() override { m_bSignaled = false; }
+		void Wait(uint64_t timeout = UINT64_MAX) const override {}
+
+		void Signal() { m_bSignaled = true; }
+
+	private:
+		std::atomic<bool> m_bSignaled = false;
+	};
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Framebuffer.h"
+
+namespace Eagle
+{
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		NullFramebuffer(const std::vector<Ref<Image>>& images, glm::uvec2 size, const void* renderPassHandle)
+			: Framebuffer(images, size, renderPassHandle) {}
+		NullFramebuffer(const Ref<Image>& image, const ImageView& imageView, glm::uvec2 size, const void* renderPassHandle)
+			: Framebuffer(image, imageView, size, renderPassHandle) {}
+
+		void* GetHandle() const override { return (void*)this; }
+	};
+}
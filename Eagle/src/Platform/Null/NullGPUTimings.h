@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Eagle/Debug/GPUTimings.h"
+
+namespace Eagle
+{
+	// Nothing is executed on a GPU, so timings are always zero
+	class NullGPUTiming : public RHIGPUTiming
+	{
+	public:
+		virtual void* GetQueryPoolHandle() override { return this; }
+		virtual void QueryTiming(uint32_t frameInFlight) override {}
+	};
+}
@@ -0,0 +1,48 @@
+#include "egpch.h"
+#include "NullImGuiLayer.h"
+
+#include "Eagle/Core/Application.h"
+
+#include <imgui.h>
+#include <ImGuizmo.h>
+
+namespace Eagle
+{
+	void NullImGuiLayer::OnAttach()
+	{
+		IMGUI_CHECKVERSION();
+		ImGui::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+		// Font atlas has to be built before the first frame even though it's never uploaded
+		unsigned char* pixels = nullptr;
+		int width, height;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+		SetDarkThemeColors();
+	}
+
+	void NullImGuiLayer::OnDetach()
+	{
+		ImGui::DestroyContext();
+	}
+
+	void NullImGuiLayer::BeginFrame()
+	{
+		Application& app = Application::Get();
+		const Window& window = app.GetWindow();
+
+		ImGuiIO& io = ImGui::GetIO();
+		io.DisplaySize = ImVec2(float(window.GetWidth()), float(window.GetHeight()));
+		io.DeltaTime = glm::max(app.GetTimestep().GetSeconds(), 0.0001f);
+
+		ImGui::NewFrame();
+		ImGuizmo::BeginFrame();
+	}
+
+	void NullImGuiLayer::EndFrame()
+	{
+		ImGui::Render();
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eagle/ImGui/ImGuiLayer.h"
+
+namespace Eagle
+{
+	// ImGui frames are still built so that UI code runs, but nothing is drawn and there's no platform input
+	class NullImGuiLayer : public ImGuiLayer
+	{
+	public:
+		void OnAttach() override;
+		void OnDetach() override;
+
+		void BeginFrame() override;
+		void EndFrame() override;
+
+	private:
+		void Render(Ref<CommandBuffer>& cmd) override {}
+		void UpdatePlatform() override {}
+	};
+}
@@ -0,0 +1,86 @@
+#include "egpch.h"
+#include "NullImage.h"
+#include "NullContext.h"
+
+#include "Eagle/Renderer/VidWrappers/RenderCommandManager.h"
+
+namespace Eagle
+{
+	NullImage::NullImage(const ImageSpecifications& specs, const std::string& debugName)
+		: Image(specs, debugName)
+	{
+		Allocate();
+	}
+
+	NullImage::~NullImage()
+	{
+		Release();
+	}
+
+	void NullImage::Resize(const glm::uvec3& size)
+	{
+		if (m_Specs.Size == size)
+			return;
+
+		m_Specs.Size = size;
+		Release();
+		Allocate();
+		m_ResourceID = GenerateRenderResourceID();
+
+		if (m_Specs.Layout != ImageLayoutType::Unknown)
+		{
+			Ref<Image> image = shared_from_this();
+			RenderManager::Submit([image, layout = m_Specs.Layout](Ref<CommandBuffer>& cmd) mutable
+			{
+				cmd->TransitionLayout(image, ImageLayoutType::Unknown, layout);
+			});
+		}
+	}
+
+	void NullImage::Read(void* data, ImageLayout initialLayout, ImageLayout finalLayout)
+	{
+		memset(data, 0, CalculateImageMemorySize(m_Specs.Format, m_Specs.Size));
+	}
+
+	void NullImage::Read(void* data, size_t size, const glm::ivec3& position, const glm::uvec3& extent, ImageLayout initialLayout, ImageLayout finalLayout)
+	{
+		memset(data, 0, size);
+	}
+
+	ImageSubresourceLayout NullImage::GetImageSubresourceLayout(ImageView view) const
+	{
+		const glm::uvec3 mipSize = glm::max(m_Specs.Size >> view.MipLevel, glm::uvec3(1u));
+
+		ImageSubresourceLayout result;
+		result.RowPitch = (size_t)GetImageFormatBPP(m_Specs.Format) / 8 * mipSize.x;
+		result.DepthPitch = result.RowPitch * mipSize.y;
+		result.ArrayPitch = result.DepthPitch * mipSize.z;
+		result.Size = result.ArrayPitch;
+		return result;
+	}
+
+	void NullImage::Allocate()
+	{
+		if (bCalculateMipsCountInternally)
+			m_Specs.MipsCount = CalculateMipCount(m_Specs.Size);
+
+		m_MemorySize = 0;
+		for (uint32_t mip = 0; mip < m_Specs.MipsCount; ++mip)
+		{
+			const glm::uvec3 mipSize = glm::max(m_Specs.Size >> mip, glm::uvec3(1u));
+			m_MemorySize += CalculateImageMemorySize(m_Specs.Format, mipSize) * GetLayersCount();
+		}
+		m_MemorySize *= size_t(m_Specs.SamplesCount);
+
+		if (m_Specs.MemoryType != MemoryType::Gpu)
+			m_Memory.resize(m_MemorySize);
+		NullContext::OnAllocated(m_MemorySize);
+	}
+
+	void NullImage::Release()
+	{
+		NullContext::OnFreed(m_MemorySize);
+		m_MemorySize = 0;
+		m_Memory.clear();
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Image.h"
+
+namespace Eagle
+{
+	class NullImage : public Image
+	{
+	public:
+		NullImage(const ImageSpecifications& specs, const std::string& debugName = "");
+		virtual ~NullImage();
+
+		void* GetHandle() const override { return (void*)this; }
+
+		void* GetImageViewHandle() const override { return (void*)this; }
+		void* GetImageViewHandle(const ImageView& viewInfo, bool bForce2D = false) const override { return (void*)this; }
+
+		void Resize(const glm::uvec3& size) override;
+
+		// Only CPU-visible images have memory. Others are never mapped
+		[[nodiscard]] void* Map() override
+		{
+			assert(m_Specs.MemoryType != MemoryType::Gpu);
+			return m_Memory.data();
+		}
+		void Unmap() override {}
+
+		// There's no data on the GPU side, so zeros are returned
+		void Read(void* data, ImageLayout initialLayout, ImageLayout finalLayout) override;
+		void Read(void* data, size_t size, const glm::ivec3& position, const glm::uvec3& extent, ImageLayout initialLayout, ImageLayout finalLayout) override;
+
+		ImageSubresourceLayout GetImageSubresourceLayout(ImageView view) const override;
+
+	private:
+		void Allocate();
+		void Release();
+
+	private:
+		std::vector<uint8_t> m_Memory;
+		size_t m_MemorySize = 0;
+	};
+}
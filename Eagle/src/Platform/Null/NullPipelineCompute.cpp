@@ -0,0 +1,34 @@
+#include "egpch.h"
+#include "NullPipelineCompute.h"
+
+namespace Eagle
+{
+	NullPipelineCompute::NullPipelineCompute(const PipelineComputeState& state, const Ref<PipelineCompute>& parentPipeline)
+		: PipelineCompute(state)
+	{
+		assert(m_State.ComputeShader->GetType() == ShaderType::Compute);
+		Recreate();
+	}
+
+	void NullPipelineCompute::SetState(const PipelineComputeState& state)
+	{
+		if (m_State.ComputeShader != state.ComputeShader)
+		{
+			const Ref<Pipeline> thisPipeline = shared_from_this();
+			RenderManager::RemoveShaderDependency(m_State.ComputeShader.get(), thisPipeline);
+			RenderManager::RegisterShaderDependency(state.ComputeShader.get(), thisPipeline);
+		}
+		m_State = state;
+
+		Recreate();
+	}
+
+	void NullPipelineCompute::Recreate()
+	{
+		ClearDescriptorSets();
+
+		for (auto& perFrameData : m_DescriptorSetData)
+			for (auto& data : perFrameData)
+				data.second.MakeDirty();
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/PipelineCompute.h"
+
+namespace Eagle
+{
+	class NullPipelineCompute : public PipelineCompute
+	{
+	public:
+		NullPipelineCompute(const PipelineComputeState& state, const Ref<PipelineCompute>& parentPipeline = nullptr);
+
+		void SetState(const PipelineComputeState& state) override;
+
+		void* GetPipelineHandle() const override { return (void*)this; }
+		void* GetPipelineLayoutHandle() const override { return (void*)this; }
+		bool IsBindlessSet(uint32_t set) const override { return false; }
+
+		void Recreate() override;
+	};
+}
@@ -0,0 +1,70 @@
+#include "egpch.h"
+#include "NullPipelineGraphics.h"
+
+namespace Eagle
+{
+	NullPipelineGraphics::NullPipelineGraphics(const PipelineGraphicsState& state, const Ref<PipelineGraphics>& parentPipeline)
+		: PipelineGraphics(state)
+	{
+		Recreate();
+	}
+
+	void NullPipelineGraphics::SetState(const PipelineGraphicsState& state)
+	{
+		const Ref<Pipeline> thisPipeline = shared_from_this();
+
+		if (m_State.VertexShader != state.VertexShader)
+		{
+			RenderManager::RemoveShaderDependency(m_State.VertexShader.get(), thisPipeline);
+			if (state.VertexShader)
+				RenderManager::RegisterShaderDependency(state.VertexShader.get(), thisPipeline);
+		}
+
+		if (m_State.FragmentShader && m_State.FragmentShader != state.FragmentShader)
+		{
+			RenderManager::RemoveShaderDependency(m_State.FragmentShader.get(), thisPipeline);
+			if (state.FragmentShader)
+				RenderManager::RegisterShaderDependency(state.FragmentShader.get(), thisPipeline);
+		}
+
+		if (m_State.GeometryShader && m_State.GeometryShader != state.GeometryShader)
+		{
+			RenderManager::RemoveShaderDependency(m_State.GeometryShader.get(), thisPipeline);
+			if (state.GeometryShader)
+				RenderManager::RegisterShaderDependency(state.GeometryShader.get(), thisPipeline);
+		}
+
+		m_State = state;
+		Recreate();
+	}
+
+	void NullPipelineGraphics::Recreate()
+	{
+		EG_CORE_ASSERT(m_State.VertexShader->GetType() == ShaderType::Vertex);
+		EG_CORE_ASSERT(!m_State.FragmentShader || (m_State.FragmentShader->GetType() == ShaderType::Fragment));
+		EG_CORE_ASSERT(!m_State.GeometryShader || (m_State.GeometryShader->GetType() == ShaderType::Geometry));
+		ClearDescriptorSets();
+
+		for (auto& perFrameData : m_DescriptorSetData)
+			for (auto& data : perFrameData)
+				data.second.MakeDirty();
+
+		m_Width = m_State.Size.x;
+		m_Height = m_State.Size.y;
+		if (m_Width == 0 || m_Height == 0)
+		{
+			const Ref<Image>& image = m_State.ColorAttachments.size() ? m_State.ColorAttachments[0].Image : m_State.DepthStencilAttachment.Image;
+			if (image)
+			{
+				m_Width = image->GetSize().x;
+				m_Height = image->GetSize().y;
+			}
+		}
+	}
+
+	void NullPipelineGraphics::Resize(uint32_t width, uint32_t height)
+	{
+		m_Width = width;
+		m_Height = height;
+	}
+}
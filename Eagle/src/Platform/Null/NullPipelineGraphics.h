@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/PipelineGraphics.h"
+
+namespace Eagle
+{
+	class NullPipelineGraphics : public PipelineGraphics
+	{
+	public:
+		NullPipelineGraphics(const PipelineGraphicsState& state, const Ref<PipelineGraphics>& parentPipeline = nullptr);
+
+		void SetState(const PipelineGraphicsState& state) override;
+
+		void* GetRenderPassHandle() const override { return (void*)this; };
+		void* GetFramebufferHandle() const override { return (void*)this; };
+		void* GetPipelineHandle() const override { return (void*)this; };
+		void* GetPipelineLayoutHandle() const override { return (void*)this; };
+		bool IsBindlessSet(uint32_t set) const override { return false; }
+
+		void Recreate() override;
+
+		void Resize(uint32_t width, uint32_t height) override;
+	};
+}
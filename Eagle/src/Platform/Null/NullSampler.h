@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Sampler.h"
+
+namespace Eagle
+{
+	class NullSampler : public Sampler
+	{
+	public:
+		NullSampler(FilterMode filterMode, AddressMode addressMode, CompareOperation compareOp, float minLod, float maxLod, float maxAnisotropy = 1.f)
+			: Sampler(filterMode, addressMode, compareOp, minLod, maxLod, maxAnisotropy) {}
+
+		void* GetHandle() const override { return (void*)this; }
+	};
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Semaphore.h"
+
+namespace Eagle
+{
+	class NullSemaphore : public Semaphore
+	{
+	public:
+		void* GetHandle() const override { return (void*)this; }
+	};
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Shader.h"
+#include "Eagle/Renderer/RenderManager.h"
+
+namespace Eagle
+{
+	// Shaders are neither read nor compiled. So there's no reflection data either: push constant ranges are empty
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(const Path& path, ShaderType shaderType, const ShaderDefines& defines = {})
+			: Shader(path, shaderType, defines)
+		{
+			m_Hash = std::hash<Path>()(path);
+		}
+
+		void Reload() override
+		{
+			OnReloaded();
+			RenderManager::OnShaderReloaded(this);
+		}
+
+		void SetDefines(const ShaderDefines& defines) override
+		{
+			m_Defines = defines;
+			Reload();
+		}
+	};
+}
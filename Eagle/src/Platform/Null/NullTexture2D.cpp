@@ -0,0 +1,105 @@
+#include "egpch.h"
+#include "NullTexture2D.h"
+#include "NullImage.h"
+
+#include "Eagle/Renderer/VidWrappers/RenderCommandManager.h"
+#include "Eagle/Renderer/TextureSystem.h"
+
+namespace Eagle
+{
+	NullTexture2D::NullTexture2D(const Path& filepath, const Texture2DSpecifications& specs)
+		: Texture2D(filepath, specs)
+	{
+		if (Load(m_Path))
+		{
+			CreateImageFromData();
+		}
+		else
+		{
+			EG_CORE_ASSERT(!"Failed to load texture");
+			ImageSpecifications imageSpecs;
+			imageSpecs.Size = glm::uvec3{ 1, 1, 1 };
+			imageSpecs.Format = ImageFormat::R8G8B8A8_UNorm;
+			imageSpecs.Usage = ImageUsage::Sampled;
+			m_Image = MakeRef<NullImage>(imageSpecs);
+			m_Sampler = Sampler::Create(m_Specs.FilterMode, m_Specs.AddressMode, CompareOperation::Never, 0.f, 0.f, m_Specs.MaxAnisotropy);
+			m_bIsLoaded = true; // Loaded meaning we can use it.
+		}
+	}
+
+	NullTexture2D::NullTexture2D(ImageFormat format, glm::uvec2 size, const void* data, const Texture2DSpecifications& specs, const std::string& debugName)
+		: Texture2D(format, size, specs)
+	{
+		EG_ASSERT(data);
+		size_t dataSize = CalculateImageMemorySize(m_Format, m_Size.x, m_Size.y);
+		m_ImageData = DataBuffer::Copy(data, dataSize);
+		m_Path = debugName;
+		CreateImageFromData();
+	}
+
+	void NullTexture2D::SetAnisotropy(float anisotropy)
+	{
+		const uint32_t mipsCount = m_Image->GetMipsCount();
+		m_Sampler = Sampler::Create(m_Specs.FilterMode, m_Specs.AddressMode, CompareOperation::Never, 0.f, float(mipsCount - 1), anisotropy);
+		m_Specs.MaxAnisotropy = m_Sampler->GetMaxAnisotropy();
+
+		TextureSystem::OnTextureChanged(shared_from_this());
+	}
+
+	void NullTexture2D::SetFilterMode(FilterMode filterMode)
+	{
+		const uint32_t mipsCount = m_Image->GetMipsCount();
+		m_Specs.FilterMode = filterMode;
+		m_Sampler = Sampler::Create(m_Specs.FilterMode, m_Specs.AddressMode, CompareOperation::Never, 0.f, float(mipsCount - 1), m_Specs.MaxAnisotropy);
+
+		TextureSystem::OnTextureChanged(shared_from_this());
+	}
+
+	void NullTexture2D::SetAddressMode(AddressMode addressMode)
+	{
+		const uint32_t mipsCount = m_Image->GetMipsCount();
+		m_Specs.AddressMode = addressMode;
+		m_Sampler = Sampler::Create(m_Specs.FilterMode, m_Specs.AddressMode, CompareOperation::Never, 0.f, float(mipsCount - 1), m_Specs.MaxAnisotropy);
+
+		TextureSystem::OnTextureChanged(shared_from_this());
+	}
+
+	void NullTexture2D::GenerateMips(uint32_t mipsCount)
+	{
+		m_Specs.MipsCount = mipsCount;
+		CreateImageFromData();
+
+		TextureSystem::OnTextureChanged(shared_from_this());
+	}
+
+	void NullTexture2D::CreateImageFromData()
+	{
+		if (!m_ImageData)
+			return;
+
+		m_Specs.MipsCount = glm::min(CalculateMipCount(m_Size), m_Specs.MipsCount);
+		const bool bGenerateMips = m_Specs.MipsCount > 1;
+
+		ImageSpecifications imageSpecs;
+		imageSpecs.Size = m_Size;
+		imageSpecs.Format = m_Format;
+		imageSpecs.Usage = ImageUsage::Sampled | ImageUsage::TransferDst;
+		imageSpecs.SamplesCount = m_Specs.SamplesCount;
+		imageSpecs.MipsCount = m_Specs.MipsCount;
+		if (bGenerateMips)
+			imageSpecs.Usage |= ImageUsage::TransferSrc;
+
+		m_Image = MakeRef<NullImage>(imageSpecs, m_Path.filename().u8string());
+
+		const uint32_t mipsCount = m_Image->GetMipsCount();
+		m_Sampler = Sampler::Create(m_Specs.FilterMode, m_Specs.AddressMode, CompareOperation::Never, 0.f, float(mipsCount - 1), m_Specs.MaxAnisotropy);
+
+		RenderManager::Submit([image = m_Image, imageData = m_ImageData.GetDataBuffer(), pLoaded = &m_bIsLoaded, bGenerateMips](Ref<CommandBuffer>& cmd) mutable
+		{
+			cmd->Write(image, imageData.Data, imageData.Size, ImageLayoutType::Unknown, ImageReadAccess::PixelShaderRead);
+			if (bGenerateMips)
+				cmd->GenerateMips(image, ImageReadAccess::PixelShaderRead, ImageReadAccess::PixelShaderRead);
+			*pLoaded = true;
+		});
+	}
+}
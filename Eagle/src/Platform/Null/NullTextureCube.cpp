@@ -0,0 +1,66 @@
+#include "egpch.h"
+#include "NullTextureCube.h"
+#include "NullTexture2D.h"
+#include "NullImage.h"
+
+#include "Eagle/Renderer/VidWrappers/Framebuffer.h"
+#include "Eagle/Renderer/VidWrappers/PipelineGraphics.h"
+
+namespace Eagle
+{
+	NullTextureCube::NullTextureCube(const Path& filepath, uint32_t layerSize)
+		: TextureCube(filepath, layerSize)
+	{
+		m_Texture2D = MakeRef<NullTexture2D>(filepath, Texture2DSpecifications{});
+		m_Sampler = Sampler::PointSampler;
+
+		CreateImages();
+	}
+
+	NullTextureCube::NullTextureCube(const Ref<Texture2D>& texture, uint32_t layerSize)
+		: TextureCube(texture, layerSize)
+	{
+		m_Sampler = Sampler::PointSampler;
+
+		CreateImages();
+	}
+
+	void NullTextureCube::CreateImages()
+	{
+		ImageSpecifications imageSpecs;
+		imageSpecs.Size = m_Size;
+		imageSpecs.Format = ImageFormat::R16G16B16A16_Float;
+		imageSpecs.Usage = ImageUsage::ColorAttachment | ImageUsage::Sampled | ImageUsage::TransferSrc | ImageUsage::TransferDst;
+		imageSpecs.Layout = ImageReadAccess::PixelShaderRead;
+		imageSpecs.bIsCube = true;
+		imageSpecs.MipsCount = UINT_MAX;
+		m_Image = MakeRef<NullImage>(imageSpecs, "CubeImage");
+
+		ImageSpecifications irradianceImageSpecs;
+		irradianceImageSpecs.Size = glm::uvec3{ TextureCube::IrradianceSize, TextureCube::IrradianceSize, 1 };
+		irradianceImageSpecs.Format = ImageFormat::R16G16B16A16_Float;
+		irradianceImageSpecs.Usage = ImageUsage::ColorAttachment | ImageUsage::Sampled;
+		irradianceImageSpecs.Layout = ImageReadAccess::PixelShaderRead;
+		irradianceImageSpecs.bIsCube = true;
+		m_IrradianceImage = MakeRef<NullImage>(irradianceImageSpecs, "IrradianceCubeImage");
+
+		ImageSpecifications prefilterImageSpecs;
+		prefilterImageSpecs.Size = glm::uvec3{ TextureCube::PrefilterSize, TextureCube::PrefilterSize, 1 };
+		prefilterImageSpecs.Format = ImageFormat::R16G16B16A16_Float;
+		prefilterImageSpecs.Usage = ImageUsage::ColorAttachment | ImageUsage::Sampled | ImageUsage::TransferSrc | ImageUsage::TransferDst;
+		prefilterImageSpecs.Layout = ImageReadAccess::PixelShaderRead;
+		prefilterImageSpecs.bIsCube = true;
+		prefilterImageSpecs.MipsCount = glm::min(CalculateMipCount(prefilterImageSpecs.Size), 6u);
+		m_PrefilterImage = MakeRef<NullImage>(prefilterImageSpecs, "PrefilterCubeImage");
+		m_PrefilterImageSampler = Sampler::Create(FilterMode::Trilinear, AddressMode::Clamp, CompareOperation::Never, 0.f, float(prefilterImageSpecs.MipsCount - 1u));
+
+		const void* renderpassHandle = RenderManager::GetIBLPipeline()->GetRenderPassHandle();
+		ImageView imageView{};
+		imageView.LayersCount = 1;
+		for (uint32_t i = 0; i < m_Framebuffers.size(); ++i)
+		{
+			imageView.Layer = i;
+			m_Framebuffers[i] = Framebuffer::Create(m_Image, imageView, { m_Size.x, m_Size.y }, renderpassHandle);
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Eagle/Renderer/VidWrappers/Texture.h"
+
+namespace Eagle
+{
+	// Creates the same images as other backends, but IBL isn't generated
+	class NullTextureCube : public TextureCube
+	{
+	public:
+		NullTextureCube(const Ref<Texture2D>& texture, uint32_t layerSize);
+		NullTextureCube(const Path& filepath, uint32_t layerSize);
+
+	private:
+		void CreateImages();
+	};
+}
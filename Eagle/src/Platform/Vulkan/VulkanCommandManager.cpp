@@ -197,6 +197,9 @@ namespace Eagle
 
 		VK_CHECK(vkBeginCommandBuffer(m_CommandBuffer, &info));
 		m_bIsRecording = true;
+
+		ResetBoundDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS);
+		ResetBoundDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE);
 	}
 
 	void VulkanCommandBuffer::End()
@@ -209,6 +212,7 @@ namespace Eagle
 	void VulkanCommandBuffer::Dispatch(Ref<PipelineCompute>& pipeline, uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ, const void* pushConstants)
 	{
 		vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, (VkPipeline)pipeline->GetPipelineHandle());
+		++RenderManager::GetCurrentRHIStats().PipelineBinds;
 
 		Ref<Pipeline> purePipeline = Cast<Pipeline>(pipeline);
 		CommitDescriptors(purePipeline, VK_PIPELINE_BIND_POINT_COMPUTE);
@@ -222,6 +226,7 @@ namespace Eagle
 		}
 
 		vkCmdDispatch(m_CommandBuffer, numGroupsX, numGroupsY, numGroupsZ);
+		++RenderManager::GetCurrentRHIStats().Dispatches;
 	}
 
 	void VulkanCommandBuffer::BeginGraphics(Ref<PipelineGraphics>& pipeline)
@@ -231,6 +236,9 @@ namespace Eagle
 		m_CurrentGraphicsPipeline = vulkanPipeline;
 		m_CurrentFramebuffer.reset();
 
+		// Other code (for example, ImGui) might bind its own sets inside of a render pass, so tracking is restarted for each pass
+		ResetBoundDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS);
+
 		size_t usedResolveAttachmentsCount = std::count_if(state.ResolveAttachments.begin(), state.ResolveAttachments.end(), [](const auto& attachment) { return attachment.Image; });
 		std::vector<VkClearValue> clearValues(state.ColorAttachments.size() + usedResolveAttachmentsCount);
 		size_t i = 0;
@@ -260,7 +268,10 @@ namespace Eagle
 		beginInfo.framebuffer = vulkanPipeline->m_Framebuffer;
 		beginInfo.clearValueCount = uint32_t(clearValues.size());
 		beginInfo.pClearValues = clearValues.data();
-		beginInfo.renderArea.extent = { vulkanPipeline->m_Width, vulkanPipeline->m_Height };
+		// Viewport stays the same, only the area that is going to be touched is reduced
+		const VkExtent2D renderArea = { glm::min(vulkanPipeline->m_Width, uint32_t(glm::ceil(vulkanPipeline->m_Width * m_RenderAreaScale))),
+			glm::min(vulkanPipeline->m_Height, uint32_t(glm::ceil(vulkanPipeline->m_Height * m_RenderAreaScale))) };
+		beginInfo.renderArea.extent = renderArea;
 		vkCmdBeginRenderPass(m_CommandBuffer, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
 
 		VkViewport viewport{};
@@ -271,16 +282,21 @@ namespace Eagle
 		vkCmdSetViewport(m_CommandBuffer, 0, 1, &viewport);
 
 		VkRect2D scissor{};
-		scissor.extent = { vulkanPipeline->m_Width, vulkanPipeline->m_Height };
+		scissor.extent = renderArea;
 		vkCmdSetScissor(m_CommandBuffer, 0, 1, &scissor);
 
 		vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vulkanPipeline->m_GraphicsPipeline);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.RenderPassBegins;
+		++stats.PipelineBinds;
 	}
 
 	void VulkanCommandBuffer::BeginGraphics(Ref<PipelineGraphics>& pipeline, const Ref<Framebuffer>& framebuffer)
 	{
 		m_CurrentGraphicsPipeline = Cast<VulkanPipelineGraphics>(pipeline);
 		m_CurrentFramebuffer = framebuffer;
+		ResetBoundDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS);
 
 		auto& state = pipeline->GetState();
 
@@ -319,6 +335,10 @@ namespace Eagle
 		vkCmdBeginRenderPass(m_CommandBuffer, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
 		vkCmdBindPipeline(m_CommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_CurrentGraphicsPipeline->m_GraphicsPipeline);
 
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.RenderPassBegins;
+		++stats.PipelineBinds;
+
 		VkViewport viewport{};
 		viewport.width = float(size.x);
 		viewport.height = float(size.y);
@@ -370,6 +390,7 @@ namespace Eagle
 		Ref<Pipeline> purePipeline = Cast<Pipeline>(m_CurrentGraphicsPipeline);
 		CommitDescriptors(purePipeline, VK_PIPELINE_BIND_POINT_GRAPHICS);
 		vkCmdDraw(m_CommandBuffer, vertexCount, 1, firstVertex, 0);
+		++RenderManager::GetCurrentRHIStats().Draws;
 	}
 
 	void VulkanCommandBuffer::Draw(const Ref<Buffer>& vertexBuffer, uint32_t vertexCount, uint32_t firstVertex)
@@ -384,6 +405,10 @@ namespace Eagle
 		CommitDescriptors(purePipeline, VK_PIPELINE_BIND_POINT_GRAPHICS);
 		vkCmdBindVertexBuffers(m_CommandBuffer, 0, 1, &vkVertex, offsets);
 		vkCmdDraw(m_CommandBuffer, vertexCount, 1, firstVertex, 0);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.VertexBufferBinds;
+		++stats.Draws;
 	}
 
 	void VulkanCommandBuffer::DrawIndexedInstanced(const Ref<Buffer>& vertexBuffer, const Ref<Buffer>& indexBuffer, uint32_t indexCount, uint32_t firstIndex, int32_t vertexOffset,
@@ -402,6 +427,11 @@ namespace Eagle
 		vkCmdBindVertexBuffers(m_CommandBuffer, 0, 2, vertexBuffers, offsets);
 		vkCmdBindIndexBuffer(m_CommandBuffer, (VkBuffer)indexBuffer->GetHandle(), 0, VK_INDEX_TYPE_UINT32);
 		vkCmdDrawIndexed(m_CommandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.VertexBufferBinds;
+		++stats.IndexBufferBinds;
+		++stats.Draws;
 	}
 
 	void VulkanCommandBuffer::DrawIndexed(const Ref<Buffer>& vertexBuffer, const Ref<Buffer>& indexBuffer, uint32_t indexCount, uint32_t firstIndex, uint32_t vertexOffset)
@@ -420,6 +450,11 @@ namespace Eagle
 		vkCmdBindIndexBuffer(m_CommandBuffer, vkIndex, 0, VK_INDEX_TYPE_UINT32);
 
 		vkCmdDrawIndexed(m_CommandBuffer, indexCount, 1, firstIndex, vertexOffset, 0);
+
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.VertexBufferBinds;
+		++stats.IndexBufferBinds;
+		++stats.Draws;
 	}
 
 	void VulkanCommandBuffer::ExecuteSecondary(const Ref<CommandBuffer>& secondaryCmd)
@@ -428,6 +463,10 @@ namespace Eagle
 
 		VkCommandBuffer vkSecondaryCmd = (VkCommandBuffer)secondaryCmd->GetHandle();
 		vkCmdExecuteCommands(m_CommandBuffer, 1, &vkSecondaryCmd);
+
+		// Bound state is undefined after executing secondary command buffers
+		ResetBoundDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS);
+		ResetBoundDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE);
 	}
 
 	void VulkanCommandBuffer::SetGraphicsRootConstants(const void* vertexRootConstants, const void* fragmentRootConstants)
@@ -518,6 +557,7 @@ namespace Eagle
 			0, nullptr,
 			0, nullptr,
 			1, &barrier);
+		++RenderManager::GetCurrentRHIStats().Barriers;
 	}
 
 	void VulkanCommandBuffer::ClearColorImage(Ref<Image>& image, const glm::vec4& color)
@@ -627,6 +667,7 @@ namespace Eagle
 			0, nullptr,
 			1, &barrier,
 			0, nullptr);
+		++RenderManager::GetCurrentRHIStats().Barriers;
 	}
 
 	void VulkanCommandBuffer::CopyBuffer(const Ref<Buffer>& src, Ref<Buffer>& dst, size_t srcOffset, size_t dstOffset, size_t size)
@@ -749,6 +790,10 @@ namespace Eagle
 		memcpy(mapped, data, size);
 		stagingBuffer->Unmap();
 
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.StagingAllocations;
+		stats.BytesWritten += size;
+
 		if (initialLayout != ImageLayoutType::CopyDest)
 			TransitionLayout(image, initialLayout, ImageLayoutType::CopyDest);
 
@@ -778,6 +823,10 @@ namespace Eagle
 		memcpy(mapped, data, size);
 		stagingBuffer->Unmap();
 
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		++stats.StagingAllocations;
+		stats.BytesWritten += size;
+
 		if (initialLayout != BufferLayoutType::CopyDest)
 			TransitionLayout(buffer, initialLayout, BufferLayoutType::CopyDest);
 
@@ -866,7 +915,6 @@ namespace Eagle
 		}
 	}
 
-#ifdef EG_GPU_TIMINGS
 	void VulkanCommandBuffer::StartTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex)
 	{
 		VkQueryPool pool = (VkQueryPool)timing->GetQueryPoolHandle();
@@ -881,6 +929,7 @@ namespace Eagle
 		vkCmdWriteTimestamp(m_CommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pool, frameIndex * 2 + 1);
 	}
 
+#ifdef EG_GPU_TIMINGS
 	void VulkanCommandBuffer::BeginMarker(std::string_view name)
 	{
 		auto func = VulkanContext::GetFunctions().cmdBeginDebugUtilsLabelEXT;
@@ -912,60 +961,71 @@ namespace Eagle
 
 	void VulkanCommandBuffer::CommitDescriptors(Ref<Pipeline>& pipeline, VkPipelineBindPoint bindPoint)
 	{
-		struct SetData
-		{
-			const DescriptorSet* DescriptorSet = nullptr;
-			DescriptorSetData* Data = nullptr;
-			uint32_t Set;
-		};
+		// Reused to avoid allocations on each draw
+		static thread_local std::vector<DescriptorWriteData> writeDatas;
+		writeDatas.clear();
 
-		auto& descriptorSetsData = pipeline->GetDescriptorSetsData();
-		std::vector<SetData> dirtyDatas;
-		dirtyDatas.reserve(descriptorSetsData.size());
-		for (auto& it : descriptorSetsData)
-		{
-			if (it.second.IsDirty())
-				dirtyDatas.push_back({ nullptr, &it.second, it.first });
-		}
-
-		const size_t dirtyDataCount = dirtyDatas.size();
-		std::vector<DescriptorWriteData> writeDatas;
-		writeDatas.reserve(dirtyDataCount);
+		RHIStatistics& stats = RenderManager::GetCurrentRHIStats();
+		pipeline->ReleaseStaleDescriptorSets();
 
-		// Populating writeData. Allocating DescriptorSet if neccessary
+		// Resolving descriptor sets for the data that has changed. If the same resources were already bound to a set before, it's reused
+		auto& descriptorSetsData = pipeline->GetDescriptorSetsData();
 		auto& descriptorSets = pipeline->GetDescriptorSets();
-		for (size_t i = 0; i < dirtyDataCount; ++i)
+		for (auto& [set, data] : descriptorSetsData)
 		{
-			uint32_t set = dirtyDatas[i].Set;
-			const DescriptorSet* currentDescriptorSet = dirtyDatas[i].DescriptorSet;
+			Ref<DescriptorSet>& descriptorSet = descriptorSets[set];
+			if (descriptorSet && !data.IsDirty())
+				continue;
+
+			bool bAllocated = false;
+			descriptorSet = pipeline->GetOrAllocateDescriptorSet(set, data, bAllocated);
+			EG_CORE_ASSERT(descriptorSet);
 
-			if (currentDescriptorSet == nullptr)
+			if (bAllocated)
+				writeDatas.push_back({ descriptorSet.get(), &data });
+			else
 			{
-				auto it = descriptorSets.find(set);
-				if (it == descriptorSets.end())
-					currentDescriptorSet = pipeline->AllocateDescriptorSet(set).get();
-				else
-					currentDescriptorSet = it->second.get();
+				data.OnFlushed();
+				++stats.DescriptorCacheHits;
 			}
-
-			EG_CORE_ASSERT(currentDescriptorSet);
-			writeDatas.push_back({ currentDescriptorSet, dirtyDatas[i].Data });
 		}
 
-		if (dirtyDataCount)
+		if (writeDatas.size())
+		{
 			DescriptorManager::WriteDescriptors(pipeline, writeDatas);
+			stats.DescriptorWrites += uint32_t(writeDatas.size());
+		}
 
+		// Binding sets that differ from the currently bound ones
+		BoundDescriptorSets& boundSets = bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE ? m_BoundComputeSets : m_BoundGraphicsSets;
 		VkPipelineLayout vkPipelineLayout = (VkPipelineLayout)pipeline->GetPipelineLayoutHandle();
-		for (auto& it : descriptorSetsData)
+		if (boundSets.PipelineLayout != vkPipelineLayout)
 		{
-			uint32_t set = it.first;
-			auto it = descriptorSets.find(set);
-			assert(it != descriptorSets.end());
+			boundSets.PipelineLayout = vkPipelineLayout;
+			boundSets.Sets.clear();
+		}
+
+		for (auto& [set, descriptorSet] : descriptorSets)
+		{
+			if (set >= boundSets.Sets.size())
+				boundSets.Sets.resize(size_t(set) + 1, VK_NULL_HANDLE);
+
+			VkDescriptorSet vkDescriptorSet = (VkDescriptorSet)descriptorSet->GetHandle();
+			if (boundSets.Sets[set] == vkDescriptorSet)
+				continue;
 
-			VkDescriptorSet descriptorSet = (VkDescriptorSet)it->second->GetHandle();
 			vkCmdBindDescriptorSets(m_CommandBuffer, bindPoint, vkPipelineLayout,
-				set, 1, &descriptorSet, 0, nullptr);
+				set, 1, &vkDescriptorSet, 0, nullptr);
+			boundSets.Sets[set] = vkDescriptorSet;
+			++stats.DescriptorBinds;
 		}
 	}
 
+	void VulkanCommandBuffer::ResetBoundDescriptorSets(VkPipelineBindPoint bindPoint)
+	{
+		BoundDescriptorSets& boundSets = bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE ? m_BoundComputeSets : m_BoundGraphicsSets;
+		boundSets.PipelineLayout = VK_NULL_HANDLE;
+		boundSets.Sets.clear();
+	}
+
 }
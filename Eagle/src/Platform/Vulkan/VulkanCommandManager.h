@@ -59,6 +59,7 @@ namespace Eagle
 		void Dispatch(Ref<PipelineCompute>& pipeline, uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ, const void* pushConstants = nullptr) override;
 
 		void BeginGraphics(Ref<PipelineGraphics>& pipeline) override;
+		void SetRenderAreaScale(float scale) override { m_RenderAreaScale = scale; }
 		void BeginGraphics(Ref<PipelineGraphics>& pipeline, const Ref<Framebuffer>& framebuffer) override;
 		void EndGraphics() override;
 		void Draw(uint32_t vertexCount, uint32_t firstVertex) override;
@@ -93,9 +94,10 @@ namespace Eagle
 
 		void GenerateMips(Ref<Image>& image, ImageLayout initialLayout, ImageLayout finalLayout) override;
 
-#ifdef EG_GPU_TIMINGS
 		virtual void StartTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex) override;
 		virtual void EndTiming(Ref<RHIGPUTiming>& timing, uint32_t frameIndex) override;
+
+#ifdef EG_GPU_TIMINGS
 		virtual void BeginMarker(std::string_view name) override;
 		virtual void EndMarker() override;
 #endif
@@ -104,8 +106,16 @@ namespace Eagle
 
 	private:
 		void CommitDescriptors(Ref<Pipeline>& pipeline, VkPipelineBindPoint bindPoint);
+		void ResetBoundDescriptorSets(VkPipelineBindPoint bindPoint);
 
 	private:
+		// Descriptor sets that are currently bound to the command buffer. Used to skip redundant binds
+		struct BoundDescriptorSets
+		{
+			VkPipelineLayout PipelineLayout = VK_NULL_HANDLE;
+			std::vector<VkDescriptorSet> Sets;
+		};
+
 		std::unordered_set<StagingBuffer*> m_UsedStagingBuffers;
 		VkDevice m_Device = VK_NULL_HANDLE;
 		VkCommandPool m_CommandPool = VK_NULL_HANDLE;
@@ -113,6 +123,9 @@ namespace Eagle
 		VkQueueFlags m_QueueFlags;
 		Ref<VulkanPipelineGraphics> m_CurrentGraphicsPipeline;
 		Ref<Framebuffer> m_CurrentFramebuffer;
+		BoundDescriptorSets m_BoundGraphicsSets;
+		BoundDescriptorSets m_BoundComputeSets;
+		float m_RenderAreaScale = 1.f;
 		bool m_bIsPrimary = true;
 		bool m_bIsRecording = false;
 
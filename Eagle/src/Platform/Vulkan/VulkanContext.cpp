@@ -155,7 +155,12 @@ namespace Eagle
 
 		static std::vector<const char*> GetRequiredExtensions()
 		{
-			std::vector<const char*> instanceExtensions = { VK_KHR_SURFACE_EXTENSION_NAME, "VK_KHR_win32_surface" };
+			std::vector<const char*> instanceExtensions;
+			if (!RendererContext::IsHeadless())
+			{
+				instanceExtensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+				instanceExtensions.push_back("VK_KHR_win32_surface");
+			}
 			if constexpr (s_EnableValidation)
 			{
 				instanceExtensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
@@ -61,21 +61,28 @@ namespace Eagle
 
     void VulkanDescriptorManager::WriteDescriptors(const Ref<Pipeline>& pipeline, const std::vector<DescriptorWriteData>& writeDatas)
     {
-        std::vector<VkDescriptorBufferInfo> buffers;
-        std::vector<VkBufferView> bufferViews;
-        std::vector<VkDescriptorImageInfo> images;
-        std::vector<VkWriteDescriptorSet> vkWriteDescriptorSets;
+        // Scratch containers are reused between calls to avoid allocations
+        static thread_local std::vector<VkDescriptorBufferInfo> buffers;
+        static thread_local std::vector<VkBufferView> bufferViews;
+        static thread_local std::vector<VkDescriptorImageInfo> images;
+        static thread_local std::vector<VkWriteDescriptorSet> vkWriteDescriptorSets;
+
+        // Used to detect if the same image is used but with a different layout
+        // In that case, layout should be VK_IMAGE_LAYOUT_GENERAL.
+        static thread_local std::vector<std::pair<void*, VkDescriptorType>> imageBindingsTypes;
+        static thread_local std::vector<void*> nonUniqueImages; // Sorted
+        buffers.clear();
+        bufferViews.clear();
+        images.clear();
+        vkWriteDescriptorSets.clear();
+        imageBindingsTypes.clear();
+        nonUniqueImages.clear();
+
         size_t buffersInfoCount = 0;
         size_t imagesInfoCount = 0;
         Ref<VulkanPipeline> vulkanPipeline = Cast<VulkanPipeline>(pipeline);
         EG_ASSERT(vulkanPipeline);
 
-        // Used to detect if the same image is used but with a different layout
-        // In that case, layout should be VK_IMAGE_LAYOUT_GENERAL.
-        // Bool here means `IsUnique` so if it's false, use VK_IMAGE_LAYOUT_GENERAL
-        std::unordered_map<void*, bool> imageBindingsUnique;
-        std::unordered_map<void*, VkDescriptorType> imageBindingsTypes;
-
         for (auto& writeData : writeDatas)
         {
             uint32_t set = writeData.DescriptorSet->GetSetIndex();
@@ -93,28 +100,24 @@ namespace Eagle
                     imagesInfoCount += binding.descriptorCount + bindingData.ImageBindings.size();
 
                     for (auto& image : bindingData.ImageBindings)
-                    {
-                        auto itUnique = imageBindingsUnique.find(image.ImageHandle);
-                        if (itUnique != imageBindingsUnique.end())
-                        {
-                            auto itType = imageBindingsTypes.find(image.ImageHandle);
-                            EG_ASSERT(itType != imageBindingsTypes.end());
-
-                            if (itType->second != binding.descriptorType)
-                                itUnique->second = false;
-                        }
-                        else
-                        {
-                            imageBindingsUnique[image.ImageHandle] = true;
-                            imageBindingsTypes[image.ImageHandle] = binding.descriptorType;
-                        }
-                    }
+                        imageBindingsTypes.emplace_back(image.ImageHandle, binding.descriptorType);
                 }
                 else if (IsSamplerType(binding.descriptorType))
                     imagesInfoCount += bindingData.ImageBindings[0].SamplerHandle ? 1 : 0;
             }
         }
 
+        // After sorting, the same images go one after another. If types of neighbouring entries differ, the image isn't unique
+        std::sort(imageBindingsTypes.begin(), imageBindingsTypes.end());
+        for (size_t i = 1; i < imageBindingsTypes.size(); ++i)
+        {
+            const auto& prev = imageBindingsTypes[i - 1];
+            const auto& current = imageBindingsTypes[i];
+            if (prev.first == current.first && prev.second != current.second)
+                if (nonUniqueImages.empty() || nonUniqueImages.back() != current.first)
+                    nonUniqueImages.push_back(current.first);
+        }
+
         buffers.reserve(buffersInfoCount);
         bufferViews.reserve(buffersInfoCount);
         images.reserve(imagesInfoCount);
@@ -177,8 +180,8 @@ namespace Eagle
                             VkSampler sampler = (VkSampler)image.SamplerHandle;
                             VkImageView imageView = (VkImageView)image.ImageViewHandle;
                             VkImageLayout imageLayout;
-                            auto it = imageBindingsUnique.find(image.ImageHandle);
-                            if (it != imageBindingsUnique.end() && it->second == false) // If different layouts are used for the image, make it general
+                            const bool bUnique = !std::binary_search(nonUniqueImages.begin(), nonUniqueImages.end(), image.ImageHandle);
+                            if (!bUnique) // If different layouts are used for the image, make it general
                                 imageLayout = VK_IMAGE_LAYOUT_GENERAL;
                             else if ((binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE) || (binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER))
                                 imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
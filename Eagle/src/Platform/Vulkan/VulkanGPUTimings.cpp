@@ -1,8 +1,6 @@
 #include "egpch.h"
 #include "VulkanGPUTimings.h"
 
-#ifdef EG_GPU_TIMINGS
-
 #include "Eagle/Renderer/RenderManager.h"
 #include "VulkanContext.h"
 
@@ -40,5 +38,3 @@ namespace Eagle
 		}
 	}
 }
-
-#endif
@@ -1,7 +1,5 @@
 #pragma once
 
-#ifdef EG_GPU_TIMINGS
-
 #include "Vulkan.h"
 #include "Eagle/Debug/GPUTimings.h"
 
@@ -21,5 +19,3 @@ namespace Eagle
 		VkQueryPool m_Pool = VK_NULL_HANDLE;
 	};
 }
-
-#endif
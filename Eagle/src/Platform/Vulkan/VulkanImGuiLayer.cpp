@@ -21,13 +21,18 @@ namespace Eagle
 
 	void VulkanImGuiLayer::OnAttach()
 	{
+		Application& app = Application::Get();
+		GLFWwindow* window = app.GetWindow().GetGLFWWindow();
+		m_bHeadless = window == nullptr;
+
 		IMGUI_CHECKVERSION();
 		ImGui::CreateContext();
 		ImGuiIO& io = ImGui::GetIO();
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;  //Enagle Keyboard controls 
 		//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad; //Enable Gamepad controls
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;	   //Enable Docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;	   //Enable Multi-Viewport
+		if (!m_bHeadless)
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable; //Enable Multi-Viewport
 
 		io.Fonts->AddFontFromFileTTF("assets/fonts/opensans/OpenSans-Bold.ttf", 32.f * Window::s_HighDPIScaleFactor, 0, ImGui::GetIO().Fonts->GetGlyphRangesCyrillic());
 		io.FontDefault = io.Fonts->AddFontFromFileTTF("assets/fonts/opensans/OpenSans-Regular.ttf", 32.f * Window::s_HighDPIScaleFactor, 0, ImGui::GetIO().Fonts->GetGlyphRangesCyrillic());
@@ -50,9 +55,6 @@ namespace Eagle
 
 		SetDarkThemeColors();
 
-		Application& app = Application::Get();
-		GLFWwindow* window = app.GetWindow().GetGLFWWindow();
-
 		auto& vulkanContext = VulkanContext::Get();
 		auto device = VulkanContext::GetDevice();
 		auto vulkanDevice = device->GetVulkanDevice();
@@ -93,7 +95,8 @@ namespace Eagle
 		m_PersistantDescriptorPool = pool;
 
 		// Setup Platform/Renderer bindings
-		ImGui_ImplGlfw_InitForVulkan(window, true);
+		if (!m_bHeadless)
+			ImGui_ImplGlfw_InitForVulkan(window, true);
 		ImGui_ImplVulkan_InitInfo initInfo{};
 		initInfo.Instance = VulkanContext::GetInstance();
 		initInfo.PhysicalDevice = VulkanContext::GetDevice()->GetPhysicalDevice()->GetVulkanPhysicalDevice();
@@ -126,7 +129,8 @@ namespace Eagle
 
 			VK_CHECK(vkDeviceWaitIdle(device));
 			ImGui_ImplVulkan_Shutdown();
-			ImGui_ImplGlfw_Shutdown();
+			if (!m_bHeadless)
+				ImGui_ImplGlfw_Shutdown();
 			ImGui::DestroyContext();
 
 			vkDestroyDescriptorPool(device, presistantDescPool, nullptr);
@@ -138,7 +142,17 @@ namespace Eagle
 	void VulkanImGuiLayer::BeginFrame()
 	{
 		ImGui_ImplVulkan_NewFrame((VkDescriptorPool)m_Pools[s_FrameIndex]);
-		ImGui_ImplGlfw_NewFrame();
+		if (m_bHeadless)
+		{
+			Application& app = Application::Get();
+			const Window& window = app.GetWindow();
+
+			ImGuiIO& io = ImGui::GetIO();
+			io.DisplaySize = ImVec2(float(window.GetWidth()), float(window.GetHeight()));
+			io.DeltaTime = glm::max(app.GetTimestep().GetSeconds(), 0.0001f);
+		}
+		else
+			ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 		ImGuizmo::BeginFrame();
 
@@ -20,5 +20,6 @@ namespace Eagle
 	private:
 		void* m_PersistantDescriptorPool; // Used to init resources during ImGui initialization.
 		std::vector<void*> m_Pools; // Per frame pools to init and reset our resources
+		bool m_bHeadless = false; // No window, so there's no platform backend. Display size and delta time are set manually
 	};
 }
@@ -153,6 +153,7 @@ namespace Eagle
 
 		CreateImage();
 		CreateImageView();
+		m_ResourceID = GenerateRenderResourceID();
 
 		if (m_Specs.Layout != ImageLayoutType::Unknown)
 		{
@@ -10,7 +10,7 @@ namespace Eagle
 	class VulkanPipeline : virtual public Pipeline
 	{
 	public:
-		bool IsBindlessSet(uint32_t set) const { return m_SetBindings[set].bBindless; }
+		bool IsBindlessSet(uint32_t set) const override { return m_SetBindings[set].bBindless; }
 		const std::vector<VkDescriptorSetLayoutBinding>& GetSetBindings(uint32_t set) const { return m_SetBindings[set].Bindings; }
 		VkDescriptorSetLayout GetDescriptorSetLayout(uint32_t set) const { assert(set < m_SetLayouts.size()); return m_SetLayouts[set]; }
 		virtual ~VulkanPipeline()
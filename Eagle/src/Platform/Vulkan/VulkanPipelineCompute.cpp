@@ -59,8 +59,7 @@ namespace Eagle
 	
 	void VulkanPipelineCompute::Create(VkPipeline parentPipeline)
 	{
-		for (auto& set : m_DescriptorSets)
-			set.clear();
+		ClearDescriptorSets();
 
 		// Mark each descriptor as dirty so that there's no need to call
 		// `pipeline->Set*` (for example, pipeline->SetBuffer) after pipeline reloading
@@ -4,6 +4,8 @@
 #include "VulkanImage.h"
 #include "VulkanSemaphore.h"
 
+#include "Eagle/Utils/Utils.h"
+
 #include <GLFW/glfw3.h>
 
 namespace Eagle
@@ -58,11 +60,22 @@ namespace Eagle
 		VK_CHECK(glfwCreateWindowSurface(m_Instance, m_Window, nullptr, &m_Surface));
 	}
 
+	VulkanSwapchain::VulkanSwapchain(glm::uvec2 size)
+		: m_Extent{ size.x, size.y }
+		, m_Instance(VK_NULL_HANDLE)
+		, m_bOffscreen(true)
+	{
+		m_Format = { VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
+	}
+
 	VulkanSwapchain::~VulkanSwapchain()
 	{
 		m_WaitSemaphores.clear();
 		m_Images.clear();
 
+		if (m_bOffscreen)
+			return;
+
 		RenderManager::SubmitResourceFree([device = m_Device->GetVulkanDevice(), swapchain = m_Swapchain, instance = m_Instance, surface = m_Surface]()
 		{
 			vkDestroySwapchainKHR(device, swapchain, nullptr);
@@ -76,6 +89,12 @@ namespace Eagle
 		m_Device = device;
 		m_bVSyncEnabled = bEnableVSync;
 
+		if (m_bOffscreen)
+		{
+			RecreateOffscreenImages();
+			return;
+		}
+
 		const VulkanPhysicalDevice* physicalDevice = m_Device->GetPhysicalDevice();
 		if (!physicalDevice->RequiresPresentQueue())
 		{
@@ -90,6 +109,13 @@ namespace Eagle
 
 	void VulkanSwapchain::SetVSyncEnabled(bool bEnabled)
 	{
+		// Nothing to wait for offscreen
+		if (m_bOffscreen)
+		{
+			m_bVSyncEnabled = bEnabled;
+			return;
+		}
+
 		if (m_bVSyncEnabled != bEnabled)
 		{
 			m_bVSyncEnabled = bEnabled;
@@ -101,8 +127,40 @@ namespace Eagle
 		}
 	}
 
+	void VulkanSwapchain::SetOffscreenSize(glm::uvec2 size)
+	{
+		EG_CORE_ASSERT(m_bOffscreen);
+		if (m_Extent.width == size.x && m_Extent.height == size.y)
+			return;
+
+		Application::Get().CallNextFrame([this, size]()
+		{
+			RenderManager::Wait();
+			m_Extent = { size.x, size.y };
+			RecreateOffscreenImages();
+		});
+	}
+
+	void VulkanSwapchain::DumpFrame(uint64_t frame, const Path& path)
+	{
+		EG_CORE_ASSERT(m_bOffscreen);
+		m_FrameDumps[frame] = path;
+	}
+
 	void VulkanSwapchain::Present(const Ref<Semaphore>& waitSemaphore)
 	{
+		if (m_bOffscreen)
+		{
+			auto it = m_FrameDumps.find(m_PresentedFrames);
+			if (it != m_FrameDumps.end())
+			{
+				WriteFrameDump(m_Images[m_SwapchainPresentImageIndex], it->second);
+				m_FrameDumps.erase(it);
+			}
+			++m_PresentedFrames;
+			return;
+		}
+
 		VkSemaphore vkWaitSemaphore = waitSemaphore ? (VkSemaphore)waitSemaphore->GetHandle() : nullptr;
 		VkPresentInfoKHR info{};
 		info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
@@ -127,6 +185,16 @@ namespace Eagle
 
 	const Ref<Semaphore>& VulkanSwapchain::AcquireImage(uint32_t* outFrameIndex)
 	{
+		if (m_bOffscreen)
+		{
+			// The ring has `FramesInFlight` images, so an image is reused only after the fence of the frame that used it was waited on
+			static const Ref<Semaphore> s_NullSemaphore;
+			m_SwapchainPresentImageIndex = m_FrameIndex;
+			*outFrameIndex = m_SwapchainPresentImageIndex;
+			m_FrameIndex = (m_FrameIndex + 1) % uint32_t(m_Images.size());
+			return s_NullSemaphore;
+		}
+
 		auto* semaphore = &m_WaitSemaphores[m_FrameIndex];
 		VkSemaphore vkSemaphore = (VkSemaphore)(*semaphore)->GetHandle();
 		VkResult result = vkAcquireNextImageKHR(m_Device->GetVulkanDevice(), m_Swapchain, UINT64_MAX, vkSemaphore, VK_NULL_HANDLE, &m_SwapchainPresentImageIndex);
@@ -223,6 +291,48 @@ namespace Eagle
 			m_RecreatedCallback();
 	}
 
+	void VulkanSwapchain::RecreateOffscreenImages()
+	{
+		ImageSpecifications specs;
+		specs.Size = glm::uvec3{ m_Extent.width, m_Extent.height, 1u };
+		specs.Format = VulkanToImageFormat(m_Format.format);
+		specs.Usage = ImageUsage::ColorAttachment | ImageUsage::TransferSrc;
+		specs.Type = ImageType::Type2D;
+
+		m_Images.clear();
+		for (uint32_t i = 0; i < RendererConfig::FramesInFlight; ++i)
+			m_Images.push_back(MakeRef<VulkanImage>(specs, "OffscreenSwapchainImage" + std::to_string(i)));
+		m_FrameIndex = 0;
+
+		if (m_RecreatedCallback)
+			m_RecreatedCallback();
+	}
+
+	void VulkanSwapchain::WriteFrameDump(const Ref<Image>& image, const Path& path) const
+	{
+		// Present is called right after the frame was submitted, so wait for it to finish before reading
+		m_Device->WaitIdle();
+
+		const glm::uvec3 size = image->GetSize();
+		std::vector<uint8_t> pixels(CalculateImageMemorySize(image->GetFormat(), size));
+		const ImageLayout layout = GetPresentLayout();
+		image->Read(pixels.data(), layout, layout);
+
+		// BGRA -> RGBA. Alpha is forced to 1 since the present pass doesn't write meaningful alpha
+		for (size_t i = 0; i < pixels.size(); i += 4)
+		{
+			std::swap(pixels[i], pixels[i + 2]);
+			pixels[i + 3] = 255u;
+		}
+
+		if (path.has_parent_path())
+			std::filesystem::create_directories(path.parent_path());
+		if (Utils::WritePNG(path, size.x, size.y, pixels.data()))
+			EG_RENDERER_INFO("Saved frame #{} to {}", m_PresentedFrames, path);
+		else
+			EG_RENDERER_ERROR("Failed to save frame #{} to {}", m_PresentedFrames, path);
+	}
+
 	void VulkanSwapchain::CreateSyncObjects()
 	{
 		m_WaitSemaphores.clear();
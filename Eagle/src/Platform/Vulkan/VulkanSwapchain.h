@@ -16,11 +16,19 @@ namespace Eagle
 	{
 	public:
 		VulkanSwapchain(VkInstance instance, GLFWwindow* window);
+
+		// Offscreen swapchain. Doesn't require a window or a surface, frames are rendered into a ring of images.
+		// Nothing is presented, so there's no need in the present queue
+		VulkanSwapchain(glm::uvec2 size);
 		virtual ~VulkanSwapchain();
 
 		void Init(const VulkanDevice* device, bool bEnableVSync);
 		VkSurfaceKHR GetSurface() const { return m_Surface; }
 		bool IsVSyncEnabled() const { return m_bVSyncEnabled; }
+		bool IsOffscreen() const { return m_bOffscreen; }
+
+		// Layout that the images should be in when `Present` is called
+		ImageLayout GetPresentLayout() const { return m_bOffscreen ? ImageLayout(ImageReadAccess::CopySource) : ImageLayout(ImageLayoutType::Present); }
 
 		void SetVSyncEnabled(bool bEnabled);
 
@@ -31,20 +39,30 @@ namespace Eagle
 
 		void Present(const Ref<Semaphore>& waitSemaphore);
 
-		// Returns a semaphore that will be signaled when image is ready
+		// Returns a semaphore that will be signaled when image is ready.
+		// Offscreen swapchain returns null since its images are available as soon as the previous frame that used them is finished
 		const Ref<Semaphore>& AcquireImage(uint32_t* outFrameIndex);
 
+		// Offscreen only
+		void SetOffscreenSize(glm::uvec2 size);
+
+		// Offscreen only. Saves the image of the `frame`-th present call (starting from 0) to a PNG file
+		void DumpFrame(uint64_t frame, const Path& path);
+
 		uint32_t GetFrameIndex() const { return m_FrameIndex; }
 		glm::uvec2 GetSize() const { return { m_Extent.width, m_Extent.height }; }
 
 	private:
 		void RecreateSwapchain();
+		void RecreateOffscreenImages();
 		void CreateSyncObjects();
+		void WriteFrameDump(const Ref<Image>& image, const Path& path) const;
 
 	private:
 		std::function<void()> m_RecreatedCallback;
 		std::vector<Ref<Image>> m_Images;
 		std::vector<Ref<Semaphore>> m_WaitSemaphores;
+		std::unordered_map<uint64_t, Path> m_FrameDumps; // Frame -> path
 		SwapchainSupportDetails m_SupportDetails;
 		VkExtent2D m_Extent;
 		VkSurfaceFormatKHR m_Format;
@@ -55,6 +73,8 @@ namespace Eagle
 		GLFWwindow* m_Window = nullptr;
 		uint32_t m_FrameIndex = 0;
 		uint32_t m_SwapchainPresentImageIndex = 0;
+		uint64_t m_PresentedFrames = 0;
 		bool m_bVSyncEnabled = false;
+		bool m_bOffscreen = false;
 	};
 }
@@ -9,6 +9,7 @@
 #include <GLFW/glfw3native.h>
 #include <shellapi.h>
 #include <ShlObj_core.h>
+#include <psapi.h>
 
 namespace Eagle
 {
@@ -161,6 +162,18 @@ namespace Eagle
 		{
 			return IsProcessorFeaturePresent(PF_XMMI64_INSTRUCTIONS_AVAILABLE);
 		}
+
+		ProcessMemory GetProcessMemory()
+		{
+			ProcessMemory result;
+			PROCESS_MEMORY_COUNTERS counters{};
+			if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+			{
+				result.Current = counters.WorkingSetSize;
+				result.Peak = counters.PeakWorkingSetSize;
+			}
+			return result;
+		}
 	}
 	
 	namespace Dialog
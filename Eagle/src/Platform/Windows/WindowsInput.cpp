@@ -13,6 +13,9 @@ namespace Eagle
 	bool Input::IsKeyPressed(Key keyCode)
 	{
 		GLFWwindow* window = Application::Get().GetWindow().GetGLFWWindow();
+		if (!window)
+			return false;
+
 		int state = glfwGetKey(window, int(keyCode));
 		return state == GLFW_PRESS || state == GLFW_REPEAT;
 	}
@@ -20,6 +23,9 @@ namespace Eagle
 	bool Input::IsMouseButtonPressed(Mouse mouseButton)
 	{
 		GLFWwindow* window = Application::Get().GetWindow().GetGLFWWindow();
+		if (!window)
+			return false;
+
 		int state = glfwGetMouseButton(window, int(mouseButton));
 		return state == GLFW_PRESS;
 	}
@@ -27,6 +33,9 @@ namespace Eagle
 	std::pair<float, float> Input::GetMousePosition()
 	{
 		GLFWwindow* window = Application::Get().GetWindow().GetGLFWWindow();
+		if (!window)
+			return { 0.f, 0.f };
+
 		double x, y;
 		glfwGetCursorPos(window, &x, &y);
 		return {(float)x, (float)y};
@@ -48,14 +57,15 @@ namespace Eagle
 	{
 		s_CursorVisible = bShow;
 		GLFWwindow* window = Application::Get().GetWindow().GetGLFWWindow();
-
-		glfwSetInputMode(window, GLFW_CURSOR, bShow ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_DISABLED);
+		if (window)
+			glfwSetInputMode(window, GLFW_CURSOR, bShow ? GLFW_CURSOR_NORMAL : GLFW_CURSOR_DISABLED);
 	}
 
 	void Input::SetMousePos(double xPos, double yPos)
 	{
 		GLFWwindow* window = Application::Get().GetWindow().GetGLFWWindow();
-		glfwSetCursorPos(window, xPos, yPos);
+		if (window)
+			glfwSetCursorPos(window, xPos, yPos);
 	}
 
 	bool Input::IsMouseVisible()
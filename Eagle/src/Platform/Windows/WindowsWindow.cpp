@@ -19,7 +19,6 @@
 namespace Eagle
 {
 	static bool s_GLFWInitialized = false;
-	float Window::s_HighDPIScaleFactor = 1.0f;
 
 	static void GLFWErrorCallback(int error, const char* description)
 	{
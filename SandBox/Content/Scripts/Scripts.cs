@@ -908,4 +908,18 @@ namespace Sandbox
             Renderer.SetSkySettings(sky);
         }
     }
+
+    // Used by Eagle-Benchmark to measure the cost of C# updates
+    public class BenchmarkSpinner : Entity
+    {
+        public float Speed = 90f;
+
+        public override void OnUpdate(float ts)
+        {
+            Quat rotation = Mathf.AngleAxis(Mathf.Radians(Speed * ts), new Vector3(0f, 1f, 0f));
+            Rotator resultRotator = new Rotator();
+            resultRotator.Rotation = rotation * WorldRotation.Rotation;
+            WorldRotation = resultRotator;
+        }
+    }
 }
@@ -83,6 +83,32 @@ LibFiles["SPIRV_Cross_Debug"] = "%{LibDir.VulkanSDK}/spirv-cross-cored.lib"
 LibFiles["ShaderC_Release"] = "%{LibDir.VulkanSDK}/shaderc_combined.lib"
 LibFiles["SPIRV_Cross_Release"] = "%{LibDir.VulkanSDK}/spirv-cross-core.lib"
 
+-- The vendored binaries are built with MSVC. Linux builds expect the same libraries
+-- to be installed on the system (or next to the Vulkan SDK) and only run headless
+if os.target() == "linux" then
+	IncludeDir["VulkanSDK"] = "%{VULKAN_SDK}/include"
+	LibDir["VulkanSDK"] = "%{VULKAN_SDK}/lib"
+end
+
+LinuxLinks =
+{
+	"PhysXExtensions_static_64",
+	"PhysXCharacterKinematic_static_64",
+	"PhysXCooking_static_64",
+	"PhysXVehicle_static_64",
+	"PhysXPvdSDK_static_64",
+	"PhysX_static_64",
+	"PhysXCommon_static_64",
+	"PhysXFoundation_static_64",
+	"assimp",
+	"monosgen-2.0",
+	"shaderc_combined",
+	"spirv-cross-core",
+	"vulkan",
+	"pthread",
+	"dl"
+}
+
 group "Dependecies"
 	include "Eagle/vendor/GLFW"
 	include "Eagle/vendor/imgui"
@@ -172,31 +198,67 @@ project "Eagle"
 		"GLFW",
 		"ImGui",
 		"yaml-cpp",
-		"MSDF-Atlas",
-		"assimp-vc143-mt.lib",
-		"%{LibFiles.Vulkan}"
-	}
-
-	linkoptions
-	{
-		"/ignore:4099", -- Disable 'PDB was not found' warnings 
-		"/ignore:4006" -- Disable 'already defined in ...; second definition ignored' warnings 
+		"MSDF-Atlas"
 	}
 
 	filter "files:Eagle/vendor/ImGuizmo/**.cpp"
 		flags { "NoPCH"	}
 	filter "files:Eagle/src/Platform/Vulkan/Debug/**.cpp"
 		flags { "NoPCH"	}
-	filter "files:Eagle/src/Eagle/Script/ScriptEngineRegistry.cpp"
+	filter { "action:vs*", "files:Eagle/src/Eagle/Script/ScriptEngineRegistry.cpp" }
 		buildoptions { "/bigobj" }
 
+	filter "action:vs*"
+		linkoptions
+		{
+			"/ignore:4099", -- Disable 'PDB was not found' warnings 
+			"/ignore:4006" -- Disable 'already defined in ...; second definition ignored' warnings 
+		}
+
+	filter { "action:vs*", "configurations:Release or Dist" }
+		buildoptions
+		{
+			"/Ob2"
+		}
+
 	filter "system:windows"
 		systemversion "latest"
+		removefiles { "%{prj.name}/src/Platform/Linux/**" }
+		links
+		{
+			"assimp-vc143-mt.lib",
+			"%{LibFiles.Vulkan}"
+		}
+
+	-- Linux builds are headless only. The system libraries are linked by the executables, see LinuxLinks
+	filter "system:linux"
+		pic "On"
+		removefiles { "%{prj.name}/src/Platform/Windows/**" }
 
 	filter "configurations:Debug"
 		defines "EG_DEBUG"
 		runtime "Debug"
 		symbols "on"
+
+	filter "configurations:Release"
+		defines 
+		{
+			"EG_RELEASE",
+			"NDEBUG"
+		}
+		runtime "Release"
+		optimize "on"
+
+	filter "configurations:Dist"
+		defines 
+		{
+			"EG_DIST",
+			"NDEBUG"
+		}
+		runtime "Release"
+		optimize "on"
+
+	filter { "system:windows", "configurations:Debug" }
 		libdirs
 		{
 			"%{LibDir.PhysXDebug}",
@@ -219,12 +281,7 @@ project "Eagle"
 			"%{LibFiles.SPIRV_Cross_Debug}",
 		}
 
-	filter "configurations:Release"
-		defines 
-		{
-			"EG_RELEASE",
-			"NDEBUG"
-		}
+	filter { "system:windows", "configurations:Release or Dist" }
 		libdirs
 		{
 			"%{LibDir.PhysXRelease}",
@@ -246,10 +303,87 @@ project "Eagle"
 			"%{LibFiles.ShaderC_Release}",
 			"%{LibFiles.SPIRV_Cross_Release}",
 		}
+
+project "Eagle-Editor"
+	location "Eagle-Editor"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	--warnings "Extra"
+	--flags { "FatalWarnings" }
+
+	files
+	{
+		"%{prj.name}/src/**.h",
+		"%{prj.name}/src/**.cpp",
+		"%{prj.name}/assets/**.**"
+	}
+
+	includedirs
+	{
+		"Eagle/vendor/spdlog/include",
+		"Eagle/src",
+		"Eagle/vendor",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.entt}",
+		"%{IncludeDir.ImGuizmo}",
+		"%{IncludeDir.yaml_cpp}",
+		"%{IncludeDir.VulkanSDK}",
+		"%{IncludeDir.ImGui}",
+		"%{IncludeDir.ThreadPool}",
+		"%{IncludeDir.MSDF}",
+		"%{IncludeDir.MSDFGen}",
+		"%{IncludeDir.MagicEnum}"
+	}
+
+	links
+	{
+		"Eagle",
+		"Eagle-Scripts"
+	}
+
+	defines
+	{
+		"GLM_FORCE_DEPTH_ZERO_TO_ONE",
+		"MSDF_ATLAS_PUBLIC=",
+		"IMGUI_DEFINE_MATH_OPERATORS="
+	}
+
+	filter "action:vs*"
+		linkoptions
+		{
+			"/ignore:4099", -- Disable 'PDB was not found' warnings 
+			"/ignore:4006" -- Disable 'already defined in ...; second definition ignored' warnings 
+		}
+
+	filter { "action:vs*", "configurations:Release or Dist" }
 		buildoptions
 		{
 			"/Ob2"
 		}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "system:linux"
+		links { LinuxLinks }
+
+	filter "configurations:Debug"
+		defines "EG_DEBUG"
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:Release"
+		defines 
+		{
+			"EG_RELEASE",
+			"NDEBUG"
+		}
 		runtime "Release"
 		optimize "on"
 
@@ -259,36 +393,42 @@ project "Eagle"
 			"EG_DIST",
 			"NDEBUG"
 		}
-		libdirs
+		runtime "Release"
+		optimize "on"
+
+	filter { "system:windows", "configurations:Debug" }
+		postbuildcommands 
 		{
-			"%{LibDir.PhysXRelease}",
-			"%{LibDir.fmodRelease}"
+			'{COPY} "../Eagle/vendor/mono/bin/Debug/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
+			'{COPY} "../Eagle/vendor/fmod/lib/Debug/fmodL.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
 		}
-		links
+
+	filter { "system:windows", "configurations:Release or Dist" }
+		postbuildcommands 
 		{
-			"%{LibFiles.PhysXRelease}",
-			"%{LibFiles.PhysXCharacterKinematicRelease}",
-			"%{LibFiles.PhysXCommonRelease}",
-			"%{LibFiles.PhysXCookingRelease}", 
-			"%{LibFiles.PhysXExtensionsRelease}",
-			"%{LibFiles.PhysXFoundationRelease}",
-			"%{LibFiles.PhysXPvdSDKRelease}",
-			"%{LibFiles.PhysXVehicleRelease}",
-			"%{LibFiles.fmodRelease}",
-			"%{LibFiles.monoRelease}",
+			'{COPY} "../Eagle/vendor/mono/bin/Release/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
+			'{COPY} "../Eagle/vendor/fmod/lib/Release/fmod.dll" "%{cfg.targetdir}"'
+		}
 
-			"%{LibFiles.ShaderC_Release}",
-			"%{LibFiles.SPIRV_Cross_Release}",
+	filter { "system:linux", "configurations:Debug" }
+		libdirs
+		{
+			"%{LibDir.PhysXDebug}",
+			"%{LibDir.fmodDebug}"
 		}
-		buildoptions
+		links { "fmodL" }
+
+	filter { "system:linux", "configurations:Release or Dist" }
+		libdirs
 		{
-			"/Ob2"
+			"%{LibDir.PhysXRelease}",
+			"%{LibDir.fmodRelease}"
 		}
-		runtime "Release"
-		optimize "on"
+		links { "fmod" }
 
-project "Eagle-Editor"
-	location "Eagle-Editor"
+project "Eagle-Benchmark"
+	location "Eagle-Benchmark"
 	kind "ConsoleApp"
 	language "C++"
 	cppdialect "C++17"
@@ -297,14 +437,16 @@ project "Eagle-Editor"
 	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
 	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
 
+	-- Shaders, fonts and script assemblies are loaded from the editor folder
+	debugdir "Eagle-Editor"
+
 	--warnings "Extra"
 	--flags { "FatalWarnings" }
 
 	files
 	{
 		"%{prj.name}/src/**.h",
-		"%{prj.name}/src/**.cpp",
-		"%{prj.name}/assets/**.**"
+		"%{prj.name}/src/**.cpp"
 	}
 
 	includedirs
@@ -317,6 +459,7 @@ project "Eagle-Editor"
 		"%{IncludeDir.ImGuizmo}",
 		"%{IncludeDir.yaml_cpp}",
 		"%{IncludeDir.VulkanSDK}",
+		"%{IncludeDir.VulkanMemAlloc}",
 		"%{IncludeDir.ImGui}",
 		"%{IncludeDir.ThreadPool}",
 		"%{IncludeDir.MSDF}",
@@ -337,65 +480,79 @@ project "Eagle-Editor"
 		"IMGUI_DEFINE_MATH_OPERATORS="
 	}
 
-	linkoptions
-	{
-		"/ignore:4099", -- Disable 'PDB was not found' warnings 
-		"/ignore:4006" -- Disable 'already defined in ...; second definition ignored' warnings 
-	}
+	filter "action:vs*"
+		linkoptions
+		{
+			"/ignore:4099", -- Disable 'PDB was not found' warnings 
+			"/ignore:4006" -- Disable 'already defined in ...; second definition ignored' warnings 
+		}
+
+	filter { "action:vs*", "configurations:Release or Dist" }
+		buildoptions
+		{
+			"/Ob2"
+		}
 
 	filter "system:windows"
 		systemversion "latest"
 
+	filter "system:linux"
+		links { LinuxLinks }
+
 	filter "configurations:Debug"
 		defines "EG_DEBUG"
 		runtime "Debug"
 		symbols "on"
 
-		postbuildcommands 
-		{
-			'{COPY} "../Eagle/vendor/mono/bin/Debug/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
-			'{COPY} "../Eagle/vendor/fmod/lib/Debug/fmodL.dll" "%{cfg.targetdir}"',
-			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
-		}
-
 	filter "configurations:Release"
 		defines 
 		{
 			"EG_RELEASE",
 			"NDEBUG"
 		}
-		buildoptions
-		{
-			"/Ob2"
-		}
 		runtime "Release"
 		optimize "on"
 
-		postbuildcommands 
-		{
-			'{COPY} "../Eagle/vendor/mono/bin/Release/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
-			'{COPY} "../Eagle/vendor/fmod/lib/Release/fmod.dll" "%{cfg.targetdir}"'
-		}
-
 	filter "configurations:Dist"
 		defines 
 		{
 			"EG_DIST",
 			"NDEBUG"
 		}
-		buildoptions
-		{
-			"/Ob2"
-		}
 		runtime "Release"
 		optimize "on"
 
+	filter { "system:windows", "configurations:Debug" }
+		postbuildcommands 
+		{
+			'{COPY} "../Eagle/vendor/mono/bin/Debug/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
+			'{COPY} "../Eagle/vendor/fmod/lib/Debug/fmodL.dll" "%{cfg.targetdir}"',
+			'{COPY} "%{VULKAN_SDK}/Bin/shaderc_sharedd.dll" "%{cfg.targetdir}"'
+		}
+
+	filter { "system:windows", "configurations:Release or Dist" }
 		postbuildcommands 
 		{
 			'{COPY} "../Eagle/vendor/mono/bin/Release/mono-2.0-sgen.dll" "%{cfg.targetdir}"',
 			'{COPY} "../Eagle/vendor/fmod/lib/Release/fmod.dll" "%{cfg.targetdir}"'
 		}
 
+	filter { "system:linux", "configurations:Debug" }
+		libdirs
+		{
+			"%{LibDir.PhysXDebug}",
+			"%{LibDir.fmodDebug}"
+		}
+		links { "fmodL" }
+
+	filter { "system:linux", "configurations:Release or Dist" }
+		libdirs
+		{
+			"%{LibDir.PhysXRelease}",
+			"%{LibDir.fmodRelease}"
+		}
+		links { "fmod" }
+
 project "Eagle-Scripts"
 	location "Eagle-Scripts"
 	kind "SharedLib"